@@ -141,6 +141,7 @@ Dissolve::Dissolve()
     // shards.AddUpdateModule<Aether::KillOutsideBounds>(glm::vec3{ -1.45f, -1.2f, -1.45f }, glm::vec3{ 1.45f, 1.35f, 1.45f });
 
     m_GPUSystem = m_ParticleSystem->Build();
+    m_ParticlesRenderer->Prepare(m_GPUSystem);
 
     m_GraphicsContext->SetClearColor({ 0.015f, 0.025f, 0.06f, 1.0f });
 }
@@ -56,6 +56,11 @@ function(apply_properties_and_definitions target)
         target_compile_definitions(${target} PRIVATE EE_TESTING)
     endif()
 
+    # Allocator compile definitions
+    if (ELIXIR_SYSTEM_MALLOC)
+        target_compile_definitions(${target} PRIVATE EE_SYSTEM_MALLOC)
+    endif()
+
     # Profiling compile definitions
     message(STATUS "ELIXIR_PROFILE is: ${ELIXIR_PROFILE}")
     if (ELIXIR_PROFILE)
@@ -172,5 +177,8 @@ if (ELIXIR_PROFILE)
     target_link_libraries(${PROJECT_NAME} Tracy::TracyClient)
 endif()
 
+# Tools
+add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/Tools/ShaderReflect)
+
 # Testing
 add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/Tests)
\ No newline at end of file
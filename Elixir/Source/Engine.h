@@ -6,6 +6,7 @@
 #include <Engine/Core/Timer.h>
 #include <Engine/Core/Malloc.h>
 #include <Engine/Core/Memory.h>
+#include <Engine/Core/MemoryTracker.h>
 #include <Engine/Core/Buffer.h>
 #include <Engine/Core/DeletionQueue.h>
 #include <Engine/Core/Application.h>
@@ -56,6 +57,7 @@
 #include <Engine/GUI/HorizontalBox.h>
 #include <Engine/GUI/VerticalBox.h>
 #include <Engine/GUI/Overlay.h>
+#include <Engine/GUI/ListView.h>
 #include <Engine/GUI/Button.h>
 #include <Engine/GUI/TextBlock.h>
 
@@ -3,6 +3,7 @@
 
 #include <limits>
 
+#include <Engine/Core/File.h>
 #include <Engine/Graphics/TextureLoader.h>
 
 #include <magic_enum/magic_enum.hpp>
@@ -949,12 +950,33 @@ namespace Elixir::Aether
 
             return system;
         }
+
+        Ref<System> ParseEffect(const std::filesystem::path& filepath, const simdjson::padded_string& json)
+        {
+            od::parser parser;
+
+            auto document = parser.iterate(json);
+            if (const auto error = document.error())
+            {
+                const auto message = simdjson::error_message(error);
+                EE_CORE_ERROR("Failed to parse effect asset '{}': {}", filepath.string(), message)
+                return nullptr;
+            }
+
+            od::object root;
+            if (document.get_object().get(root))
+            {
+                EE_CORE_ERROR("Effect asset root must be an object: {}", filepath.string())
+                return nullptr;
+            }
+
+            EffectParser effectParser{ filepath };
+            return effectParser.Parse(root);
+        }
     }
 
     Ref<System> LoadEffectFile(const std::filesystem::path& filepath)
     {
-        od::parser parser;
-
         auto json = simdjson::padded_string::load(filepath.string());
         if (const auto error = json.error())
         {
@@ -963,22 +985,19 @@ namespace Elixir::Aether
             return nullptr;
         }
 
-        auto document = parser.iterate(json.value());
-        if (const auto error = document.error())
-        {
-            const auto message = simdjson::error_message(error);
-            EE_CORE_ERROR("Failed to parse effect asset '{}': {}", filepath.string(), message)
-            return nullptr;
-        }
+        return ParseEffect(filepath, json.value());
+    }
 
-        od::object root;
-        if (document.get_object().get(root))
+    Async<Ref<System>> LoadEffectFileAsync(const std::filesystem::path filepath)
+    {
+        const auto data = co_await LoadFileAsync(filepath);
+        if (!data)
         {
-            EE_CORE_ERROR("Effect asset root must be an object: {}", filepath.string())
-            return nullptr;
+            EE_CORE_ERROR("Failed to open effect asset '{}'", filepath.string())
+            co_return nullptr;
         }
 
-        EffectParser effectParser{ filepath };
-        return effectParser.Parse(root);
+        const simdjson::padded_string json((const char*)data->data(), data->size());
+        co_return ParseEffect(filepath, json);
     }
 }
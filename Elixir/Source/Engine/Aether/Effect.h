@@ -1,8 +1,16 @@
 #pragma once
 
 #include <Engine/Aether/System.h>
+#include <Engine/Core/Executor/Async.h>
 
 namespace Elixir::Aether
 {
     ELIXIR_API Ref<System> LoadEffectFile(const std::filesystem::path& filepath);
+
+    /**
+     * Load an effect asset without blocking: the file is read on an IO thread, then parsed
+     * on a worker thread, where the awaiting coroutine continues.
+     * @return The effect, or nullptr if it cannot be read or parsed.
+     */
+    ELIXIR_API Async<Ref<System>> LoadEffectFileAsync(std::filesystem::path filepath);
 }
\ No newline at end of file
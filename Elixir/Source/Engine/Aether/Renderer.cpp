@@ -2,8 +2,11 @@
 #include "Renderer.h"
 
 #include "Engine/Core/Color.h"
+#include "Engine/Core/MemoryTracker.h"
 #include "Engine/Graphics/CommandBuffer.h"
 #include "Engine/Graphics/SamplerBuilder.h"
+#include "Engine/Graphics/TextureLoader.h"
+#include "Engine/Graphics/Pipeline/PipelineBatch.h"
 #include "Engine/Graphics/Pipeline/PipelineBuilder.h"
 
 namespace Elixir::Aether
@@ -19,6 +22,11 @@ namespace Elixir::Aether
         uint32_t EmitterIndex = 0;
     };
 
+    struct SUpdatePushConstants
+    {
+        uint32_t EmitterIndex = 0;
+    };
+
     struct SSpritePushConstants
     {
         uint32_t SpriteIndex = 0;
@@ -29,6 +37,22 @@ namespace Elixir::Aether
         uint32_t EmitterIndex = 0;
     };
 
+    // Specialization constant holding the set of update ops an emitter uses
+    constexpr uint32_t UPDATE_OP_MASK_ID = 0;
+    static_assert((uint32_t)EParticleOp::ApplyVortex < 32, "Update op mask holds 32 op types");
+
+    uint32_t GetUpdateOpMask(const SGPUSystem& system, const SGPUEmitter& emitter)
+    {
+        const auto first = std::min<size_t>(emitter.UpdateOpOffset, system.Ops.size());
+        const auto last = std::min<size_t>(first + emitter.UpdateOpCount, system.Ops.size());
+
+        uint32_t mask = 0;
+        for (size_t i = first; i < last; i++)
+            mask |= 1u << (uint32_t)system.Ops[i].Type;
+
+        return mask;
+    }
+
     SEmitterData ToEmitterDescription(const SGPUEmitter& emitter)
     {
         SEmitterData desc{};
@@ -85,7 +109,7 @@ namespace Elixir::Aether
     }
 
     Renderer::Renderer(const GraphicsContext* context, const ShaderLoader* shaderLoader)
-        : m_GraphicsContext(context)
+        : m_GraphicsContext(context), m_ShaderLoader(shaderLoader)
     {
         EE_CORE_INFO("Initializing Aether Renderer.")
 
@@ -101,8 +125,58 @@ namespace Elixir::Aether
         m_ElapsedTimeSeconds += timestep.GetSeconds();
     }
 
+    void Renderer::Prepare(const SGPUSystem& system)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        MemoryTagScope tag(EMemoryTag::Aether);
+
+        const auto emitterCount = std::min((uint32_t)system.Emitters.size(), MAX_EMITTERS);
+
+        // Variants built before are shared through the pipeline library, emitters using the
+        // same ops share one request
+        PipelineBatch batch(m_GraphicsContext, m_ShaderLoader);
+        std::unordered_map<uint32_t, ComputePipelineFuture> variants;
+        std::vector<uint32_t> masks(emitterCount);
+
+        for (uint32_t i = 0; i < emitterCount; ++i)
+        {
+            masks[i] = GetUpdateOpMask(system, system.Emitters[i]);
+
+            if (!variants.contains(masks[i]))
+            {
+                const auto permutation = ShaderPermutation().Set(UPDATE_OP_MASK_ID, masks[i]);
+                variants.emplace(masks[i], batch.BuildCompute(m_UpdateShader, permutation));
+            }
+        }
+
+        batch.Wait();
+
+        m_UpdatePipelines.clear();
+        for (const auto mask : masks)
+            m_UpdatePipelines.push_back(variants.at(mask).Get());
+
+        m_UpdateOpMasks = std::move(masks);
+    }
+
+    bool Renderer::IsPrepared(const SGPUSystem& system) const
+    {
+        const auto emitterCount = std::min((uint32_t)system.Emitters.size(), MAX_EMITTERS);
+        if (m_UpdateOpMasks.size() != emitterCount)
+            return false;
+
+        for (uint32_t i = 0; i < emitterCount; ++i)
+        {
+            if (m_UpdateOpMasks[i] != GetUpdateOpMask(system, system.Emitters[i]))
+                return false;
+        }
+
+        return true;
+    }
+
     void Renderer::Render(const SGPUSystem& system, const Camera& camera)
     {
+        MemoryTagScope tag(EMemoryTag::Aether);
+
         m_RenderExtent = m_GraphicsContext->GetRenderTarget()->GetExtent();
 
         m_FrameData.View = camera.GetViewMatrix();
@@ -114,6 +188,9 @@ namespace Elixir::Aether
         const auto emitterCount = std::min((uint32_t)system.Emitters.size(), MAX_EMITTERS);
         const auto maxParticles = std::min(system.TotalMaxParticles, MAX_PARTICLES);
 
+        if (!IsPrepared(system))
+            Prepare(system);
+
         UpdateBuffers(system);
 
         const auto cmd = m_GraphicsContext->GetSecondaryCommandBuffer();
@@ -151,8 +228,21 @@ namespace Elixir::Aether
             EPipelineAccess::ShaderRead | EPipelineAccess::ShaderWrite
         );
 
-        m_UpdatePipeline->Bind(cmd);
-        cmd->Dispatch((maxParticles + COMPUTE_GROUP_SIZE - 1) / COMPUTE_GROUP_SIZE);
+        // Each emitter runs the update shader specialized for its own ops
+        for (uint32_t i = 0; i < emitterCount; ++i)
+        {
+            const auto offset = (uint32_t)emitters[i].MetaA.x;
+            if (offset >= maxParticles) continue;
+
+            const auto particleCount = std::min((uint32_t)emitters[i].MetaA.y, maxParticles - offset);
+            if (particleCount == 0) continue;
+
+            m_UpdatePipelines[i]->Bind(cmd);
+
+            const SUpdatePushConstants pushConstants{ i };
+            m_UpdateShader->SetPushConstant(cmd, "pc", (void*)&pushConstants, sizeof(SUpdatePushConstants));
+            cmd->Dispatch((particleCount + COMPUTE_GROUP_SIZE - 1) / COMPUTE_GROUP_SIZE);
+        }
 
         m_ParticleBuffer->Barrier(
             cmd,
@@ -227,44 +317,44 @@ namespace Elixir::Aether
 
     void Renderer::Init(const ShaderLoader* shaderLoader)
     {
-        m_SpawnShader = shaderLoader->LoadShader(
+        MemoryTagScope tag(EMemoryTag::Aether);
+
+        // Shaders are reflected and pipelines compiled concurrently
+        PipelineBatch batch(m_GraphicsContext, shaderLoader);
+
+        const auto spawnShader = batch.LoadShader(
             "./Shaders/Aether/",
-            std::array<std::string_view, 1>{ "ParticlesSpawn" },
+            { "ParticlesSpawn" },
             "ParticlesSpawn",
             EShaderStage::Compute
         );
 
-        m_UpdateShader = shaderLoader->LoadShader(
+        const auto updateShader = batch.LoadShader(
             "./Shaders/Aether/",
-            std::array<std::string_view, 1>{ "ParticlesUpdate" },
+            { "ParticlesUpdate" },
             "ParticlesUpdate",
             EShaderStage::Compute
         );
 
-        m_SpriteShader = shaderLoader->LoadShader(
+        const auto spriteShader = batch.LoadShader(
             "./Shaders/Aether/",
-            std::array<std::string_view, 1>{ "Sprite" },
+            { "Sprite" },
             "SpriteRenderer"
         );
 
-        m_RibbonShader = shaderLoader->LoadShader(
+        const auto ribbonShader = batch.LoadShader(
             "./Shaders/Aether/",
-            std::array<std::string_view, 1>{ "Ribbon" },
+            { "Ribbon" },
             "RibbonRenderer"
         );
 
-        m_MeshShader = shaderLoader->LoadShader(
+        const auto meshShader = batch.LoadShader(
             "./Shaders/Aether/",
-            std::array<std::string_view, 1>{ "Mesh" },
+            { "Mesh" },
             "MeshRenderer"
         );
 
-        SPipelineCreateInfo pipelineInfo{};
-        pipelineInfo.Shader = m_SpawnShader;
-        m_SpawnPipeline = ComputePipeline::Create(m_GraphicsContext, pipelineInfo);
-
-        pipelineInfo.Shader = m_UpdateShader;
-        m_UpdatePipeline = ComputePipeline::Create(m_GraphicsContext, pipelineInfo);
+        const auto spawnPipeline = batch.BuildCompute(spawnShader);
 
         const BufferLayout spriteBufferLayout({
             {
@@ -281,7 +371,6 @@ namespace Elixir::Aether
         });
 
         PipelineBuilder spriteBuilder;
-        spriteBuilder.SetShader(m_SpriteShader);
         spriteBuilder.SetInputTopology(EPrimitiveTopology::TriangleList);
         spriteBuilder.SetPolygonMode(EPolygonMode::Fill);
         spriteBuilder.SetCullMode(ECullMode::None, EFrontFace::CounterClockwise);
@@ -290,13 +379,9 @@ namespace Elixir::Aether
         spriteBuilder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
         spriteBuilder.SetDepthAttachmentFormat(EDepthStencilImageFormat::D32_SFLOAT);
         spriteBuilder.SetBufferLayout(spriteBufferLayout);
-        m_SpritePipeline = spriteBuilder.Build(m_GraphicsContext);
-
-        m_Sprites = TextureSet::Create(m_GraphicsContext);
-        m_SpriteSampler = SamplerBuilder().Build(m_GraphicsContext);
+        const auto spritePipeline = batch.Build(spriteBuilder, spriteShader);
 
         PipelineBuilder ribbonBuilder;
-        ribbonBuilder.SetShader(m_RibbonShader);
         ribbonBuilder.SetInputTopology(EPrimitiveTopology::TriangleList);
         ribbonBuilder.SetPolygonMode(EPolygonMode::Fill);
         ribbonBuilder.SetCullMode(ECullMode::None, EFrontFace::CounterClockwise);
@@ -305,7 +390,7 @@ namespace Elixir::Aether
         ribbonBuilder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
         ribbonBuilder.SetDepthAttachmentFormat(EDepthStencilImageFormat::D32_SFLOAT);
         ribbonBuilder.SetBufferLayout({});
-        m_RibbonPipeline = ribbonBuilder.Build(m_GraphicsContext);
+        const auto ribbonPipeline = batch.Build(ribbonBuilder, ribbonShader);
 
         const BufferLayout meshBufferLayout({
             {
@@ -329,21 +414,31 @@ namespace Elixir::Aether
         });
 
         PipelineBuilder meshBuilder;
-        meshBuilder.SetShader(m_MeshShader);
         meshBuilder.SetInputTopology(EPrimitiveTopology::TriangleList);
         meshBuilder.SetPolygonMode(EPolygonMode::Fill);
         meshBuilder.SetCullMode(ECullMode::Back, EFrontFace::CounterClockwise);
         meshBuilder.EnableAlphaBlendingMax();
         meshBuilder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
         meshBuilder.SetDepthAttachmentFormat(EDepthStencilImageFormat::D32_SFLOAT);
+        meshBuilder.EnableDepthTest(true, ECompareOp::LessOrEqual);
         meshBuilder.SetBufferLayout(meshBufferLayout);
+        const auto meshPipeline = batch.Build(meshBuilder, meshShader);
 
-        auto info = meshBuilder.GetCreateInfo();
-        info.DepthStencil.DepthTestEnable = true;
-        info.DepthStencil.DepthWriteEnable = true;
-        info.DepthStencil.DepthCompareOp = ECompareOp::LessOrEqual;
+        m_Sprites = TextureSet::Create(m_GraphicsContext);
+        m_SpriteSampler = SamplerBuilder().Build(m_GraphicsContext);
+
+        batch.Wait();
+
+        m_SpawnShader = spawnShader.Get();
+        m_UpdateShader = updateShader.Get();
+        m_SpriteShader = spriteShader.Get();
+        m_RibbonShader = ribbonShader.Get();
+        m_MeshShader = meshShader.Get();
 
-        m_MeshPipeline = GraphicsPipeline::Create(m_GraphicsContext, info);
+        m_SpawnPipeline = spawnPipeline.Get();
+        m_SpritePipeline = spritePipeline.Get();
+        m_RibbonPipeline = ribbonPipeline.Get();
+        m_MeshPipeline = meshPipeline.Get();
     }
 
     void Renderer::CreateBuffers()
@@ -467,6 +562,14 @@ namespace Elixir::Aether
         if (!texture)
             return m_WhiteTextureHandle.Index;
 
+        // Cached textures are in the shared bindless pool already, and must not be kept
+        // alive by the sprite set or they could never be evicted
+        if (const auto& cache = TextureLoader::GetCache())
+        {
+            if (const auto handle = cache->GetHandle(texture.get()); handle.IsValid())
+                return handle.Index;
+        }
+
         if (const auto it = m_SpriteTextures.find(texture); it != m_SpriteTextures.end())
             return it->second.Index;
 
@@ -70,6 +70,19 @@ namespace Elixir::Aether
         Renderer(const GraphicsContext* context, const ShaderLoader* shaderLoader);
 
         void Update(const Timestep& timestep);
+
+        /**
+         * Resolve the update pipeline of every emitter, building the variants missing on the
+         * worker threads. Call whenever the system or its ops change, rendering only binds
+         * the pipelines resolved here.
+         * @param system The system to be rendered.
+         */
+        void Prepare(const SGPUSystem& system);
+
+        /**
+         * Simulate and draw a system. A system not prepared yet, see @ref Prepare, or whose
+         * emitters use other ops than when it was prepared, is prepared first.
+         */
         void Render(const SGPUSystem& system, const Camera& camera);
 
       private:
@@ -79,6 +92,11 @@ namespace Elixir::Aether
         void InitPerFrameData();
         void BindShaderParameters();
 
+        /**
+         * Check whether the update pipelines match the ops of every emitter of a system.
+         */
+        bool IsPrepared(const SGPUSystem& system) const;
+
         uint32_t ResolveSpriteIndex(const Ref<Texture2D>& texture);
 
         void BeginRendering(const Ref<CommandBuffer>& cmd) const;
@@ -102,7 +120,10 @@ namespace Elixir::Aether
         Ref<Shader> m_SpawnShader;
         Ref<ComputePipeline> m_SpawnPipeline;
         Ref<Shader> m_UpdateShader;
-        Ref<ComputePipeline> m_UpdatePipeline;
+        // Specialized for the ops of each emitter, by emitter index
+        std::vector<Ref<ComputePipeline>> m_UpdatePipelines;
+        // Update ops of each emitter the pipelines were resolved for
+        std::vector<uint32_t> m_UpdateOpMasks;
         Ref<Shader> m_SpriteShader;
         Ref<GraphicsPipeline> m_SpritePipeline;
         Ref<Shader> m_RibbonShader;
@@ -134,5 +155,6 @@ namespace Elixir::Aether
 
         Extent2D m_RenderExtent{};
         const GraphicsContext* m_GraphicsContext;
+        const ShaderLoader* m_ShaderLoader;
     };
 }
@@ -8,6 +8,7 @@
 #include "Engine/GUI/TextBlock.h"
 #include "Engine/GUI/TextField.h"
 
+#include <Engine/Core/MemoryTracker.h>
 #include <Engine/Core/Platform.h>
 #include <Engine/Input/InputManager.h>
 #include <Engine/Input/InputCodes.h>
@@ -16,6 +17,40 @@
 
 namespace Elixir
 {
+    namespace
+    {
+        /**
+         * Summarize the tracked memory for the stats overlay: the live bytes and allocation
+         * rate of every tag together, then the tags over their budget.
+         */
+        std::string FormatMemoryStats()
+        {
+            float allocationsPerSecond = 0.0f;
+            std::string overBudget;
+
+            for (size_t i = 0; i < MemoryTracker::TAG_COUNT; i++)
+            {
+                const auto tag = (EMemoryTag)i;
+                const auto stats = MemoryTracker::GetStats(tag);
+
+                allocationsPerSecond += stats.AllocationsPerSecond;
+                if (stats.OverBudget)
+                    overBudget += std::format(" {}", MemoryTracker::GetTagName(tag));
+            }
+
+            auto text = std::format(
+                "Memory: {:.1f} MiB, {:.0f} allocs/s",
+                (float)MemoryTracker::GetTotalLiveBytes() / (1024.0f * 1024.0f),
+                allocationsPerSecond
+            );
+
+            if (!overBudget.empty())
+                text += "  |  Over budget:" + overBudget;
+
+            return text;
+        }
+    }
+
     Application* Application::s_Application = nullptr;
 
     Application::Application() : m_Executor(Executor::Get())
@@ -129,6 +164,7 @@ namespace Elixir
     {
         EE_PROFILE_ZONE_SCOPED()
         FontManager::Shutdown();
+        TextureLoader::Shutdown();
         Platform::Shutdown();
         m_Running = false;
     }
@@ -162,20 +198,31 @@ namespace Elixir
             }
 
             m_Window->ShowFPSAndFrameTime(m_Profiler.GetFPS(), frameTime);
+            MemoryTracker::Update(frameTime);
 
             m_StatsAccumulator += frameTime.GetSeconds();
             if (m_StatsText && m_StatsAccumulator >= 0.25f)
             {
                 m_StatsAccumulator = 0.0f;
-                m_StatsText->SetText(
-                    std::format("FPS: {}  |  {:.2f} ms", m_Profiler.GetFPS(), frameTime.GetMilliseconds())
-                );
+                const auto textures = TextureLoader::GetCache()->GetStats();
+                m_StatsText->SetText(std::format(
+                    "FPS: {}  |  {:.2f} ms  |  Textures: {:.1f} MiB  |  {}",
+                    m_Profiler.GetFPS(),
+                    frameTime.GetMilliseconds(),
+                    (float)textures.ResidentBytes / (1024.0f * 1024.0f),
+                    FormatMemoryStats()
+                ));
             }
 
+            FontManager::Update();
+            TextureLoader::Update();
             OnGUI(frameTime);
             m_GUIManager->ArrangeLayout(m_Window->GetWindowExtent()); // TODO: Remove from here and handle only when resizing
             m_GUIManager->Update(frameTime);
 
+            // Deadline of the frame tasks, rendering uses their results
+            m_Executor.WaitForFrameTasks();
+
             m_GraphicsContext->RenderFrame([this, frameTime]()
             {
                 OnRender(frameTime);
@@ -0,0 +1,388 @@
+#include "epch.h"
+#include "CachedMalloc.h"
+
+#include <Engine/Core/Memory.h>
+
+namespace Elixir
+{
+    namespace
+    {
+        constexpr uint32_t LARGE_SIZE_CLASS = CachedMalloc::SIZE_CLASS_COUNT;
+        constexpr size_t SIZE_CLASS_GRANULARITY = 16;
+
+        struct SSpanHeader
+        {
+            uint32_t SizeClass;
+
+            // Large spans only: the bytes reserved, and the offset of the allocation
+            size_t Size;
+            size_t Offset;
+        };
+
+        static_assert(sizeof(SSpanHeader) <= CachedMalloc::SPAN_HEADER_SIZE);
+
+        // Smallest size class of each multiple of the granularity
+        constexpr auto SIZE_CLASS_LOOKUP = []
+        {
+            std::array<uint8_t, CachedMalloc::MAX_SMALL_SIZE / SIZE_CLASS_GRANULARITY + 1> lookup = {};
+
+            size_t sizeClass = 0;
+            for (size_t i = 0; i < lookup.size(); i++)
+            {
+                while (CachedMalloc::SIZE_CLASSES[sizeClass] < i * SIZE_CLASS_GRANULARITY)
+                    sizeClass++;
+
+                lookup[i] = (uint8_t)sizeClass;
+            }
+
+            return lookup;
+        }();
+
+        /**
+         * Get the smallest size class fitting the size, with blocks aligned to the alignment.
+         * @return The size class, or LARGE_SIZE_CLASS if the size is not small.
+         */
+        uint32_t GetSizeClass(const size_t size, const uint32_t alignment)
+        {
+            if (size > CachedMalloc::MAX_SMALL_SIZE || alignment > CachedMalloc::SPAN_HEADER_SIZE)
+                return LARGE_SIZE_CLASS;
+
+            uint32_t sizeClass = SIZE_CLASS_LOOKUP[(size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY];
+
+            // Blocks are aligned to their size, from the aligned end of the span header
+            while (CachedMalloc::SIZE_CLASSES[sizeClass] % alignment != 0)
+                sizeClass++;
+
+            return sizeClass;
+        }
+
+        SSpanHeader* GetSpan(const Byte* ptr)
+        {
+            return (SSpanHeader*)((uintptr_t)ptr & ~(uintptr_t)(CachedMalloc::SPAN_SIZE - 1));
+        }
+
+        Byte* ReserveSpans(const size_t size)
+        {
+#if defined(_MSC_VER)
+            return (Byte*)_aligned_malloc(size, CachedMalloc::SPAN_SIZE);
+#else
+            return (Byte*)aligned_alloc(CachedMalloc::SPAN_SIZE, size);
+#endif
+        }
+
+        void ReleaseSpans(Byte* spans)
+        {
+#if defined(_MSC_VER)
+            _aligned_free(spans);
+#else
+            free(spans);
+#endif
+        }
+
+        // Allocators alive, so that an exiting thread only flushes its caches into those
+        struct SRegistry
+        {
+            std::mutex Mutex;
+            std::unordered_map<uint64_t, CachedMalloc*> Mallocs;
+            uint64_t NextId = 1;
+        };
+
+        // Never destroyed: threads flush their caches when they exit, which may happen
+        // during static destruction
+        SRegistry& GetRegistry()
+        {
+            static auto* registry = new SRegistry();
+            return *registry;
+        }
+    }
+
+    struct CachedMalloc::SFreeBlock
+    {
+        SFreeBlock* Next;
+    };
+
+    struct CachedMalloc::SThreadCache
+    {
+        uint64_t MallocId;
+        std::array<SFreeBlock*, SIZE_CLASS_COUNT> Heads = {};
+        std::array<uint32_t, SIZE_CLASS_COUNT> Counts = {};
+
+        explicit SThreadCache(const uint64_t mallocId) : MallocId(mallocId) {}
+
+        ~SThreadCache()
+        {
+            auto& registry = GetRegistry();
+            std::lock_guard lock(registry.Mutex);
+
+            const auto it = registry.Mallocs.find(MallocId);
+            if (it == registry.Mallocs.end()) return;
+
+            for (size_t i = 0; i < SIZE_CLASS_COUNT; i++)
+            {
+                if (Heads[i])
+                    it->second->PushBatch(i, Heads[i], Counts[i]);
+            }
+        }
+    };
+
+    thread_local std::vector<Scope<CachedMalloc::SThreadCache>> CachedMalloc::s_ThreadCaches;
+    thread_local CachedMalloc::SThreadCache* CachedMalloc::s_LastThreadCache = nullptr;
+
+    CachedMalloc::CachedMalloc()
+    {
+        auto& registry = GetRegistry();
+        std::lock_guard lock(registry.Mutex);
+
+        m_Id = registry.NextId++;
+        registry.Mallocs[m_Id] = this;
+    }
+
+    CachedMalloc::~CachedMalloc()
+    {
+        {
+            auto& registry = GetRegistry();
+            std::lock_guard lock(registry.Mutex);
+            registry.Mallocs.erase(m_Id);
+        }
+
+        // Thread caches still pointing to the spans are never used again
+        for (const auto chunk : m_Chunks)
+            ReleaseSpans(chunk);
+    }
+
+    std::tuple<Byte*, size_t> CachedMalloc::Alloc(const size_t size, const uint32_t alignment)
+    {
+        const uint32_t memoryAlignment = GetAlignment(size, alignment);
+        const size_t alignedSize = AlignSize(size, memoryAlignment);
+
+        const auto sizeClass = GetSizeClass(alignedSize, memoryAlignment);
+        const auto ptr = sizeClass == LARGE_SIZE_CLASS
+            ? AllocLarge(alignedSize, memoryAlignment)
+            : AllocSmall(sizeClass);
+
+        EE_CORE_ASSERT(ptr != nullptr, "Memory allocation failed!")
+
+        return { ptr, alignedSize };
+    }
+
+    std::tuple<Byte*, size_t> CachedMalloc::Realloc(
+        Byte* ptr,
+        const size_t newSize,
+        const uint32_t alignment
+    )
+    {
+        if (newSize <= 0)
+        {
+            Free(ptr);
+            return { nullptr, 0 };
+        }
+
+        if (!ptr)
+        {
+            return Alloc(newSize, alignment);
+        }
+
+        const uint32_t memoryAlignment = GetAlignment(newSize, alignment);
+        const size_t alignedSize = AlignSize(newSize, memoryAlignment);
+
+        const auto span = GetSpan(ptr);
+        const bool aligned = (uintptr_t)ptr % memoryAlignment == 0;
+
+        size_t capacity;
+        if (span->SizeClass == LARGE_SIZE_CLASS)
+        {
+            capacity = span->Size - span->Offset;
+            if (aligned && alignedSize <= capacity)
+                return { ptr, alignedSize };
+        }
+        else
+        {
+            capacity = SIZE_CLASSES[span->SizeClass];
+            if (aligned && GetSizeClass(alignedSize, memoryAlignment) == span->SizeClass)
+                return { ptr, alignedSize };
+        }
+
+        auto [newPtr, allocatedSize] = Alloc(newSize, alignment);
+        Memory::Memcpy(newPtr, ptr, std::min(allocatedSize, capacity));
+        Free(ptr);
+
+        return { newPtr, allocatedSize };
+    }
+
+    void CachedMalloc::Free(Byte* ptr)
+    {
+        if (!ptr) return;
+
+        const auto span = GetSpan(ptr);
+        if (span->SizeClass == LARGE_SIZE_CLASS)
+            FreeLarge((Byte*)span);
+        else
+            FreeSmall(ptr, span->SizeClass);
+    }
+
+    CachedMalloc::SThreadCache& CachedMalloc::GetThreadCache()
+    {
+        if (s_LastThreadCache && s_LastThreadCache->MallocId == m_Id)
+            return *s_LastThreadCache;
+
+        const auto it = std::ranges::find(s_ThreadCaches, m_Id, [](const auto& cache) { return cache->MallocId; });
+        if (it != s_ThreadCaches.end())
+        {
+            s_LastThreadCache = it->get();
+        }
+        else
+        {
+            s_ThreadCaches.push_back(CreateScope<SThreadCache>(m_Id));
+            s_LastThreadCache = s_ThreadCaches.back().get();
+        }
+
+        return *s_LastThreadCache;
+    }
+
+    Byte* CachedMalloc::AllocSmall(const size_t sizeClass)
+    {
+        auto& cache = GetThreadCache();
+        auto& head = cache.Heads[sizeClass];
+        auto& count = cache.Counts[sizeClass];
+
+        if (!head)
+        {
+            SBatch batch;
+            if (!PopBatch(sizeClass, batch))
+                batch = CarveSpan(sizeClass);
+
+            head = batch.Head;
+            count = batch.Count;
+        }
+
+        const auto block = head;
+        head = block->Next;
+        count--;
+        return (Byte*)block;
+    }
+
+    void CachedMalloc::FreeSmall(Byte* ptr, const size_t sizeClass)
+    {
+        auto& cache = GetThreadCache();
+        auto& head = cache.Heads[sizeClass];
+        auto& count = cache.Counts[sizeClass];
+
+        const auto freed = (SFreeBlock*)ptr;
+        freed->Next = head;
+        head = freed;
+        count++;
+
+        // Keep a batch for this thread, give the one below it back to the other threads
+        if (count >= 2 * BATCH_SIZE)
+        {
+            auto last = head;
+            for (uint32_t i = 1; i < BATCH_SIZE; i++)
+                last = last->Next;
+
+            const auto batch = last->Next;
+            last->Next = nullptr;
+            count = BATCH_SIZE;
+
+            PushBatch(sizeClass, batch, BATCH_SIZE);
+        }
+    }
+
+    Byte* CachedMalloc::AllocLarge(const size_t size, const uint32_t alignment)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        EE_CORE_ASSERT(alignment < SPAN_SIZE, "Alignment must be smaller than the span size!")
+
+        const auto offset = AlignSize(SPAN_HEADER_SIZE, alignment);
+        const auto spanSize = AlignSize(offset + size, SPAN_SIZE);
+
+        const auto span = ReserveSpans(spanSize);
+        if (!span) return nullptr;
+
+        new (span) SSpanHeader{ LARGE_SIZE_CLASS, spanSize, offset };
+        m_ReservedSize.fetch_add(spanSize, std::memory_order_relaxed);
+
+        return span + offset;
+    }
+
+    void CachedMalloc::FreeLarge(Byte* span)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        m_ReservedSize.fetch_sub(((SSpanHeader*)span)->Size, std::memory_order_relaxed);
+        ReleaseSpans(span);
+    }
+
+    void CachedMalloc::PushBatch(const size_t sizeClass, SFreeBlock* head, const uint32_t count)
+    {
+        auto& list = m_Central[sizeClass];
+        std::lock_guard lock(list.Mutex);
+        list.Batches.push_back({ head, count });
+    }
+
+    bool CachedMalloc::PopBatch(const size_t sizeClass, SBatch& batch)
+    {
+        auto& list = m_Central[sizeClass];
+        std::lock_guard lock(list.Mutex);
+
+        if (list.Batches.empty()) return false;
+
+        batch = list.Batches.back();
+        list.Batches.pop_back();
+        return true;
+    }
+
+    CachedMalloc::SBatch CachedMalloc::CarveSpan(const size_t sizeClass)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        Byte* span;
+        {
+            std::lock_guard lock(m_ChunksMutex);
+            if (m_SpansLeft == 0)
+            {
+                m_NextSpan = ReserveSpans(SPANS_PER_CHUNK * SPAN_SIZE);
+                EE_CORE_ASSERT(m_NextSpan != nullptr, "Memory allocation failed!")
+
+                m_Chunks.push_back(m_NextSpan);
+                m_SpansLeft = SPANS_PER_CHUNK;
+                m_ReservedSize.fetch_add(SPANS_PER_CHUNK * SPAN_SIZE, std::memory_order_relaxed);
+            }
+
+            span = m_NextSpan;
+            m_NextSpan += SPAN_SIZE;
+            m_SpansLeft--;
+        }
+
+        new (span) SSpanHeader{ (uint32_t)sizeClass, SPAN_SIZE, SPAN_HEADER_SIZE };
+
+        // Link the blocks in address order, then cut the list into batches
+        const size_t blockSize = SIZE_CLASSES[sizeClass];
+        const auto blockCount = (uint32_t)((SPAN_SIZE - SPAN_HEADER_SIZE) / blockSize);
+
+        const auto blockAt = [span, blockSize](const uint32_t i)
+        {
+            return (SFreeBlock*)(span + SPAN_HEADER_SIZE + i * blockSize);
+        };
+
+        std::vector<SBatch> batches;
+        for (uint32_t start = 0; start < blockCount; start += BATCH_SIZE)
+        {
+            const auto end = std::min(blockCount, start + BATCH_SIZE);
+            for (uint32_t i = start; i < end - 1; i++)
+                blockAt(i)->Next = blockAt(i + 1);
+
+            blockAt(end - 1)->Next = nullptr;
+            batches.push_back({ blockAt(start), end - start });
+        }
+
+        // The first blocks are the most likely to be in cache, keep them
+        const auto first = batches.front();
+        {
+            auto& list = m_Central[sizeClass];
+            std::lock_guard lock(list.Mutex);
+            list.Batches.insert(list.Batches.end(), batches.rbegin(), batches.rend() - 1);
+        }
+
+        return first;
+    }
+}
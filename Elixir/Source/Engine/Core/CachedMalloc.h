@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Engine/Core/Malloc.h>
+
+namespace Elixir
+{
+    /**
+     * Small-object allocator with a cache per thread, in the style of mimalloc and rpmalloc.
+     *
+     * Small allocations are rounded up to a size class and served from the calling thread's
+     * free list of that class, without locking. Blocks come from spans: SPAN_SIZE aligned
+     * slabs of blocks of one class, with a header at their start, so freeing a block finds
+     * its class by masking its address. Threads exchange blocks with a central heap in
+     * batches: a thread out of blocks takes a batch, or carves a new span, and a thread
+     * holding too many freed blocks gives a batch back. A block freed by another thread
+     * than the one that allocated it simply moves to the freeing thread's cache.
+     *
+     * Allocations larger than MAX_SMALL_SIZE, or aligned to more than SPAN_HEADER_SIZE, get
+     * a span of their own from the system and are returned to it when freed. Spans of small
+     * blocks are kept until the allocator is destroyed.
+     */
+    class ELIXIR_API CachedMalloc final : public Malloc
+    {
+      public:
+        static constexpr size_t SPAN_SIZE = 64 * 1024;
+
+        // Blocks start after the header, so they can be aligned up to its size
+        static constexpr size_t SPAN_HEADER_SIZE = 256;
+
+        // Four classes per power of two, so at most 25% of a block is wasted above 128 bytes
+        static constexpr uint32_t SIZE_CLASSES[] = {
+            16, 32, 48, 64, 80, 96, 112, 128,
+            160, 192, 224, 256, 320, 384, 448, 512,
+            640, 768, 896, 1024, 1280, 1536, 1792, 2048
+        };
+        static constexpr size_t SIZE_CLASS_COUNT = std::size(SIZE_CLASSES);
+        static constexpr size_t MAX_SMALL_SIZE = SIZE_CLASSES[SIZE_CLASS_COUNT - 1];
+
+        // Blocks moved at once between a thread cache and the central heap
+        static constexpr uint32_t BATCH_SIZE = 32;
+
+        // Spans of small blocks reserved from the system at once
+        static constexpr size_t SPANS_PER_CHUNK = 16;
+
+        CachedMalloc();
+        ~CachedMalloc() override;
+
+        CachedMalloc(const CachedMalloc&) = delete;
+        CachedMalloc& operator=(const CachedMalloc&) = delete;
+
+        std::tuple<Byte*, size_t> Alloc(size_t size, uint32_t alignment = 0) override;
+        std::tuple<Byte*, size_t> Realloc(Byte* ptr, size_t newSize, uint32_t alignment = 0) override;
+        void Free(Byte* ptr) override;
+
+        /**
+         * Get the bytes reserved from the system, by the spans of small blocks and the
+         * large allocations still alive.
+         */
+        size_t GetReservedSize() const { return m_ReservedSize.load(std::memory_order_relaxed); }
+
+      private:
+        struct SFreeBlock;
+        struct SThreadCache;
+
+        struct SBatch
+        {
+            SFreeBlock* Head;
+            uint32_t Count;
+        };
+
+        struct SCentralList
+        {
+            std::mutex Mutex;
+            std::vector<SBatch> Batches;
+        };
+
+        SThreadCache& GetThreadCache();
+
+        Byte* AllocSmall(size_t sizeClass);
+        void FreeSmall(Byte* ptr, size_t sizeClass);
+        Byte* AllocLarge(size_t size, uint32_t alignment);
+        void FreeLarge(Byte* span);
+
+        void PushBatch(size_t sizeClass, SFreeBlock* head, uint32_t count);
+        bool PopBatch(size_t sizeClass, SBatch& batch);
+
+        /**
+         * Carve a new span into batches of blocks for the central heap.
+         * @return One of the batches, for the calling thread.
+         */
+        SBatch CarveSpan(size_t sizeClass);
+
+        // Unique over the process lifetime, to tell the caches of a destroyed allocator apart
+        uint64_t m_Id;
+
+        std::array<SCentralList, SIZE_CLASS_COUNT> m_Central;
+
+        // Chunks of spans reserved from the system, and the spans not carved yet
+        std::mutex m_ChunksMutex;
+        std::vector<Byte*> m_Chunks;
+        Byte* m_NextSpan = nullptr;
+        size_t m_SpansLeft = 0;
+
+        std::atomic<size_t> m_ReservedSize = 0;
+
+        // Caches of the calling thread, one per allocator it used, flushed on thread exit
+        static thread_local std::vector<Scope<SThreadCache>> s_ThreadCaches;
+        static thread_local SThreadCache* s_LastThreadCache;
+    };
+}
@@ -153,6 +153,24 @@ namespace Elixir
             return seed;
         }
 
+        /**
+         * 64-bit FNV-1a over raw bytes. Unlike std::hash the result is stable across runs and
+         * standard libraries, so it can key data persisted to disk.
+         * @param data the bytes to hash.
+         * @param seed the hash to continue from, to chain several buffers.
+         * @return the hash.
+         */
+        inline uint64_t HashBytes(const void* data, const size_t size, uint64_t seed = 0xcbf29ce484222325ULL)
+        {
+            const auto bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++)
+            {
+                seed ^= bytes[i];
+                seed *= 0x100000001b3ULL;
+            }
+            return seed;
+        }
+
         template <typename... T>
         std::size_t HashValues(const std::tuple<T...>& values)
         {
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <Engine/Core/Executor/ThreadPool.h>
+
+#include <coroutine>
+#include <exception>
+
+namespace Elixir
+{
+    template <typename T>
+    class Async;
+
+    namespace Detail
+    {
+        /**
+         * State shared by the promises of every @ref Async: what to resume once the
+         * coroutine returns, and the completion of a coroutine started by Async::Start.
+         */
+        struct SAsyncPromiseBase
+        {
+            struct SFinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template <typename P>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) const noexcept
+                {
+                    auto& promise = handle.promise();
+                    if (promise.Continuation)
+                        return promise.Continuation;
+
+                    promise.Finish();
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            SFinalAwaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() { Exception = std::current_exception(); }
+
+            void Rethrow() const
+            {
+                if (Exception)
+                    std::rethrow_exception(Exception);
+            }
+
+            void Start() { Completion.Add(1); }
+
+            // The frame may be destroyed as soon as the completion is done
+            void Finish() { Completion.Done(); }
+
+            std::coroutine_handle<> Continuation;
+            WaitGroup Completion;
+            std::exception_ptr Exception;
+        };
+
+        template <typename T>
+        struct SAsyncPromise : SAsyncPromiseBase
+        {
+            Async<T> get_return_object()
+            {
+                return Async<T>(std::coroutine_handle<SAsyncPromise>::from_promise(*this));
+            }
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                Value.emplace(std::forward<U>(value));
+            }
+
+            T TakeResult()
+            {
+                Rethrow();
+                return std::move(*Value);
+            }
+
+            std::optional<T> Value;
+        };
+
+        template <>
+        struct SAsyncPromise<void> : SAsyncPromiseBase
+        {
+            Async<void> get_return_object();
+
+            void return_void() const {}
+
+            void TakeResult() const { Rethrow(); }
+        };
+    }
+
+    /**
+     * Coroutine returning a T, for pipelines that hop between threads without blocking any:
+     *
+     *     Async<Ref<System>> LoadEffect(std::filesystem::path path)
+     *     {
+     *         auto data = co_await LoadFileAsync(path);    // Read on an IO thread
+     *         co_await Executor::Get().Schedule();         // Parse on a worker
+     *         co_return Parse(*data);
+     *     }
+     *
+     * The coroutine is lazy: it starts when awaited by another coroutine, which then resumes
+     * on the thread the coroutine returns from, or when @ref Start is called. Parameters are
+     * kept in the coroutine frame only when taken by value.
+     *
+     * Exceptions thrown by the coroutine are rethrown to whoever takes the result.
+     */
+    template <typename T = void>
+    class [[nodiscard]] Async
+    {
+        friend struct Detail::SAsyncPromise<T>;
+      public:
+        using promise_type = Detail::SAsyncPromise<T>;
+
+        Async() = default;
+
+        Async(Async&& other) noexcept
+            : m_Handle(std::exchange(other.m_Handle, {})), m_Started(std::exchange(other.m_Started, false)) {}
+
+        Async& operator=(Async&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                m_Handle = std::exchange(other.m_Handle, {});
+                m_Started = std::exchange(other.m_Started, false);
+            }
+
+            return *this;
+        }
+
+        Async(const Async&) = delete;
+        Async& operator=(const Async&) = delete;
+
+        /**
+         * Wait for the coroutine if it was started, then destroy it.
+         */
+        ~Async() { Reset(); }
+
+        bool IsValid() const { return m_Handle != nullptr; }
+
+        /**
+         * Run the coroutine on the calling thread until it first suspends, e.g. to hop to
+         * another thread.
+         */
+        void Start()
+        {
+            EE_CORE_ASSERT(m_Handle && !m_Started, "Async is not valid or already started!")
+
+            m_Started = true;
+            m_Handle.promise().Start();
+            m_Handle.resume();
+        }
+
+        /**
+         * Check whether a started coroutine has returned.
+         */
+        bool IsReady() const
+        {
+            return m_Started && m_Handle.promise().Completion.GetCount() == 0;
+        }
+
+        /**
+         * Block until a started coroutine has returned, worker threads keep running tasks
+         * meanwhile, see @ref WaitGroup::Wait.
+         */
+        void Wait()
+        {
+            EE_CORE_ASSERT(m_Started, "Async is not started!")
+            m_Handle.promise().Completion.Wait();
+        }
+
+        /**
+         * Start the coroutine if needed and block until it has returned. The result is
+         * moved out, so it can only be taken once.
+         * @return The value returned by the coroutine.
+         */
+        T Get()
+        {
+            if (!m_Started)
+                Start();
+
+            Wait();
+            return m_Handle.promise().TakeResult();
+        }
+
+        /**
+         * Start the coroutine from another coroutine, which is suspended until it returns.
+         */
+        auto operator co_await() && noexcept
+        {
+            struct SAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) const noexcept
+                {
+                    Handle.promise().Continuation = awaiting;
+                    return Handle;
+                }
+
+                T await_resume() const { return Handle.promise().TakeResult(); }
+
+                std::coroutine_handle<promise_type> Handle;
+            };
+
+            EE_CORE_ASSERT(m_Handle && !m_Started, "Async is not valid or already started!")
+            return SAwaiter{ m_Handle };
+        }
+
+      private:
+        explicit Async(const std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+
+        void Reset()
+        {
+            if (!m_Handle) return;
+
+            if (m_Started)
+                Wait();
+
+            m_Handle.destroy();
+            m_Handle = {};
+            m_Started = false;
+        }
+
+        std::coroutine_handle<promise_type> m_Handle;
+        bool m_Started = false;
+    };
+
+    inline Async<void> Detail::SAsyncPromise<void>::get_return_object()
+    {
+        return Async<void>(std::coroutine_handle<SAsyncPromise>::from_promise(*this));
+    }
+
+    /**
+     * Awaitable suspending a coroutine and resuming it on a task of the pool.
+     */
+    struct SScheduleAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(const std::coroutine_handle<> handle) const
+        {
+            Pool->Enqueue(Priority, [handle] { handle.resume(); });
+        }
+
+        void await_resume() const noexcept {}
+
+        ThreadPool* Pool;
+        ETaskPriority Priority;
+    };
+
+    /**
+     * Continue the awaiting coroutine on the pool.
+     * @param pool The pool to continue on.
+     * @param priority The priority of the rest of the coroutine, up to its next hop.
+     */
+    inline SScheduleAwaiter Schedule(ThreadPool& pool, const ETaskPriority priority = ETaskPriority::Normal)
+    {
+        return { &pool, priority };
+    }
+}
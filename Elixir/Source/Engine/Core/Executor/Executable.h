@@ -1,6 +1,24 @@
 #pragma once
 
+#include <Engine/Core/Executor/Task.h>
+
 namespace Elixir
 {
-    using Executable = std::function<void()>;
-}
\ No newline at end of file
+    using Executable = Task;
+
+    /**
+     * Scheduling class of a task. Workers always take the most urgent task available, so a
+     * task of a lower class only delays the others until it returns.
+     */
+    enum class ETaskPriority : uint8_t
+    {
+        // Work the current frame waits for, e.g. particle or GUI preparation
+        FrameCritical = 0,
+        Normal,
+
+        // Long work off the frame, e.g. asset decoding and streaming
+        Background,
+    };
+
+    constexpr size_t TASK_PRIORITY_COUNT = 3;
+}
@@ -1,12 +1,15 @@
 #pragma once
 
-#include <Engine/Core/Executor/ThreadPool.h>
+#include <Engine/Core/Executor/Async.h>
 
 namespace Elixir
 {
     enum class EThreadName : uint8_t
     {
-        Rendering, Worker
+        Rendering, Worker,
+
+        // Blocking reads and writes, so they never hold a worker
+        IO
     };
 
     /**
@@ -20,6 +23,9 @@ namespace Elixir
     class ELIXIR_API Executor
     {
       public:
+        // The IO threads mostly wait on the disk, they don't count against the cores
+        static constexpr size_t IO_THREADS = 2;
+
         Executor(const Executor&) = delete;
 
         ~Executor()
@@ -36,19 +42,72 @@ namespace Elixir
         template <typename F, typename... Args>
         void Enqueue(F&& func, Args&&... args, WaitGroup* wg = nullptr)
         {
-            Enqueue(EThreadName::Worker, std::forward<F>(func), std::forward<Args>(args)..., wg);
+            Enqueue<F, Args...>(EThreadName::Worker, std::forward<F>(func), std::forward<Args>(args)..., wg);
         }
 
         template <typename F, typename... Args>
         void Enqueue(const EThreadName thread, F&& func, Args&&... args, WaitGroup* wg = nullptr)
         {
-            if (thread == EThreadName::Rendering)
+            GetPool(thread).Enqueue<F, Args...>(std::forward<F>(func), std::forward<Args>(args)..., wg);
+        }
+
+        template <typename F, typename... Args>
+        void Enqueue(const ETaskPriority priority, F&& func, Args&&... args, WaitGroup* wg = nullptr)
+        {
+            m_WorkerPool->Enqueue<F, Args...>(priority, std::forward<F>(func), std::forward<Args>(args)..., wg);
+        }
+
+        /**
+         * Enqueue a frame critical task the current frame must wait for: it is done by the
+         * next call to @ref WaitForFrameTasks, at the frame deadline.
+         */
+        template <typename F, typename... Args>
+        void EnqueueForFrame(F&& func, Args&&... args)
+        {
+            m_WorkerPool->Enqueue<F, Args...>(
+                ETaskPriority::FrameCritical,
+                std::forward<F>(func),
+                std::forward<Args>(args)...,
+                &m_FrameWaitGroup
+            );
+        }
+
+        /**
+         * Wait for the tasks enqueued with @ref EnqueueForFrame. Called by the application
+         * once per frame, before rendering.
+         */
+        void WaitForFrameTasks()
+        {
+            EE_PROFILE_ZONE_SCOPED()
+            m_FrameWaitGroup.Wait();
+        }
+
+        /**
+         * Continue the awaiting coroutine on a thread of the pool, e.g.
+         * `co_await Executor::Get().Schedule(EThreadName::IO)`.
+         * @param thread The pool to continue on.
+         * @param priority The priority of the rest of the coroutine, up to its next hop.
+         */
+        SScheduleAwaiter Schedule(
+            const EThreadName thread = EThreadName::Worker,
+            const ETaskPriority priority = ETaskPriority::Normal
+        ) const
+        {
+            return Elixir::Schedule(GetPool(thread), priority);
+        }
+
+        ThreadPool& GetWorkerPool() const { return *m_WorkerPool; }
+        ThreadPool& GetRenderPool() const { return *m_RenderPool; }
+        ThreadPool& GetIOPool() const { return *m_IOPool; }
+
+        ThreadPool& GetPool(const EThreadName thread) const
+        {
+            switch (thread)
             {
-                m_RenderPool->Enqueue(func, args..., wg);
-                return;
+                case EThreadName::Rendering: return *m_RenderPool;
+                case EThreadName::IO: return *m_IOPool;
+                default: return *m_WorkerPool;
             }
-
-            m_WorkerPool->Enqueue(func, args..., wg);
         }
 
         void ShutdownRenderPool()
@@ -60,6 +119,15 @@ namespace Elixir
             }
         }
 
+        void ShutdownIOPool()
+        {
+            if (m_IOPool)
+            {
+                m_IOPool->Shutdown();
+                m_IOPool.reset();
+            }
+        }
+
         void ShutdownWorkerPool()
         {
             if (m_WorkerPool)
@@ -72,6 +140,7 @@ namespace Elixir
         void Shutdown()
         {
             ShutdownRenderPool();
+            ShutdownIOPool();
             ShutdownWorkerPool();
         }
 
@@ -83,11 +152,16 @@ namespace Elixir
             m_RenderPool = CreateScope<ThreadPool>(1, "Rendering");
 
             // Max hardware threads subtracted by 1 render thread and 1 main thread.
-            const auto workers = GetNumHardwareThreads() - 2;
+            const auto workers = std::max(GetNumHardwareThreads(), 3u) - 2;
             m_WorkerPool = CreateScope<ThreadPool>(workers, "Workers");
+
+            m_IOPool = CreateScope<ThreadPool>(IO_THREADS, "IO");
         }
 
         Scope<ThreadPool> m_RenderPool;
         Scope<ThreadPool> m_WorkerPool;
+        Scope<ThreadPool> m_IOPool;
+
+        WaitGroup m_FrameWaitGroup;
     };
 }
\ No newline at end of file
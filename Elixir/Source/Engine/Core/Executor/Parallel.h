@@ -0,0 +1,163 @@
+#pragma once
+
+#include <Engine/Core/Executor/Executor.h>
+
+namespace Elixir
+{
+    namespace Detail
+    {
+        /**
+         * Chunks of a parallel loop, claimed one at a time by the caller and by helper tasks.
+         * Helpers that start after the loop finished find no chunk left and return, so the
+         * caller only waits for chunks already being run and never for a queued task.
+         */
+        template <typename F>
+        struct SParallelLoop
+        {
+            SParallelLoop(const size_t begin, const size_t end, const size_t grain, F&& body)
+                : Begin(begin), End(end), Grain(grain), Chunks((end - begin + grain - 1) / grain),
+                  Body(std::forward<F>(body)) {}
+
+            // Run chunks until none is left, returns whether this call ran any
+            bool Run()
+            {
+                bool ran = false;
+                for (auto chunk = Next.fetch_add(1); chunk < Chunks; chunk = Next.fetch_add(1))
+                {
+                    const auto begin = Begin + chunk * Grain;
+                    Body(chunk, begin, std::min(begin + Grain, End));
+                    ran = true;
+
+                    if (Done.fetch_add(1, std::memory_order_acq_rel) + 1 == Chunks)
+                        Done.notify_all();
+                }
+
+                return ran;
+            }
+
+            void Wait()
+            {
+                for (auto done = Done.load(std::memory_order_acquire); done < Chunks; done = Done.load(std::memory_order_acquire))
+                    Done.wait(done, std::memory_order_acquire);
+            }
+
+            size_t Begin, End, Grain, Chunks;
+            std::decay_t<F> Body;
+            std::atomic<size_t> Next = 0;
+            std::atomic<size_t> Done = 0;
+        };
+
+        // Helpers run at the priority of the task calling the loop
+        inline ETaskPriority GetCallerPriority()
+        {
+            const auto worker = Thread::GetCurrent();
+            return worker ? worker->GetPriority() : ETaskPriority::Normal;
+        }
+
+        inline size_t GetGrain(const ThreadPool& pool, const size_t count, const size_t grain)
+        {
+            if (grain > 0) return grain;
+
+            // A few chunks per worker, so that workers finishing early can take more
+            const auto chunks = (pool.GetWorkerCount() + 1) * 4;
+            return std::max<size_t>(1, (count + chunks - 1) / chunks);
+        }
+
+        /**
+         * Run body(chunk, begin, end) over [begin, end) split in chunks of grain indices.
+         */
+        template <typename F>
+        void RunChunks(ThreadPool& pool, const size_t begin, const size_t end, const size_t grain, F&& body)
+        {
+            EE_PROFILE_ZONE_SCOPED()
+
+            if (begin >= end) return;
+
+            // A single chunk is not worth a task
+            if (end - begin <= grain)
+            {
+                body(0, begin, end);
+                return;
+            }
+
+            const auto loop = CreateRef<SParallelLoop<F>>(begin, end, grain, std::forward<F>(body));
+
+            const auto priority = GetCallerPriority();
+            const auto helpers = std::min<size_t>(loop->Chunks - 1, pool.GetWorkerCount());
+            for (size_t i = 0; i < helpers; i++)
+                pool.Enqueue(priority, [loop] { loop->Run(); });
+
+            loop->Run();
+            loop->Wait();
+        }
+    }
+
+    /**
+     * Call fn(i) for every index of [begin, end) on the worker pool and the calling thread,
+     * and return once all the calls are done.
+     * @param grain The number of indices per task, or 0 to split the range in a few
+     * chunks per worker.
+     */
+    template <typename F>
+    void ParallelFor(ThreadPool& pool, const size_t begin, const size_t end, const size_t grain, F&& fn)
+    {
+        if (begin >= end) return;
+
+        Detail::RunChunks(pool, begin, end, Detail::GetGrain(pool, end - begin, grain), [&fn](size_t, const size_t first, const size_t last)
+        {
+            for (auto i = first; i < last; i++)
+                fn(i);
+        });
+    }
+
+    template <typename F>
+    void ParallelFor(const size_t begin, const size_t end, const size_t grain, F&& fn)
+    {
+        ParallelFor(Executor::Get().GetWorkerPool(), begin, end, grain, std::forward<F>(fn));
+    }
+
+    /**
+     * Map every index of [begin, end) to a value and combine them. Each chunk is reduced
+     * on its own and the chunk results are then combined in order, so the result does not
+     * depend on the scheduling as long as combine is associative.
+     * @param identity The value combined with nothing, e.g. 0 for a sum.
+     * @param map Returns the value of an index: T map(size_t).
+     * @param combine Combines two values: T combine(T, T).
+     */
+    template <typename T, typename M, typename C>
+    T ParallelReduce(ThreadPool& pool, const size_t begin, const size_t end, const size_t grain, T identity, M&& map, C&& combine)
+    {
+        if (begin >= end) return identity;
+
+        const auto chunkGrain = Detail::GetGrain(pool, end - begin, grain);
+        std::vector<T> partials((end - begin + chunkGrain - 1) / chunkGrain, identity);
+
+        Detail::RunChunks(pool, begin, end, chunkGrain, [&](const size_t chunk, const size_t first, const size_t last)
+        {
+            auto value = identity;
+            for (auto i = first; i < last; i++)
+                value = combine(std::move(value), map(i));
+
+            partials[chunk] = std::move(value);
+        });
+
+        for (auto& partial : partials)
+            identity = combine(std::move(identity), std::move(partial));
+
+        return identity;
+    }
+
+    template <typename T, typename M, typename C>
+    T ParallelReduce(const size_t begin, const size_t end, const size_t grain, T identity, M&& map, C&& combine)
+    {
+        return ParallelReduce(
+            Executor::Get().GetWorkerPool(),
+            begin,
+            end,
+            grain,
+            std::move(identity),
+            std::forward<M>(map),
+            std::forward<C>(combine)
+        );
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <Engine/Core/Executor/TaskArena.h>
+
+#include <cstring>
+
+namespace Elixir
+{
+    /**
+     * Move-only callable run by the executor. Callables up to @ref INLINE_SIZE bytes are
+     * stored inline, larger ones in a block of the @ref TaskArena, so neither creating
+     * nor moving a task goes through the system allocator.
+     */
+    class Task final
+    {
+      public:
+        static constexpr size_t INLINE_SIZE = 64;
+
+        Task() = default;
+
+        template <typename F>
+            requires (!std::is_same_v<std::decay_t<F>, Task> && std::is_invocable_v<std::decay_t<F>&>)
+        Task(F&& func)
+        {
+            using Callable = std::decay_t<F>;
+
+            if constexpr (FitsInline<Callable>)
+            {
+                new (m_Storage) Callable(std::forward<F>(func));
+            }
+            else
+            {
+                const auto callable = TaskArena::New<Callable>(std::forward<F>(func));
+                std::memcpy(m_Storage, &callable, sizeof(callable));
+            }
+
+            m_VTable = &s_VTable<Callable>;
+        }
+
+        Task(Task&& other) noexcept
+        {
+            MoveFrom(other);
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(other);
+            }
+
+            return *this;
+        }
+
+        ~Task()
+        {
+            Reset();
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        void operator()()
+        {
+            EE_CORE_ASSERT(m_VTable, "Invoking an empty task!")
+            m_VTable->Invoke(m_Storage);
+        }
+
+        explicit operator bool() const { return m_VTable != nullptr; }
+
+        /**
+         * Check whether the callable is stored inside the task.
+         */
+        [[nodiscard]] bool IsInline() const { return m_VTable && m_VTable->Inline; }
+
+        void Reset()
+        {
+            if (m_VTable)
+            {
+                m_VTable->Destroy(m_Storage);
+                m_VTable = nullptr;
+            }
+        }
+
+      private:
+        struct SVTable
+        {
+            void (*Invoke)(std::byte* storage);
+            void (*Move)(std::byte* dst, std::byte* src);
+            void (*Destroy)(std::byte* storage);
+            bool Inline;
+        };
+
+        template <typename F>
+        static constexpr bool FitsInline = sizeof(F) <= INLINE_SIZE
+            && alignof(F) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<F>;
+
+        template <typename F>
+        static F* GetCallable(std::byte* storage)
+        {
+            if constexpr (FitsInline<F>)
+            {
+                return std::launder(reinterpret_cast<F*>(storage));
+            }
+            else
+            {
+                F* callable;
+                std::memcpy(&callable, storage, sizeof(callable));
+                return callable;
+            }
+        }
+
+        template <typename F>
+        static constexpr SVTable s_VTable = {
+            .Invoke = [](std::byte* storage) { (*GetCallable<F>(storage))(); },
+            .Move = [](std::byte* dst, std::byte* src)
+            {
+                // Out of line callables stay in their block, only the pointer moves
+                if constexpr (FitsInline<F>)
+                {
+                    const auto callable = GetCallable<F>(src);
+                    new (dst) F(std::move(*callable));
+                    callable->~F();
+                }
+                else
+                {
+                    std::memcpy(dst, src, sizeof(F*));
+                }
+            },
+            .Destroy = [](std::byte* storage)
+            {
+                if constexpr (FitsInline<F>)
+                    GetCallable<F>(storage)->~F();
+                else
+                    TaskArena::Delete(GetCallable<F>(storage));
+            },
+            .Inline = FitsInline<F>
+        };
+
+        void MoveFrom(Task& other)
+        {
+            if (other.m_VTable)
+            {
+                other.m_VTable->Move(m_Storage, other.m_Storage);
+                m_VTable = std::exchange(other.m_VTable, nullptr);
+            }
+        }
+
+        alignas(std::max_align_t) std::byte m_Storage[INLINE_SIZE];
+        const SVTable* m_VTable = nullptr;
+    };
+}
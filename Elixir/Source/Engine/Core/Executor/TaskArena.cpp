@@ -0,0 +1,150 @@
+#include "epch.h"
+#include "TaskArena.h"
+
+namespace Elixir
+{
+    namespace
+    {
+        constexpr size_t SIZE_CLASSES = std::size(TaskArena::BLOCK_SIZES);
+        constexpr size_t NO_SIZE_CLASS = SIZE_CLASSES;
+
+        struct SFreeBlock
+        {
+            SFreeBlock* Next;
+
+            // Set on the first block of a batch in the shared list
+            SFreeBlock* NextBatch;
+            uint32_t Count;
+        };
+
+        struct SSharedList
+        {
+            std::mutex Mutex;
+            SFreeBlock* Batches = nullptr;
+        };
+
+        // Never destroyed: worker threads flush their cache into it when they exit, which
+        // may happen during static destruction
+        SSharedList* GetSharedLists()
+        {
+            static auto* lists = new SSharedList[SIZE_CLASSES];
+            return lists;
+        }
+
+        std::atomic<size_t> s_SystemAllocations = 0;
+
+        size_t GetSizeClass(const size_t size)
+        {
+            for (size_t i = 0; i < SIZE_CLASSES; i++)
+            {
+                if (size <= TaskArena::BLOCK_SIZES[i])
+                    return i;
+            }
+
+            return NO_SIZE_CLASS;
+        }
+
+        void PushBatch(const size_t sizeClass, SFreeBlock* head, const uint32_t count)
+        {
+            head->Count = count;
+
+            auto& list = GetSharedLists()[sizeClass];
+            std::lock_guard lock(list.Mutex);
+            head->NextBatch = list.Batches;
+            list.Batches = head;
+        }
+
+        SFreeBlock* PopBatch(const size_t sizeClass)
+        {
+            auto& list = GetSharedLists()[sizeClass];
+            std::lock_guard lock(list.Mutex);
+
+            const auto head = list.Batches;
+            if (head) list.Batches = head->NextBatch;
+            return head;
+        }
+
+        struct SThreadCache
+        {
+            SFreeBlock* Heads[SIZE_CLASSES] = {};
+            uint32_t Counts[SIZE_CLASSES] = {};
+
+            ~SThreadCache()
+            {
+                for (size_t i = 0; i < SIZE_CLASSES; i++)
+                {
+                    if (Heads[i])
+                        PushBatch(i, Heads[i], Counts[i]);
+                }
+            }
+        };
+
+        thread_local SThreadCache s_Cache;
+    }
+
+    void* TaskArena::Allocate(const size_t size)
+    {
+        const auto sizeClass = GetSizeClass(size);
+        if (sizeClass == NO_SIZE_CLASS)
+            return ::operator new(size);
+
+        auto& head = s_Cache.Heads[sizeClass];
+        auto& count = s_Cache.Counts[sizeClass];
+
+        if (!head)
+        {
+            if (const auto batch = PopBatch(sizeClass))
+            {
+                head = batch;
+                count = batch->Count;
+            }
+            else
+            {
+                s_SystemAllocations.fetch_add(1, std::memory_order_relaxed);
+                return ::operator new(BLOCK_SIZES[sizeClass]);
+            }
+        }
+
+        const auto block = head;
+        head = block->Next;
+        count--;
+        return block;
+    }
+
+    void TaskArena::Free(void* block, const size_t size)
+    {
+        const auto sizeClass = GetSizeClass(size);
+        if (sizeClass == NO_SIZE_CLASS)
+        {
+            ::operator delete(block);
+            return;
+        }
+
+        auto& head = s_Cache.Heads[sizeClass];
+        auto& count = s_Cache.Counts[sizeClass];
+
+        const auto freed = static_cast<SFreeBlock*>(block);
+        freed->Next = head;
+        head = freed;
+        count++;
+
+        // Keep a batch for this thread, give the one below it back to the other threads
+        if (count >= 2 * BATCH_SIZE)
+        {
+            auto last = head;
+            for (uint32_t i = 1; i < BATCH_SIZE; i++)
+                last = last->Next;
+
+            const auto batch = last->Next;
+            last->Next = nullptr;
+            count = BATCH_SIZE;
+
+            PushBatch(sizeClass, batch, BATCH_SIZE);
+        }
+    }
+
+    size_t TaskArena::GetSystemAllocationCount()
+    {
+        return s_SystemAllocations.load(std::memory_order_relaxed);
+    }
+}
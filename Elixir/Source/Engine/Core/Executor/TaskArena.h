@@ -0,0 +1,46 @@
+#pragma once
+
+namespace Elixir
+{
+    /**
+     * Recycles the small blocks used by tasks, so that submitting tasks does not hit the
+     * system allocator once the pool is warm.
+     *
+     * Blocks come in a few size classes and are cached per thread. A task is usually
+     * freed on another thread than the one that allocated it, so each thread gives its
+     * excess blocks back to a shared list in batches, where threads running out of blocks
+     * take them from. Larger blocks go straight to the system allocator.
+     */
+    class ELIXIR_API TaskArena
+    {
+      public:
+        static constexpr size_t BLOCK_SIZES[] = { 128, 256, 512 };
+        static constexpr size_t MAX_BLOCK_SIZE = BLOCK_SIZES[std::size(BLOCK_SIZES) - 1];
+
+        // Blocks moved at once between a thread cache and the shared list
+        static constexpr uint32_t BATCH_SIZE = 64;
+
+        static void* Allocate(size_t size);
+        static void Free(void* block, size_t size);
+
+        template <typename T, typename... Args>
+        static T* New(Args&&... args)
+        {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported!");
+            return new (Allocate(sizeof(T))) T(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        static void Delete(T* object)
+        {
+            object->~T();
+            Free(object, sizeof(T));
+        }
+
+        /**
+         * Get the number of blocks requested from the system allocator so far, by all
+         * the threads.
+         */
+        static size_t GetSystemAllocationCount();
+    };
+}
@@ -0,0 +1,113 @@
+#include "epch.h"
+#include "TaskGraph.h"
+
+#include <Engine/Core/Executor/Executor.h>
+
+namespace Elixir
+{
+    TaskGraph::~TaskGraph()
+    {
+        // Tasks still queued reference the graph
+        Wait();
+    }
+
+    TaskGraph::NodeId TaskGraph::Add(Executable task)
+    {
+        EE_CORE_ASSERT(!IsRunning(), "Cannot add a task to a running graph!")
+
+        auto node = CreateScope<SNode>();
+        node->Task = std::move(task);
+        m_Nodes.push_back(std::move(node));
+        return (NodeId)(m_Nodes.size() - 1);
+    }
+
+    void TaskGraph::Precede(const NodeId before, const NodeId after)
+    {
+        EE_CORE_ASSERT(!IsRunning(), "Cannot change the dependencies of a running graph!")
+        EE_CORE_ASSERT(before < m_Nodes.size() && after < m_Nodes.size(), "Unknown task!")
+
+        m_Nodes[before]->Successors.push_back(after);
+        m_Nodes[after]->Dependencies++;
+    }
+
+    void TaskGraph::Run(ThreadPool& pool, const ETaskPriority priority)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        EE_CORE_ASSERT(!IsRunning(), "TaskGraph is already running!")
+        EE_CORE_ASSERT(IsAcyclic(), "TaskGraph has a dependency cycle!")
+
+        if (m_Nodes.empty()) return;
+
+        m_Pool = &pool;
+        m_Priority = priority;
+        for (const auto& node : m_Nodes)
+            node->Pending.store(node->Dependencies, std::memory_order_relaxed);
+
+        for (NodeId id = 0; id < m_Nodes.size(); id++)
+        {
+            if (m_Nodes[id]->Dependencies == 0)
+                Schedule(id);
+        }
+    }
+
+    void TaskGraph::Run(const ETaskPriority priority)
+    {
+        Run(Executor::Get().GetWorkerPool(), priority);
+    }
+
+    void TaskGraph::Wait()
+    {
+        m_WaitGroup.Wait();
+    }
+
+    bool TaskGraph::IsRunning() const
+    {
+        return m_WaitGroup.GetCount() > 0;
+    }
+
+    void TaskGraph::Schedule(const NodeId id)
+    {
+        m_Pool->Enqueue(m_Priority, [this, id] { Execute(id); }, &m_WaitGroup);
+    }
+
+    void TaskGraph::Execute(const NodeId id)
+    {
+        auto& node = *m_Nodes[id];
+        node.Task();
+
+        for (const auto successor : node.Successors)
+        {
+            if (m_Nodes[successor]->Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                Schedule(successor);
+        }
+    }
+
+    bool TaskGraph::IsAcyclic() const
+    {
+        // Kahn's algorithm: every task is reached once its dependencies are
+        std::vector<uint32_t> dependencies(m_Nodes.size());
+        std::vector<NodeId> ready;
+        for (NodeId id = 0; id < m_Nodes.size(); id++)
+        {
+            dependencies[id] = m_Nodes[id]->Dependencies;
+            if (dependencies[id] == 0)
+                ready.push_back(id);
+        }
+
+        size_t visited = 0;
+        while (!ready.empty())
+        {
+            const auto id = ready.back();
+            ready.pop_back();
+            visited++;
+
+            for (const auto successor : m_Nodes[id]->Successors)
+            {
+                if (--dependencies[successor] == 0)
+                    ready.push_back(successor);
+            }
+        }
+
+        return visited == m_Nodes.size();
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Engine/Core/Executor/ThreadPool.h>
+
+namespace Elixir
+{
+    /**
+     * Set of tasks with dependencies between them. When a task finishes, it enqueues the
+     * tasks that only waited for it as continuations, on the same worker. The graph can
+     * be run again once it completed, e.g. every frame.
+     *
+     * The graph must not be modified while it runs.
+     */
+    class ELIXIR_API TaskGraph
+    {
+      public:
+        using NodeId = uint32_t;
+
+        TaskGraph() = default;
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /**
+         * Add a task, run once per run of the graph.
+         * @return The task id, to declare its dependencies.
+         */
+        NodeId Add(Executable task);
+
+        /**
+         * Make a task wait for another one.
+         * @param before The task to finish first.
+         * @param after The task to run once before is done.
+         */
+        void Precede(NodeId before, NodeId after);
+
+        /**
+         * Enqueue the tasks without dependencies on the worker pool, the others follow as
+         * their dependencies finish.
+         * @param priority The priority of all the tasks of the graph.
+         */
+        void Run(ThreadPool& pool, ETaskPriority priority = ETaskPriority::Normal);
+        void Run(ETaskPriority priority = ETaskPriority::Normal);
+
+        /**
+         * Block until every task of the current run is done.
+         */
+        void Wait();
+
+        [[nodiscard]] bool IsRunning() const;
+        [[nodiscard]] size_t GetTaskCount() const { return m_Nodes.size(); }
+
+      private:
+        struct SNode
+        {
+            Executable Task;
+            std::vector<NodeId> Successors;
+            uint32_t Dependencies = 0;
+            std::atomic<uint32_t> Pending = 0;
+        };
+
+        void Schedule(NodeId id);
+        void Execute(NodeId id);
+        [[nodiscard]] bool IsAcyclic() const;
+
+        std::vector<Scope<SNode>> m_Nodes;
+        ThreadPool* m_Pool = nullptr;
+        ETaskPriority m_Priority = ETaskPriority::Normal;
+
+        // Continuations are enqueued before their predecessor is done, so the group only
+        // completes with the last task of the run
+        WaitGroup m_WaitGroup;
+    };
+}
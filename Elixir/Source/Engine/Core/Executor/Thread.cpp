@@ -5,15 +5,10 @@
 
 namespace Elixir
 {
+    thread_local Thread* Thread::s_Current = nullptr;
+
     Thread::Thread(ThreadPool* pool, const size_t index, const std::string& name)
-        : Thread(pool, index, name, std::thread(&Thread::WorkerLoop, this)) {}
-    
-    Thread::Thread(
-        ThreadPool* pool,
-        const size_t index,
-        const std::string& name,
-        std::thread thread
-    ) : m_Pool(pool), m_WorkerIndex(index), m_Name(name), m_Thread(std::move(thread))
+        : m_Pool(pool), m_WorkerIndex(index), m_Name(name)
     {
         EE_CORE_TRACE("Thread created: [Name = {0}, ThreadPool = {1}]", m_Name, m_Pool->GetName())
     }
@@ -23,9 +18,11 @@ namespace Elixir
         Join();
     }
 
-    void Thread::Enqueue(Executable executable)
+    void Thread::Enqueue(Executable executable, const ETaskPriority priority)
     {
-        m_Queue.enqueue(std::move(executable));
+        EE_CORE_ASSERT(s_Current == this, "Thread [{0}] can only enqueue to itself!", m_Name)
+
+        m_Pool->Submit(TaskArena::New<Executable>(std::move(executable)), priority);
     }
 
     void Thread::Join()
@@ -37,15 +34,15 @@ namespace Elixir
         }
     }
 
-    Executable Thread::StealWork()
+    Executable* Thread::StealWork(const ETaskPriority priority)
     {
-        Executable executable;
-        if (m_Queue.try_dequeue(executable))
-        {
-            return executable;
-        }
+        return m_Deques[(size_t)priority].Steal().value_or(nullptr);
+    }
 
-        return nullptr;
+    void Thread::Start()
+    {
+        // Started once the whole pool is built, as workers steal from each other
+        m_Thread = std::thread(&Thread::WorkerLoop, this);
     }
 
     void Thread::WorkerLoop()
@@ -56,30 +53,61 @@ namespace Elixir
         name << "[" << m_Pool->GetName() << "] " << m_Name;
         EE_PROFILE_SET_THREAD_NAME(name.str().c_str());
 
+        s_Current = this;
+
         while (m_Pool->IsRunning())
         {
-            if (const auto executable = AcquireWork())
-                executable();
+            if (!RunPendingTask())
+                m_Pool->WaitForWork(*this);
         }
+
+        s_Current = nullptr;
     }
 
-    Executable Thread::AcquireWork()
+    Executable* Thread::AcquireWork(const ETaskPriority lowest, ETaskPriority& priority)
     {
-        Executable executable;
-
-        // Try the local queue first
-        if (m_Queue.try_dequeue(executable))
+        // Most urgent first: a background task only runs when nothing else is pending
+        for (size_t i = 0; i <= (size_t)lowest; i++)
         {
-            return executable;
+            priority = (ETaskPriority)i;
+
+            const bool background = priority == ETaskPriority::Background && m_BackgroundDepth == 0;
+            if (background && !m_Pool->AcquireBackgroundSlot())
+                return nullptr;
+
+            // Try the local deque first, most recently spawned tasks are the hottest in cache
+            if (const auto executable = m_Deques[i].Pop())
+                return *executable;
+
+            // Delegate to ThreadPool for global/stealing logic.
+            if (const auto executable = m_Pool->GetExecutableForWorker(m_WorkerIndex, priority))
+                return executable;
+
+            if (background)
+                m_Pool->ReleaseBackgroundSlot();
         }
 
-        // Delegate to ThreadPool for global/stealing logic.
-        executable = m_Pool->GetExecutableForWorker(m_WorkerIndex);
+        return nullptr;
+    }
+
+    bool Thread::RunPendingTask(const ETaskPriority lowest)
+    {
+        EE_CORE_ASSERT(s_Current == this, "Thread [{0}] can only run tasks on itself!", m_Name)
+
+        ETaskPriority priority;
+        const auto executable = AcquireWork(lowest, priority);
+        if (!executable) return false;
+
+        const auto background = priority == ETaskPriority::Background;
+        if (background) m_BackgroundDepth++;
+        const auto previous = std::exchange(m_Priority, priority);
+
+        m_Pool->Execute(executable, priority);
 
-        // If no work, wait briefly.
-        if (!executable)
-            m_Pool->WaitForWork();
+        m_Priority = previous;
+        if (background && --m_BackgroundDepth == 0)
+            m_Pool->ReleaseBackgroundSlot();
 
-        return executable;
+        return true;
     }
-}
\ No newline at end of file
+}
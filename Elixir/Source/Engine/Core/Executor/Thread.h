@@ -1,8 +1,7 @@
 #pragma once
 
 #include <Engine/Core/Executor/Executable.h>
-
-#include <concurrentqueue.h>
+#include <Engine/Core/Executor/WorkStealingDeque.h>
 
 namespace Elixir
 {
@@ -11,35 +10,69 @@ namespace Elixir
     class ELIXIR_API Thread final
     {
         friend class ThreadPool;
+        friend class WaitGroup;
 
       public:
         explicit Thread(ThreadPool* pool, size_t index, const std::string& name);
-        Thread(
-          ThreadPool* pool,
-          size_t index,
-          const std::string& name,
-          std::thread thread
-        );
 
         ~Thread();
-        
-        void Enqueue(Executable executable);
+
+        /**
+         * Push a task to this worker's deque. Must only be called from the worker itself,
+         * other threads submit through @ref ThreadPool::Enqueue.
+         */
+        void Enqueue(Executable executable, ETaskPriority priority = ETaskPriority::Normal);
         void Join();
 
         [[nodiscard]] const std::string& GetName() const { return m_Name; }
+        [[nodiscard]] size_t GetWorkerIndex() const { return m_WorkerIndex; }
+        [[nodiscard]] ThreadPool* GetPool() const { return m_Pool; }
+
+        /**
+         * Get the priority of the task running on this worker, Background when idle.
+         */
+        [[nodiscard]] ETaskPriority GetPriority() const { return m_Priority; }
+
+        /**
+         * Get the worker running on the calling thread.
+         * @return The worker, or nullptr if called from a thread outside any pool.
+         */
+        static Thread* GetCurrent() { return s_Current; }
 
       protected:
-        Executable StealWork();
+        Executable* StealWork(ETaskPriority priority);
 
       private:
+        void Start();
         void WorkerLoop();
-        Executable AcquireWork();
+        Executable* AcquireWork(ETaskPriority lowest, ETaskPriority& priority);
+
+        /**
+         * Run one task of the pool, if any, from this worker's own thread.
+         * @param lowest The lowest priority of the task to run.
+         * @return Whether a task was run.
+         */
+        bool RunPendingTask(ETaskPriority lowest = ETaskPriority::Background);
 
         ThreadPool* m_Pool;
         size_t m_WorkerIndex;
 
         std::string m_Name;
         std::thread m_Thread;
-        moodycamel::ConcurrentQueue<Executable> m_Queue;
+
+        // Released by the pool to wake the worker once parked
+        std::binary_semaphore m_Wakeup { 0 };
+
+        // Tasks spawned by this worker, per priority: popped LIFO by it, stolen FIFO by the
+        // others
+        std::array<WorkStealingDeque<Executable*>, TASK_PRIORITY_COUNT> m_Deques;
+
+        ETaskPriority m_Priority = ETaskPriority::Background;
+
+        // Background tasks nested on this worker, e.g. run while a background task waits.
+        // The worker only takes one of the pool's background slots for all of them
+        uint32_t m_BackgroundDepth = 0;
+
+        static thread_local Thread* s_Current;
     };
-}
\ No newline at end of file
+}
@@ -1,8 +1,28 @@
 #include "epch.h"
 #include "ThreadPool.h"
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #include <immintrin.h>
+#endif
+
 namespace Elixir
 {
+    namespace
+    {
+        // Hint the CPU that this is a spin-wait loop, to save power and free resources for
+        // the other hyper-thread of the core
+        void CpuRelax()
+        {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+            _mm_pause();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+            __asm__ __volatile__("yield");
+#else
+            std::this_thread::yield();
+#endif
+        }
+    }
+
     ThreadPool::ThreadPool(const size_t numThreads, const std::string& name)
         : m_Name(name)
     {
@@ -11,12 +31,17 @@ namespace Elixir
             : numThreads;
 
         m_Workers.reserve(threads);
+        m_Parked.reserve(threads);
+        m_MaxBackgroundWorkers = std::max<uint32_t>(1, (uint32_t)threads - 1);
 
         for (size_t i = 0; i < threads; ++i)
         {
             auto worker = CreateScope<Thread>(this, i, "Worker " + std::to_string(i));
             m_Workers.push_back(std::move(worker));
         }
+
+        for (const auto& worker : m_Workers)
+            worker->Start();
     }
 
     ThreadPool::~ThreadPool()
@@ -33,51 +58,203 @@ namespace Elixir
             return;
 
         m_Running = false;
-        m_Condition.notify_all();
+        WakeAll();
 
         for (const auto& worker : m_Workers)
             worker->Join();
 
-        Executable discarted;
-        while (m_Queue.try_dequeue(discarted)) {}
+        // The workers are joined, their deques can be drained from here
+        for (size_t i = 0; i < TASK_PRIORITY_COUNT; i++)
+        {
+            Executable* discarded;
+            while (m_Queues[i].try_dequeue(discarded))
+                TaskArena::Delete(discarded);
+
+            for (const auto& worker : m_Workers)
+            {
+                while (const auto executable = worker->m_Deques[i].Pop())
+                    TaskArena::Delete(*executable);
+            }
+
+            m_Pending[i] = 0;
+        }
+    }
+
+    void ThreadPool::SetMaxBackgroundWorkers(const uint32_t workers)
+    {
+        EE_CORE_ASSERT(workers > 0, "At least one worker must run background tasks!")
+        m_MaxBackgroundWorkers.store(workers, std::memory_order_seq_cst);
+        WakeOne();
+    }
+
+    void ThreadPool::Submit(Executable* executable, const ETaskPriority priority)
+    {
+        // Tasks spawned by a worker of this pool stay on its deque, the others are injected
+        // in the global queue
+        const auto current = Thread::GetCurrent();
+        if (current && current->GetPool() == this)
+            current->m_Deques[(size_t)priority].Push(executable);
+        else
+            m_Queues[(size_t)priority].enqueue(executable);
+
+        m_Pending[(size_t)priority].fetch_add(1, std::memory_order_seq_cst);
+
+        // A spinning worker will take the task on its own
+        if (m_Spinning.load(std::memory_order_seq_cst) == 0)
+            WakeOne();
     }
 
-    Executable ThreadPool::GetExecutableForWorker(const size_t workerIndex)
+    void ThreadPool::Execute(Executable* executable, const ETaskPriority priority)
     {
-        Executable executable;
+        m_Pending[(size_t)priority].fetch_sub(1, std::memory_order_relaxed);
+
+        (*executable)();
+        TaskArena::Delete(executable);
+    }
+
+    Executable* ThreadPool::GetExecutableForWorker(const size_t workerIndex, const ETaskPriority priority)
+    {
+        Executable* executable;
 
         // Try global queue
-        if (m_Queue.try_dequeue(executable))
+        if (m_Queues[(size_t)priority].try_dequeue(executable))
         {
             return executable;
         }
 
         // Try stealing from other workers (FIFO)
-        executable = StealWork(workerIndex);
+        executable = StealWork(workerIndex, priority);
 
         return executable;
     }
 
-    void ThreadPool::WaitForWork()
+    bool ThreadPool::HasPendingWork() const
+    {
+        if (m_Pending[(size_t)ETaskPriority::FrameCritical].load(std::memory_order_seq_cst) > 0)
+            return true;
+
+        if (m_Pending[(size_t)ETaskPriority::Normal].load(std::memory_order_seq_cst) > 0)
+            return true;
+
+        return m_Pending[(size_t)ETaskPriority::Background].load(std::memory_order_seq_cst) > 0
+            && m_BackgroundWorkers.load(std::memory_order_seq_cst) < m_MaxBackgroundWorkers.load(std::memory_order_seq_cst);
+    }
+
+    bool ThreadPool::AcquireBackgroundSlot()
+    {
+        auto workers = m_BackgroundWorkers.load(std::memory_order_relaxed);
+        do
+        {
+            if (workers >= m_MaxBackgroundWorkers.load(std::memory_order_relaxed))
+                return false;
+        }
+        while (!m_BackgroundWorkers.compare_exchange_weak(workers, workers + 1, std::memory_order_seq_cst));
+
+        return true;
+    }
+
+    void ThreadPool::ReleaseBackgroundSlot()
+    {
+        m_BackgroundWorkers.fetch_sub(1, std::memory_order_seq_cst);
+
+        // Background tasks left waiting for the slot
+        if (m_Pending[(size_t)ETaskPriority::Background].load(std::memory_order_seq_cst) > 0
+            && m_Spinning.load(std::memory_order_seq_cst) == 0)
+        {
+            WakeOne();
+        }
+    }
+
+    void ThreadPool::WaitForWork(Thread& worker)
+    {
+        m_Spinning.fetch_add(1, std::memory_order_seq_cst);
+
+        const auto budget = m_SpinBudget.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < budget; i++)
+        {
+            if (HasPendingWork() || !m_Running)
+                break;
+
+            CpuRelax();
+        }
+
+        m_Spinning.fetch_sub(1, std::memory_order_seq_cst);
+
+        if (HasPendingWork() || !m_Running)
+            return;
+
+        Park(worker);
+    }
+
+    void ThreadPool::Park(Thread& worker)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        {
+            std::lock_guard lock(m_ParkMutex);
+            m_Parked.push_back(&worker);
+            m_ParkedCount.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        // A task enqueued before the worker was listed may have found no one to wake, check
+        // again now that Submit will see it
+        if (HasPendingWork() || !m_Running)
+        {
+            std::lock_guard lock(m_ParkMutex);
+            const auto it = std::ranges::find(m_Parked, &worker);
+            if (it != m_Parked.end())
+            {
+                m_Parked.erase(it);
+                m_ParkedCount.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            // Already woken, consume the wake-up below
+        }
+
+        worker.m_Wakeup.acquire();
+    }
+
+    void ThreadPool::WakeOne()
     {
-        std::unique_lock lock(m_Mutex);
-        m_Condition.wait_for(lock, std::chrono::milliseconds(10), [this]
+        if (m_ParkedCount.load(std::memory_order_seq_cst) == 0)
+            return;
+
+        Thread* worker;
         {
-            return !m_Running || m_Queue.size_approx() > 0;
-        });
+            std::lock_guard lock(m_ParkMutex);
+            if (m_Parked.empty()) return;
+
+            // Most recently parked first, its caches are the warmest
+            worker = m_Parked.back();
+            m_Parked.pop_back();
+            m_ParkedCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        worker->m_Wakeup.release();
+    }
+
+    void ThreadPool::WakeAll()
+    {
+        std::lock_guard lock(m_ParkMutex);
+        for (const auto worker : m_Parked)
+            worker->m_Wakeup.release();
+
+        m_Parked.clear();
+        m_ParkedCount.store(0, std::memory_order_relaxed);
     }
 
-    Executable ThreadPool::StealWork(const size_t thiefIndex) const
+    Executable* ThreadPool::StealWork(const size_t thiefIndex, const ETaskPriority priority) const
     {
         // Try stealing from other workers in round-robin fashion
         for (size_t i = 1; i < m_Workers.size(); ++i)
         {
             const auto victimIndex = (thiefIndex + i) % m_Workers.size();
 
-            if (auto exec = m_Workers[victimIndex]->StealWork())
+            if (const auto exec = m_Workers[victimIndex]->StealWork(priority))
                 return exec;
         }
 
         return nullptr;
     }
-}
\ No newline at end of file
+}
@@ -4,17 +4,37 @@
 #include <Engine/Core/Executor/Executable.h>
 #include <Engine/Core/Executor/WaitGroup.h>
 
+#include <concurrentqueue.h>
+
 namespace Elixir
 {
     static unsigned GetNumHardwareThreads() {
         return std::thread::hardware_concurrency();
     }
 
+    /**
+     * Runs tasks on a fixed set of workers. Each worker owns a work-stealing deque: tasks
+     * enqueued from a worker are pushed to its own deque and popped back LIFO, while idle
+     * workers steal FIFO from the others. Tasks enqueued from outside the pool go to a
+     * global injector queue.
+     *
+     * There is a deque and a global queue per @ref ETaskPriority, workers always take the
+     * most urgent task available. Background tasks run on at most
+     * @ref GetMaxBackgroundWorkers workers at once, so the others stay free for the frame.
+     *
+     * Workers out of tasks spin for a while, as new tasks often follow shortly, then park
+     * on their own semaphore. Enqueuing a task wakes a parked worker unless one is still
+     * spinning.
+     */
     class ELIXIR_API ThreadPool
     {
         friend class Thread;
 
       public:
+        // Iterations an idle worker polls for tasks before parking, about a microsecond per
+        // thousand iterations
+        static constexpr uint32_t DEFAULT_SPIN_BUDGET = 4096;
+
         explicit ThreadPool(size_t numThreads = GetNumHardwareThreads(), const std::string& name = nullptr);
         ThreadPool(ThreadPool const &) = delete;
         ThreadPool(ThreadPool &&) noexcept = delete;
@@ -25,12 +45,18 @@ namespace Elixir
 
         template <typename F, typename... Args>
         void Enqueue(F&& func, Args&&... args, WaitGroup* wg = nullptr)
+        {
+            Enqueue<F, Args...>(ETaskPriority::Normal, std::forward<F>(func), std::forward<Args>(args)..., wg);
+        }
+
+        template <typename F, typename... Args>
+        void Enqueue(const ETaskPriority priority, F&& func, Args&&... args, WaitGroup* wg = nullptr)
         {
             EE_CORE_ASSERT(m_Running, "ThreadPool [{0}] is not running!", m_Name)
 
             if (wg) wg->Add(1);
 
-            Executable exec = [func = std::forward<F>(func), ... args = std::forward<Args>(args), wg]() mutable
+            auto exec = [func = std::forward<F>(func), ... args = std::forward<Args>(args), wg]() mutable
             {
                 try
                 {
@@ -46,34 +72,79 @@ namespace Elixir
                 if (wg) wg->Done();
             };
 
-            m_Queue.enqueue(std::move(exec));
-            m_Condition.notify_one();
+            Submit(TaskArena::New<Executable>(std::move(exec)), priority);
         }
 
         bool IsRunning() const { return m_Running; }
 
         [[nodiscard]] const std::string& GetName() const { return m_Name; }
+        [[nodiscard]] size_t GetWorkerCount() const { return m_Workers.size(); }
+
+        /**
+         * Set how long idle workers poll for new tasks before parking. A larger budget
+         * lowers the latency of tasks enqueued in bursts, at the cost of busy cores.
+         * @param spins The polling iterations, 0 to park right away.
+         */
+        void SetSpinBudget(const uint32_t spins) { m_SpinBudget.store(spins, std::memory_order_relaxed); }
+        [[nodiscard]] uint32_t GetSpinBudget() const { return m_SpinBudget.load(std::memory_order_relaxed); }
+
+        /**
+         * Set how many workers can run background tasks at once, all but one by default.
+         */
+        void SetMaxBackgroundWorkers(uint32_t workers);
+        [[nodiscard]] uint32_t GetMaxBackgroundWorkers() const { return m_MaxBackgroundWorkers.load(std::memory_order_relaxed); }
 
         ThreadPool &operator=(ThreadPool const &) = delete;
         ThreadPool &operator=(ThreadPool &&) noexcept = delete;
 
       protected:
-        Executable GetExecutableForWorker(size_t workerIndex);
-        void WaitForWork();
+        Executable* GetExecutableForWorker(size_t workerIndex, ETaskPriority priority);
+
+        /**
+         * Spin for new tasks within the spin budget, then park the worker until woken.
+         */
+        void WaitForWork(Thread& worker);
 
       private:
-        Executable StealWork(size_t thiefIndex) const;
+        void Park(Thread& worker);
+        void WakeOne();
+        void WakeAll();
+
+        /**
+         * Check whether an idle worker could take a task, a background task only counts
+         * while a background slot is free.
+         */
+        [[nodiscard]] bool HasPendingWork() const;
+
+        bool AcquireBackgroundSlot();
+        void ReleaseBackgroundSlot();
+
+        void Submit(Executable* executable, ETaskPriority priority);
+        void Execute(Executable* executable, ETaskPriority priority);
+        Executable* StealWork(size_t thiefIndex, ETaskPriority priority) const;
 
         std::string m_Name;
     
         std::vector<Scope<Thread>> m_Workers;
 
-        // Global queue
-        moodycamel::ConcurrentQueue<Executable> m_Queue;
+        // Global injector queues, for tasks enqueued outside the pool
+        std::array<moodycamel::ConcurrentQueue<Executable*>, TASK_PRIORITY_COUNT> m_Queues;
+
+        // Tasks enqueued and not started yet, in any queue
+        std::array<std::atomic<size_t>, TASK_PRIORITY_COUNT> m_Pending = {};
+
+        // Workers running background tasks
+        std::atomic<uint32_t> m_BackgroundWorkers = 0;
+        std::atomic<uint32_t> m_MaxBackgroundWorkers = 1;
+
+        std::atomic<uint32_t> m_SpinBudget = DEFAULT_SPIN_BUDGET;
+        std::atomic<uint32_t> m_Spinning = 0;
 
-        std::mutex m_Mutex;
-        std::condition_variable m_Condition;
+        // Parked workers, only locked to park or wake one
+        std::mutex m_ParkMutex;
+        std::vector<Thread*> m_Parked;
+        std::atomic<uint32_t> m_ParkedCount = 0;
 
         std::atomic<bool> m_Running{true};
     };
-}
\ No newline at end of file
+}
@@ -1,36 +1,100 @@
 #include "epch.h"
 #include "WaitGroup.h"
 
+#include <Engine/Core/Executor/Thread.h>
+
 namespace Elixir
 {
+    namespace
+    {
+        // Failed attempts to find a task before a helping worker starts to sleep between
+        // attempts, when the remaining tasks run long on other workers
+        constexpr uint32_t HELP_SPINS = 64;
+        constexpr auto HELP_SLEEP = std::chrono::microseconds(50);
+    }
+
     void WaitGroup::Wait()
     {
-        std::unique_lock lock(m_Mutex);
-        m_Condition.wait(lock, [this] { return m_Count <= 0; });
+        EE_PROFILE_ZONE_SCOPED()
+
+        uint32_t spins = 0;
+        for (auto state = m_State.load(std::memory_order_acquire); state != 0; state = m_State.load(std::memory_order_acquire))
+        {
+            if ((state & COUNT_MASK) == 0)
+            {
+                // Only a Done call returning, a matter of a few instructions
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (Thread::GetCurrent())
+            {
+                if (Help())
+                    spins = 0;
+                else if (++spins < HELP_SPINS)
+                    std::this_thread::yield();
+                else
+                    std::this_thread::sleep_for(HELP_SLEEP);
+
+                continue;
+            }
+
+            m_State.wait(state, std::memory_order_acquire);
+        }
     }
 
     bool WaitGroup::WaitFor(const std::chrono::milliseconds timeout)
     {
-        std::unique_lock lock(m_Mutex);
-        return m_Condition.wait_for(lock, timeout, [this] { return m_Count <= 0; });
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        uint32_t spins = 0;
+        for (auto state = m_State.load(std::memory_order_acquire); state != 0; state = m_State.load(std::memory_order_acquire))
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+
+            if (Help())
+                spins = 0;
+            else if (++spins < HELP_SPINS)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(HELP_SLEEP);
+        }
+
+        return true;
     }
 
     int WaitGroup::GetCount() const
     {
-        std::lock_guard lock(m_Mutex);
-        return m_Count;
+        return (int)(m_State.load(std::memory_order_acquire) & COUNT_MASK);
     }
 
     void WaitGroup::Add(const int delta)
     {
-        std::lock_guard lock(m_Mutex);
-        m_Count += delta;
+        EE_CORE_ASSERT(GetCount() + delta >= 0, "WaitGroup count cannot be negative!")
+        m_State.fetch_add((uint64_t)(int64_t)delta, std::memory_order_relaxed);
     }
 
     void WaitGroup::Done()
     {
-        std::unique_lock lock(m_Mutex);
-        if (--m_Count <= 0)
-            m_Condition.notify_all();
+        const auto state = m_State.fetch_add(DONE_IN_PROGRESS - 1, std::memory_order_acq_rel) + DONE_IN_PROGRESS - 1;
+        if ((state & COUNT_MASK) == 0)
+            m_State.notify_all();
+
+        // Last access, the group can be destroyed past this point
+        m_State.fetch_sub(DONE_IN_PROGRESS, std::memory_order_release);
+    }
+
+    bool WaitGroup::Help()
+    {
+        const auto worker = Thread::GetCurrent();
+        if (!worker) return false;
+
+        // A frame critical task waiting must not get stuck in a long background task
+        const auto lowest = worker->GetPriority() == ETaskPriority::FrameCritical
+            ? ETaskPriority::Normal
+            : ETaskPriority::Background;
+
+        return worker->RunPendingTask(lowest);
     }
-}
\ No newline at end of file
+}
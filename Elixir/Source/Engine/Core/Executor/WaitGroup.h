@@ -1,12 +1,31 @@
 #pragma once
 
+#include <atomic>
+
 namespace Elixir
 {
+    namespace Detail
+    {
+        struct SAsyncPromiseBase;
+    }
+
+    /**
+     * Counts the tasks of a group and waits for them to be done.
+     *
+     * Waiting from a worker thread keeps running the tasks of its pool (its own deque
+     * first, then the global queue and the other workers) until the group is done, so
+     * a task can wait for the tasks it spawned without blocking a worker. Other threads
+     * sleep until the last task is done.
+     */
     class ELIXIR_API WaitGroup
     {
         friend class ThreadPool;
+        friend struct Detail::SAsyncPromiseBase;
       public:
-        WaitGroup() : m_Count(0) {}
+        WaitGroup() = default;
+
+        WaitGroup(const WaitGroup&) = delete;
+        WaitGroup& operator=(const WaitGroup&) = delete;
 
         void Wait();
         bool WaitFor(std::chrono::milliseconds timeout);
@@ -18,8 +37,18 @@ namespace Elixir
         void Done();
 
       private:
-        mutable std::mutex m_Mutex;
-        std::condition_variable m_Condition;
-        int m_Count;
+        /**
+         * Run one pending task if called from a worker thread.
+         * @return Whether a task was run.
+         */
+        static bool Help();
+
+        // The task count in the low 32 bits, and in the high 32 bits the number of Done
+        // calls in progress: once the count is zero, the group may only be destroyed when
+        // no Done call still accesses it
+        static constexpr uint64_t DONE_IN_PROGRESS = 1ull << 32;
+        static constexpr uint64_t COUNT_MASK = DONE_IN_PROGRESS - 1;
+
+        std::atomic<uint64_t> m_State = 0;
     };
-}
\ No newline at end of file
+}
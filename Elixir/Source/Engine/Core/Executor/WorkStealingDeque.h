@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+
+namespace Elixir
+{
+    /**
+     * Chase-Lev work-stealing deque: the owner thread pushes and pops at the bottom (LIFO),
+     * any other thread steals from the top (FIFO). Push and pop never lock and only
+     * synchronize with thieves when the deque is about to run empty.
+     *
+     * Items are copied in and out of atomic slots, so they must be trivially copyable,
+     * e.g. pointers to tasks. The buffer grows when full, the previous buffers are kept
+     * until the deque is destroyed since a thief may still read from them.
+     *
+     * @see "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al., 2013.
+     */
+    template <typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Deque items must be trivially copyable!");
+
+      public:
+        explicit WorkStealingDeque(const size_t capacity = 256)
+        {
+            EE_CORE_ASSERT(std::has_single_bit(capacity), "Deque capacity must be a power of two!")
+
+            m_Buffers.push_back(CreateScope<SBuffer>(capacity));
+            m_Buffer.store(m_Buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * Push an item at the bottom. Must only be called by the owner thread.
+         */
+        void Push(const T item)
+        {
+            const auto bottom = m_Bottom.load(std::memory_order_relaxed);
+            const auto top = m_Top.load(std::memory_order_acquire);
+            auto* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+            if (bottom - top > (int64_t)buffer->Capacity - 1)
+                buffer = Grow(buffer, top, bottom);
+
+            buffer->Put(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Pop the most recently pushed item. Must only be called by the owner thread.
+         * @return The item, or std::nullopt if the deque is empty or a thief took the last item.
+         */
+        std::optional<T> Pop()
+        {
+            const auto bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            const auto* buffer = m_Buffer.load(std::memory_order_relaxed);
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            std::optional<T> item = buffer->Get(bottom);
+            if (top == bottom)
+            {
+                // Last item, race the thieves for it
+                if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    item.reset();
+
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return item;
+        }
+
+        /**
+         * Steal the least recently pushed item. Can be called by any thread.
+         * @return The item, or std::nullopt if the deque is empty or another thread took it.
+         */
+        std::optional<T> Steal()
+        {
+            auto top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+                return std::nullopt;
+
+            const auto* buffer = m_Buffer.load(std::memory_order_acquire);
+            const auto item = buffer->Get(top);
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return std::nullopt;
+
+            return item;
+        }
+
+        /**
+         * Get the number of items, which may already be outdated when other threads use the
+         * deque.
+         */
+        size_t GetSizeApprox() const
+        {
+            const auto bottom = m_Bottom.load(std::memory_order_relaxed);
+            const auto top = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? (size_t)(bottom - top) : 0;
+        }
+
+        bool IsEmpty() const { return GetSizeApprox() == 0; }
+
+        size_t GetCapacity() const { return m_Buffer.load(std::memory_order_relaxed)->Capacity; }
+
+      private:
+        struct SBuffer
+        {
+            explicit SBuffer(const size_t capacity)
+                : Capacity(capacity), Mask(capacity - 1), Items(CreateScope<std::atomic<T>[]>(capacity)) {}
+
+            void Put(const int64_t index, const T item)
+            {
+                Items[index & Mask].store(item, std::memory_order_relaxed);
+            }
+
+            T Get(const int64_t index) const
+            {
+                return Items[index & Mask].load(std::memory_order_relaxed);
+            }
+
+            size_t Capacity;
+            size_t Mask;
+            Scope<std::atomic<T>[]> Items;
+        };
+
+        SBuffer* Grow(const SBuffer* buffer, const int64_t top, const int64_t bottom)
+        {
+            auto grown = CreateScope<SBuffer>(buffer->Capacity * 2);
+            for (auto i = top; i < bottom; i++)
+                grown->Put(i, buffer->Get(i));
+
+            auto* result = grown.get();
+            m_Buffers.push_back(std::move(grown));
+            m_Buffer.store(result, std::memory_order_release);
+            return result;
+        }
+
+        // Top and bottom are written by different threads, keep them on separate cache lines
+        alignas(64) std::atomic<int64_t> m_Top = 0;
+        alignas(64) std::atomic<int64_t> m_Bottom = 0;
+        alignas(64) std::atomic<SBuffer*> m_Buffer = nullptr;
+
+        // Owned by the owner thread, only grows
+        std::vector<Scope<SBuffer>> m_Buffers;
+    };
+}
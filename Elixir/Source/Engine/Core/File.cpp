@@ -0,0 +1,70 @@
+#include "epch.h"
+#include "File.h"
+
+#include <Engine/Core/Executor/Executor.h>
+
+#include <fstream>
+
+namespace Elixir
+{
+    std::optional<std::vector<Byte>> LoadFile(const std::filesystem::path& filepath)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        std::error_code error;
+        const auto size = file_size(filepath, error);
+        if (error) return std::nullopt;
+
+        std::vector<Byte> data(size);
+
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.read((char*)data.data(), (std::streamsize)size))
+            return std::nullopt;
+
+        return data;
+    }
+
+    bool WriteFileAtomic(const std::filesystem::path& filepath, const std::span<const Byte> data)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        std::error_code error;
+        if (filepath.has_parent_path())
+            std::filesystem::create_directories(filepath.parent_path(), error);
+
+        auto tempPath = filepath;
+        tempPath += ".tmp";
+
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file || !file.write((const char*)data.data(), (std::streamsize)data.size()))
+            {
+                file.close();
+                std::filesystem::remove(tempPath, error);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempPath, filepath, error);
+        if (error)
+        {
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    Async<std::optional<std::vector<Byte>>> LoadFileAsync(
+        const std::filesystem::path filepath,
+        const ETaskPriority priority
+    )
+    {
+        co_await Executor::Get().Schedule(EThreadName::IO, priority);
+        auto data = LoadFile(filepath);
+
+        // Leave the IO thread to the next read
+        co_await Executor::Get().Schedule(EThreadName::Worker, priority);
+        co_return data;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Engine/Core/Core.h>
+#include <Engine/Core/Executor/Async.h>
+
+namespace Elixir
+{
+    /**
+     * Read a whole file into memory.
+     * @param filepath The file to be read.
+     * @return The contents of the file, or std::nullopt if it cannot be read.
+     */
+    ELIXIR_API std::optional<std::vector<Byte>> LoadFile(const std::filesystem::path& filepath);
+
+    /**
+     * Write a whole file, replacing the existing one atomically: the data is written next to
+     * the destination then renamed over it, so readers never see a partially written file.
+     * Missing parent directories are created.
+     * @param filepath The file to be written.
+     * @param data The contents of the file.
+     * @return true if the file was written.
+     */
+    ELIXIR_API bool WriteFileAtomic(const std::filesystem::path& filepath, std::span<const Byte> data);
+
+    /**
+     * Read a whole file on an IO thread, without blocking the caller. The awaiting coroutine
+     * continues on a worker thread.
+     * @param filepath The file to be read.
+     * @param priority The priority the awaiting coroutine continues with.
+     * @return The contents of the file, or std::nullopt if it cannot be read.
+     */
+    ELIXIR_API Async<std::optional<std::vector<Byte>>> LoadFileAsync(
+        std::filesystem::path filepath,
+        ETaskPriority priority = ETaskPriority::Background
+    );
+}
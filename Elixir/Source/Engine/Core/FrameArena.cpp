@@ -0,0 +1,140 @@
+#include "epch.h"
+#include "FrameArena.h"
+
+#include <Engine/Core/Memory.h>
+#include <Engine/Core/MemoryTracker.h>
+
+namespace Elixir
+{
+    FrameArena::FrameArena(const uint32_t frames, const size_t blockSize)
+        : m_BlockSize(blockSize)
+    {
+        EE_CORE_ASSERT(frames > 0, "Frame arena needs at least one frame!")
+
+        m_Frames.reserve(frames);
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            auto& frame = m_Frames.emplace_back(CreateScope<SFrame>());
+            frame->Current = AddBlock(*frame, m_BlockSize);
+        }
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (auto& frame : m_Frames)
+            FreeBlocks(*frame);
+    }
+
+    void FrameArena::BeginFrame(const uint32_t frameIndex)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        EE_CORE_ASSERT(frameIndex < m_Frames.size(), "Frame index out of range!")
+
+        auto& frame = *m_Frames[frameIndex];
+
+        {
+            std::lock_guard lock(frame.Mutex);
+
+            // The frame outgrew its block, merge the blocks into one fitting the peak
+            if (frame.Blocks.size() > 1)
+            {
+                size_t size = 0;
+                for (const auto& block : frame.Blocks)
+                    size += block->Size;
+
+                FreeBlocks(frame);
+                frame.Current = AddBlock(frame, size);
+            }
+            else
+            {
+                frame.Blocks.front()->Offset.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        m_FrameIndex.store(frameIndex, std::memory_order_release);
+    }
+
+    Byte* FrameArena::Alloc(const size_t size, const uint32_t alignment)
+    {
+        EE_CORE_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two!")
+
+        auto& frame = *m_Frames[m_FrameIndex.load(std::memory_order_acquire)];
+
+        if (const auto ptr = TryBump(*frame.Current.load(std::memory_order_acquire), size, alignment))
+            return ptr;
+
+        return AllocSlow(frame, size, alignment);
+    }
+
+    size_t FrameArena::GetUsedSize() const
+    {
+        auto& frame = *m_Frames[m_FrameIndex.load(std::memory_order_acquire)];
+        std::lock_guard lock(frame.Mutex);
+
+        size_t used = 0;
+        for (const auto& block : frame.Blocks)
+            used += block->Offset.load(std::memory_order_relaxed);
+
+        return used;
+    }
+
+    Byte* FrameArena::TryBump(SBlock& block, const size_t size, const uint32_t alignment)
+    {
+        const auto base = reinterpret_cast<uintptr_t>(block.Data);
+
+        size_t offset = block.Offset.load(std::memory_order_relaxed);
+        size_t aligned;
+
+        do
+        {
+            aligned = ((base + offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+            if (aligned + size > block.Size)
+                return nullptr;
+        }
+        while (!block.Offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed));
+
+        return block.Data + aligned;
+    }
+
+    Byte* FrameArena::AllocSlow(SFrame& frame, const size_t size, const uint32_t alignment)
+    {
+        std::lock_guard lock(frame.Mutex);
+
+        // Another thread may have added a block meanwhile
+        auto* block = frame.Current.load(std::memory_order_relaxed);
+        if (const auto ptr = TryBump(*block, size, alignment))
+            return ptr;
+
+        block = AddBlock(frame, std::max(m_BlockSize, size + alignment));
+        const auto ptr = TryBump(*block, size, alignment);
+        frame.Current.store(block, std::memory_order_release);
+
+        return ptr;
+    }
+
+    FrameArena::SBlock* FrameArena::AddBlock(SFrame& frame, const size_t size)
+    {
+        MemoryTagScope tag(EMemoryTag::Frame);
+        auto [data, allocatedSize] = Memory::Alloc(size, Memory::MaxAlignment);
+        EE_CORE_ASSERT(data != nullptr, "Memory allocation failed!")
+
+        auto& block = frame.Blocks.emplace_back(CreateScope<SBlock>());
+        block->Data = data;
+        block->Size = allocatedSize;
+
+        m_ReservedSize.fetch_add(allocatedSize, std::memory_order_relaxed);
+        return block.get();
+    }
+
+    void FrameArena::FreeBlocks(SFrame& frame)
+    {
+        for (const auto& block : frame.Blocks)
+        {
+            m_ReservedSize.fetch_sub(block->Size, std::memory_order_relaxed);
+            Memory::Free(block->Data);
+        }
+
+        frame.Blocks.clear();
+        frame.Current = nullptr;
+    }
+}
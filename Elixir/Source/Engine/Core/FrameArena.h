@@ -0,0 +1,130 @@
+#pragma once
+
+#include <Engine/Core/Malloc.h>
+
+namespace Elixir
+{
+    /**
+     * Linear allocator for the transient data of a frame: command lists, staging vectors
+     * and the like, which are built during a frame and dropped at its end.
+     *
+     * The arena keeps a buffer per frame in flight. Allocating bumps an offset in the buffer
+     * of the current frame, lock free, so any thread working on the frame can allocate.
+     * Nothing is freed on its own: @ref BeginFrame resets the whole buffer of the frame
+     * starting, which was last used frames-in-flight frames ago. So frame data lives until
+     * the same frame index comes around again.
+     *
+     * A buffer is a list of blocks. When a frame outgrows them, a new block is added under
+     * a lock, and on reset the blocks are merged into one sized for that peak, so steady
+     * frames fit in a single block.
+     */
+    class ELIXIR_API FrameArena final
+    {
+      public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+        /**
+         * @param frames The number of frame buffers, usually the frames in flight.
+         * @param blockSize The initial size of each frame buffer.
+         */
+        explicit FrameArena(uint32_t frames, size_t blockSize = DEFAULT_BLOCK_SIZE);
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * Make the buffer of the frame index current and reset it. No thread may be
+         * allocating meanwhile, and everything allocated on it before is invalidated.
+         * @param frameIndex The index of the frame starting.
+         */
+        void BeginFrame(uint32_t frameIndex);
+
+        /**
+         * Allocate from the buffer of the current frame. Thread safe.
+         * @param size The size in bytes.
+         * @param alignment The alignment in bytes, a power of two.
+         * @return The allocated memory, valid until the frame index comes around again.
+         */
+        Byte* Alloc(size_t size, uint32_t alignment = alignof(std::max_align_t));
+
+        uint32_t GetFrameIndex() const { return m_FrameIndex.load(std::memory_order_relaxed); }
+
+        /**
+         * Get the bytes allocated so far by the current frame, including alignment padding.
+         */
+        size_t GetUsedSize() const;
+
+        /**
+         * Get the bytes reserved by the blocks of every frame buffer.
+         */
+        size_t GetReservedSize() const { return m_ReservedSize.load(std::memory_order_relaxed); }
+
+      private:
+        struct SBlock
+        {
+            Byte* Data;
+            size_t Size;
+            std::atomic<size_t> Offset = 0;
+        };
+
+        struct SFrame
+        {
+            // The block allocations bump, always the last of the blocks
+            std::atomic<SBlock*> Current = nullptr;
+
+            std::mutex Mutex;
+            std::vector<Scope<SBlock>> Blocks;
+        };
+
+        static Byte* TryBump(SBlock& block, size_t size, uint32_t alignment);
+
+        Byte* AllocSlow(SFrame& frame, size_t size, uint32_t alignment);
+        SBlock* AddBlock(SFrame& frame, size_t size);
+        void FreeBlocks(SFrame& frame);
+
+        size_t m_BlockSize;
+        std::vector<Scope<SFrame>> m_Frames;
+        std::atomic<uint32_t> m_FrameIndex = 0;
+        std::atomic<size_t> m_ReservedSize = 0;
+    };
+
+    /**
+     * STL allocator allocating from a @ref FrameArena, for containers of frame data:
+     *
+     *     FrameVector<Ref<CommandBuffer>> cmds(FrameAllocator<Ref<CommandBuffer>>(*arena));
+     *
+     * Deallocating is a no-op, the memory is reclaimed when the arena resets the frame. So
+     * the container must be destroyed before, and should not grow much, as every growth
+     * leaves its previous storage behind until then.
+     */
+    template <typename T>
+    class FrameAllocator
+    {
+      public:
+        using value_type = T;
+
+        explicit FrameAllocator(FrameArena& arena) noexcept : m_Arena(&arena) {}
+
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U>& other) noexcept : m_Arena(other.GetArena()) {}
+
+        T* allocate(const size_t count)
+        {
+            return reinterpret_cast<T*>(m_Arena->Alloc(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, size_t) noexcept {}
+
+        FrameArena* GetArena() const { return m_Arena; }
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U>& other) const { return m_Arena == other.GetArena(); }
+
+      private:
+        FrameArena* m_Arena;
+    };
+
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
@@ -0,0 +1,88 @@
+#include "epch.h"
+#include "MappedFile.h"
+
+#ifndef EE_PLATFORM_WINDOWS
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Elixir
+{
+#ifdef EE_PLATFORM_WINDOWS
+
+    MappedFile::~MappedFile()
+    {
+        if (m_Data) UnmapViewOfFile(m_Data);
+        if (m_Mapping) CloseHandle(m_Mapping);
+        if (m_File && m_File != INVALID_HANDLE_VALUE) CloseHandle(m_File);
+    }
+
+    Scope<MappedFile> MappedFile::Open(const std::filesystem::path& filepath)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        Scope<MappedFile> file(new MappedFile());
+
+        file->m_File = CreateFileW(
+            filepath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr
+        );
+        if (file->m_File == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file->m_File, &size) || size.QuadPart == 0)
+            return nullptr;
+
+        file->m_Mapping = CreateFileMappingW(file->m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!file->m_Mapping)
+            return nullptr;
+
+        file->m_Data = (const Byte*)MapViewOfFile(file->m_Mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!file->m_Data)
+            return nullptr;
+
+        file->m_Size = size.QuadPart;
+        return file;
+    }
+
+#else
+
+    MappedFile::~MappedFile()
+    {
+        if (m_Data) munmap((void*)m_Data, m_Size);
+        if (m_File >= 0) close(m_File);
+    }
+
+    Scope<MappedFile> MappedFile::Open(const std::filesystem::path& filepath)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        Scope<MappedFile> file(new MappedFile());
+
+        file->m_File = open(filepath.c_str(), O_RDONLY);
+        if (file->m_File < 0)
+            return nullptr;
+
+        struct stat info = {};
+        if (fstat(file->m_File, &info) != 0 || info.st_size == 0)
+            return nullptr;
+
+        void* data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file->m_File, 0);
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        file->m_Data = (const Byte*)data;
+        file->m_Size = info.st_size;
+        return file;
+    }
+
+#endif
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Engine/Core/Core.h>
+
+namespace Elixir
+{
+    /**
+     * Read-only memory mapping of a whole file. The contents are paged in by the OS on
+     * access, so large binary caches can be read without copying them to the heap.
+     */
+    class ELIXIR_API MappedFile
+    {
+      public:
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * Map a file into memory.
+         * @param filepath The file to be mapped.
+         * @return The mapped file, or nullptr if the file does not exist, is empty, or
+         * cannot be mapped.
+         */
+        static Scope<MappedFile> Open(const std::filesystem::path& filepath);
+
+        const Byte* GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+
+      private:
+        MappedFile() = default;
+
+        const Byte* m_Data = nullptr;
+        size_t m_Size = 0;
+
+#ifdef EE_PLATFORM_WINDOWS
+        void* m_File = nullptr;
+        void* m_Mapping = nullptr;
+#else
+        int m_File = -1;
+#endif
+    };
+}
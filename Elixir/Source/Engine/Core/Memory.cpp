@@ -1,6 +1,13 @@
 #include "Memory.h"
 
+#include <Engine/Core/CachedMalloc.h>
+#include <Engine/Core/TrackingMalloc.h>
+
 namespace Elixir
 {
-    Scope<Malloc> Memory::s_Malloc = CreateScope<SystemMalloc>();
-}
\ No newline at end of file
+#ifdef EE_SYSTEM_MALLOC
+    Scope<Malloc> Memory::s_Malloc = CreateScope<TrackingMalloc>(CreateScope<SystemMalloc>());
+#else
+    Scope<Malloc> Memory::s_Malloc = CreateScope<TrackingMalloc>(CreateScope<CachedMalloc>());
+#endif
+}
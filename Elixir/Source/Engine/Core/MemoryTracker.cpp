@@ -0,0 +1,162 @@
+#include "epch.h"
+#include "MemoryTracker.h"
+
+namespace Elixir
+{
+    namespace
+    {
+        struct STagCounters
+        {
+            std::atomic<size_t> LiveBytes = 0;
+            std::atomic<size_t> PeakBytes = 0;
+            std::atomic<uint64_t> AllocationCount = 0;
+            std::atomic<uint64_t> AllocatedBytes = 0;
+            std::atomic<size_t> Budget = 0;
+
+            // Set when an allocation goes over the budget, cleared by Update once back under
+            std::atomic<bool> OverBudget = false;
+
+            std::atomic<float> AllocationsPerSecond = 0.0f;
+            std::atomic<float> BytesPerSecond = 0.0f;
+
+            // Owned by Update
+            uint64_t WindowAllocationCount = 0;
+            uint64_t WindowAllocatedBytes = 0;
+            bool Reported = false;
+        };
+
+        // Constant initialized, so allocations made during static initialization are tracked
+        std::array<STagCounters, MemoryTracker::TAG_COUNT> s_Counters;
+        float s_WindowSeconds = 0.0f;
+
+        STagCounters& GetCounters(const EMemoryTag tag)
+        {
+            EE_CORE_ASSERT(tag < EMemoryTag::Count, "Invalid memory tag!")
+            return s_Counters[(size_t)tag];
+        }
+
+        float ToMiB(const size_t bytes)
+        {
+            return (float)bytes / (1024.0f * 1024.0f);
+        }
+    }
+
+    thread_local EMemoryTag MemoryTracker::s_CurrentTag = EMemoryTag::General;
+
+    void MemoryTracker::OnAlloc(const EMemoryTag tag, const size_t size)
+    {
+        auto& counters = GetCounters(tag);
+
+        const auto live = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        auto peak = counters.PeakBytes.load(std::memory_order_relaxed);
+        while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+        const auto budget = counters.Budget.load(std::memory_order_relaxed);
+        if (budget != 0 && live > budget && !counters.OverBudget.load(std::memory_order_relaxed))
+            counters.OverBudget.store(true, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::OnFree(const EMemoryTag tag, const size_t size)
+    {
+        GetCounters(tag).LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::Update(const Timestep frameTime)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        s_WindowSeconds += frameTime.GetSeconds();
+        if (s_WindowSeconds < RATE_WINDOW) return;
+
+        for (size_t i = 0; i < TAG_COUNT; i++)
+        {
+            auto& counters = s_Counters[i];
+
+            const auto count = counters.AllocationCount.load(std::memory_order_relaxed);
+            const auto bytes = counters.AllocatedBytes.load(std::memory_order_relaxed);
+
+            counters.AllocationsPerSecond.store(
+                (float)(count - counters.WindowAllocationCount) / s_WindowSeconds,
+                std::memory_order_relaxed
+            );
+            counters.BytesPerSecond.store(
+                (float)(bytes - counters.WindowAllocatedBytes) / s_WindowSeconds,
+                std::memory_order_relaxed
+            );
+
+            counters.WindowAllocationCount = count;
+            counters.WindowAllocatedBytes = bytes;
+
+            if (!counters.OverBudget.load(std::memory_order_relaxed)) continue;
+
+            const auto live = counters.LiveBytes.load(std::memory_order_relaxed);
+            const auto budget = counters.Budget.load(std::memory_order_relaxed);
+
+            if (!counters.Reported)
+            {
+                EE_CORE_WARN(
+                    "Memory budget exceeded! [Tag={0}, Live={1:.2f} MiB, Peak={2:.2f} MiB, Budget={3:.2f} MiB]",
+                    GetTagName((EMemoryTag)i),
+                    ToMiB(live),
+                    ToMiB(counters.PeakBytes.load(std::memory_order_relaxed)),
+                    ToMiB(budget)
+                )
+                counters.Reported = true;
+            }
+
+            if (budget == 0 || live <= budget)
+            {
+                counters.OverBudget.store(false, std::memory_order_relaxed);
+                counters.Reported = false;
+            }
+        }
+
+        s_WindowSeconds = 0.0f;
+    }
+
+    SMemoryTagStats MemoryTracker::GetStats(const EMemoryTag tag)
+    {
+        const auto& counters = GetCounters(tag);
+
+        return {
+            .LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed),
+            .PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed),
+            .AllocationCount = counters.AllocationCount.load(std::memory_order_relaxed),
+            .AllocationsPerSecond = counters.AllocationsPerSecond.load(std::memory_order_relaxed),
+            .BytesPerSecond = counters.BytesPerSecond.load(std::memory_order_relaxed),
+            .Budget = counters.Budget.load(std::memory_order_relaxed),
+            .OverBudget = counters.OverBudget.load(std::memory_order_relaxed)
+        };
+    }
+
+    size_t MemoryTracker::GetTotalLiveBytes()
+    {
+        size_t total = 0;
+        for (const auto& counters : s_Counters)
+            total += counters.LiveBytes.load(std::memory_order_relaxed);
+
+        return total;
+    }
+
+    void MemoryTracker::SetBudget(const EMemoryTag tag, const size_t bytes)
+    {
+        GetCounters(tag).Budget.store(bytes, std::memory_order_relaxed);
+    }
+
+    const char* MemoryTracker::GetTagName(const EMemoryTag tag)
+    {
+        switch (tag)
+        {
+            case EMemoryTag::General:   return "General";
+            case EMemoryTag::Graphics:  return "Graphics";
+            case EMemoryTag::GUI:       return "GUI";
+            case EMemoryTag::Aether:    return "Aether";
+            case EMemoryTag::Fonts:     return "Fonts";
+            case EMemoryTag::Frame:     return "Frame";
+            default:                    return "Unknown";
+        }
+    }
+}
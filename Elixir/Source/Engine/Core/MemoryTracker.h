@@ -0,0 +1,151 @@
+#pragma once
+
+#include <Engine/Core/Memory.h>
+#include <Engine/Core/Timer.h>
+
+namespace Elixir
+{
+    /**
+     * Subsystem an allocation made through @ref Memory is accounted to.
+     */
+    enum class EMemoryTag : uint8_t
+    {
+        General,
+        Graphics,
+        GUI,
+        Aether,
+        Fonts,
+        Frame,
+        Count
+    };
+
+    struct SMemoryTagStats
+    {
+        size_t LiveBytes = 0;
+        size_t PeakBytes = 0;
+
+        // Since startup
+        uint64_t AllocationCount = 0;
+
+        // Over the last rate window, see @ref MemoryTracker::Update
+        float AllocationsPerSecond = 0.0f;
+        float BytesPerSecond = 0.0f;
+
+        // Soft budget, zero for none
+        size_t Budget = 0;
+        bool OverBudget = false;
+    };
+
+    /**
+     * Always-on accounting of the memory allocated through @ref Memory, per @ref EMemoryTag.
+     *
+     * Every allocation is accounted to the tag current on the calling thread, see
+     * @ref MemoryTagScope, and freed from that same tag whatever thread frees it. Counters
+     * are relaxed atomics, so tracking costs a few uncontended atomic adds per allocation.
+     *
+     * Budgets are soft: going over one is only reported, once per crossing, by @ref Update.
+     */
+    class ELIXIR_API MemoryTracker
+    {
+        friend class MemoryTagScope;
+      public:
+        static constexpr size_t TAG_COUNT = (size_t)EMemoryTag::Count;
+
+        // Seconds the allocation rates are averaged over
+        static constexpr float RATE_WINDOW = 1.0f;
+
+        static void OnAlloc(EMemoryTag tag, size_t size);
+        static void OnFree(EMemoryTag tag, size_t size);
+
+        /**
+         * Refresh the allocation rates once per rate window, and report the tags that
+         * went over their budget since. Called once per frame by the application.
+         * @param frameTime Time elapsed since the last call.
+         */
+        static void Update(Timestep frameTime);
+
+        static SMemoryTagStats GetStats(EMemoryTag tag);
+        static size_t GetTotalLiveBytes();
+
+        /**
+         * Set the soft budget of a tag.
+         * @param tag The tag to budget.
+         * @param bytes The live bytes allowed, zero for no budget.
+         */
+        static void SetBudget(EMemoryTag tag, size_t bytes);
+
+        static EMemoryTag GetCurrentTag() { return s_CurrentTag; }
+        static const char* GetTagName(EMemoryTag tag);
+
+      private:
+        static thread_local EMemoryTag s_CurrentTag;
+    };
+
+    /**
+     * Accounts the allocations of the calling thread to a tag, until the scope ends:
+     *
+     *     MemoryTagScope tag(EMemoryTag::GUI);
+     *
+     * Scopes nest, the innermost wins. Tasks started from the scope do not inherit it.
+     */
+    class ELIXIR_API MemoryTagScope final
+    {
+      public:
+        explicit MemoryTagScope(const EMemoryTag tag) : m_Previous(MemoryTracker::s_CurrentTag)
+        {
+            MemoryTracker::s_CurrentTag = tag;
+        }
+
+        ~MemoryTagScope() { MemoryTracker::s_CurrentTag = m_Previous; }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+      private:
+        EMemoryTag m_Previous;
+    };
+
+    /**
+     * STL allocator allocating through @ref Memory, accounted to a tag, for the containers
+     * holding most of a subsystem's memory.
+     */
+    template <typename T, EMemoryTag Tag>
+    class TaggedAllocator
+    {
+      public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = TaggedAllocator<U, Tag>;
+        };
+
+        TaggedAllocator() noexcept = default;
+
+        template <typename U>
+        TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept {}
+
+        T* allocate(const size_t count)
+        {
+            MemoryTagScope scope(Tag);
+
+            const auto alignment = alignof(T) > Memory::MaxAlignment ? (uint32_t)alignof(T) : Memory::DefaultAlignment;
+            auto [ptr, allocatedSize] = Memory::Alloc(count * sizeof(T), alignment);
+            if (!ptr) throw std::bad_alloc();
+
+            return reinterpret_cast<T*>(ptr);
+        }
+
+        void deallocate(T* ptr, size_t) noexcept
+        {
+            Memory::Free(reinterpret_cast<Byte*>(ptr));
+        }
+
+        template <typename U>
+        bool operator==(const TaggedAllocator<U, Tag>&) const { return true; }
+    };
+
+    template <EMemoryTag Tag, typename T>
+    using TaggedVector = std::vector<T, TaggedAllocator<T, Tag>>;
+}
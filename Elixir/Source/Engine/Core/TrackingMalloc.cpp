@@ -0,0 +1,110 @@
+#include "epch.h"
+#include "TrackingMalloc.h"
+
+namespace Elixir
+{
+    namespace
+    {
+        struct SAllocationHeader
+        {
+            uint64_t Size;
+            uint32_t Offset;
+            EMemoryTag Tag;
+        };
+
+        static_assert(sizeof(SAllocationHeader) <= TrackingMalloc::HEADER_SIZE);
+
+        // Right before the pointer handed out, wherever the allocation starts
+        SAllocationHeader* GetHeader(Byte* ptr)
+        {
+            return reinterpret_cast<SAllocationHeader*>(ptr - TrackingMalloc::HEADER_SIZE);
+        }
+
+        uint32_t GetOffset(const size_t size, const uint32_t alignment)
+        {
+            return std::max(Malloc::GetAlignment(size, alignment), TrackingMalloc::HEADER_SIZE);
+        }
+    }
+
+    TrackingMalloc::TrackingMalloc(Scope<Malloc> inner) : m_Inner(std::move(inner))
+    {
+        EE_CORE_ASSERT(m_Inner, "Tracking malloc needs an inner malloc!")
+    }
+
+    std::tuple<Byte*, size_t> TrackingMalloc::Alloc(const size_t size, const uint32_t alignment)
+    {
+        return AllocTagged(size, alignment, MemoryTracker::GetCurrentTag());
+    }
+
+    std::tuple<Byte*, size_t> TrackingMalloc::Realloc(Byte* ptr, const size_t newSize, const uint32_t alignment)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        if (!ptr)
+            return Alloc(newSize, alignment);
+
+        if (newSize == 0)
+        {
+            Free(ptr);
+            return { nullptr, 0 };
+        }
+
+        const auto header = *GetHeader(ptr);
+        const auto offset = GetOffset(newSize, alignment);
+
+        // A different alignment moves the data within the allocation, so move it by hand
+        if (offset != header.Offset)
+        {
+            auto [newPtr, allocatedSize] = AllocTagged(newSize, alignment, header.Tag);
+            std::memcpy(newPtr, ptr, std::min((size_t)header.Size, allocatedSize));
+            Free(ptr);
+            return { newPtr, allocatedSize };
+        }
+
+        const auto memoryAlignment = Malloc::GetAlignment(newSize, alignment);
+        auto [base, allocatedSize] = m_Inner->Realloc(ptr - offset, newSize + offset, memoryAlignment);
+        if (!base) return { nullptr, 0 };
+
+        const auto newPtr = base + offset;
+        const auto size = allocatedSize - offset;
+        GetHeader(newPtr)->Size = size;
+
+        MemoryTracker::OnFree(header.Tag, header.Size);
+        MemoryTracker::OnAlloc(header.Tag, size);
+
+        return { newPtr, size };
+    }
+
+    void TrackingMalloc::Free(Byte* ptr)
+    {
+        if (!ptr) return;
+
+        const auto header = GetHeader(ptr);
+        MemoryTracker::OnFree(header->Tag, header->Size);
+
+        m_Inner->Free(ptr - header->Offset);
+    }
+
+    std::tuple<Byte*, size_t> TrackingMalloc::AllocTagged(
+        const size_t size,
+        const uint32_t alignment,
+        const EMemoryTag tag
+    )
+    {
+        const auto offset = GetOffset(size, alignment);
+
+        auto [base, allocatedSize] = m_Inner->Alloc(size + offset, Malloc::GetAlignment(size, alignment));
+        if (!base) return { nullptr, 0 };
+
+        const auto ptr = base + offset;
+        const auto usableSize = allocatedSize - offset;
+
+        auto* header = GetHeader(ptr);
+        header->Size = usableSize;
+        header->Offset = offset;
+        header->Tag = tag;
+
+        MemoryTracker::OnAlloc(tag, usableSize);
+        return { ptr, usableSize };
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Engine/Core/Malloc.h>
+#include <Engine/Core/MemoryTracker.h>
+
+namespace Elixir
+{
+    /**
+     * Malloc decorator accounting every allocation to a memory tag, see @ref MemoryTracker.
+     *
+     * Each allocation is prefixed by a header recording its tag and usable size, so it is
+     * freed from the right tag on any thread. The header takes the alignment of the
+     * allocation, and at least HEADER_SIZE bytes, so alignments are kept.
+     */
+    class ELIXIR_API TrackingMalloc final : public Malloc
+    {
+      public:
+        static constexpr uint32_t HEADER_SIZE = 16;
+
+        explicit TrackingMalloc(Scope<Malloc> inner);
+        ~TrackingMalloc() override = default;
+
+        std::tuple<Byte*, size_t> Alloc(size_t size, uint32_t alignment = 0) override;
+        std::tuple<Byte*, size_t> Realloc(Byte* ptr, size_t newSize, uint32_t alignment = 0) override;
+        void Free(Byte* ptr) override;
+
+        Malloc* GetInner() const { return m_Inner.get(); }
+
+      private:
+        std::tuple<Byte*, size_t> AllocTagged(size_t size, uint32_t alignment, EMemoryTag tag);
+
+        Scope<Malloc> m_Inner;
+    };
+}
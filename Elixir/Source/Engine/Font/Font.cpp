@@ -3,6 +3,42 @@
 
 namespace Elixir
 {
+    /* STextAdvances */
+
+    float STextAdvances::GetPositionAt(const size_t byteIndex) const
+    {
+        // Last boundary at or before byteIndex
+        const auto it = std::ranges::upper_bound(Offsets, (uint32_t)byteIndex);
+        return Positions[std::distance(Offsets.begin(), it) - 1];
+    }
+
+    size_t STextAdvances::GetIndexAtX(const float x) const
+    {
+        // First character whose midpoint lies right of x; midpoints are monotonic, so
+        // the predicate partitions the characters.
+        size_t lo = 0;
+        size_t hi = Offsets.size() - 1;
+        while (lo < hi)
+        {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (x < (Positions[mid] + Positions[mid + 1]) * 0.5f)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        return Offsets[lo];
+    }
+
+    size_t STextAdvances::GetFittingLength(const float width) const
+    {
+        const auto it = std::ranges::upper_bound(Positions, width);
+        if (it == Positions.begin()) return 0;
+        return Offsets[std::distance(Positions.begin(), it) - 1];
+    }
+
+    /* Font */
+
     Font::Font(const SFontCreateInfo& info)
         : m_Name(info.Name),
           m_Atlas(info.Atlas),
@@ -18,15 +54,15 @@ namespace Elixir
         const float scale = 1.0f / (m_AscenderY - m_DescenderY);
         float width = 0.0f;
 
+        std::shared_lock lock(m_GlyphsMutex);
+
         int i = 0;
         while (i < (int)text.size())
         {
             const auto charLen = UTF8::UTF8CharLength(text[i]);
             const auto codepoint = UTF8::UTF8ToCodepoint(text, i);
 
-            const auto glyph = GetGlyph(codepoint);
-
-            if (glyph.has_value())
+            if (const auto glyph = FindGlyph(codepoint))
             {
                 width += glyph->Advance * scale * fontSize;
             }
@@ -39,6 +75,36 @@ namespace Elixir
         return { width, height };
     }
 
+    STextAdvances Font::MeasureAdvances(const std::string& text, const float fontSize) const
+    {
+        const float scale = 1.0f / (m_AscenderY - m_DescenderY);
+
+        STextAdvances advances;
+        advances.Offsets.reserve(text.size() + 1);
+        advances.Positions.reserve(text.size() + 1);
+
+        std::shared_lock lock(m_GlyphsMutex);
+
+        float x = 0.0f;
+        size_t i = 0;
+        while (i < text.size())
+        {
+            const auto charLen = (size_t)UTF8::UTF8CharLength(text[i]);
+            const auto codepoint = UTF8::UTF8ToCodepoint(text, (int)i);
+
+            if (const auto glyph = FindGlyph(codepoint))
+            {
+                x += glyph->Advance * scale * fontSize;
+            }
+
+            i = std::min(i + charLen, text.size());
+            advances.Offsets.push_back((uint32_t)i);
+            advances.Positions.push_back(x);
+        }
+
+        return advances;
+    }
+
     float Font::GetScale() const
     {
         return 1.0f / (m_AscenderY - m_DescenderY);
@@ -51,8 +117,10 @@ namespace Elixir
 
     std::optional<const SGlyph> Font::GetGlyph(const int codepoint) const
     {
-        if (m_Glyphs.contains(codepoint))
-            return std::optional(m_Glyphs.at(codepoint));
+        std::shared_lock lock(m_GlyphsMutex);
+
+        if (const auto glyph = FindGlyph(codepoint))
+            return std::optional(*glyph);
 
         return std::nullopt;
     }
@@ -69,12 +137,53 @@ namespace Elixir
         m_Kerning[key] = kerning;
     }
 
+    void Font::SetGlyphs(const std::span<const SGlyph> glyphs)
+    {
+        {
+            std::unique_lock lock(m_GlyphsMutex);
+            for (const auto& glyph : glyphs)
+            {
+                m_Glyphs[glyph.Unicode] = glyph;
+            }
+        }
+
+        m_GlyphVersion.fetch_add(1, std::memory_order_release);
+    }
+
+    std::vector<uint32_t> Font::TakeMissingGlyphs()
+    {
+        std::lock_guard lock(m_RequestsMutex);
+        return std::exchange(m_MissingGlyphs, {});
+    }
+
     void Font::InitGlyphs(const SFontCreateInfo& info)
     {
         m_Glyphs.reserve(info.Glyphs.size());
         for (const auto& glyph : info.Glyphs)
         {
             m_Glyphs[glyph.Unicode] = glyph;
+            m_RequestedGlyphs.insert(glyph.Unicode);
+
+            // Metrics are known up front, the MTSDF is generated in the background
+            if (glyph.PlaneBounds.has_value() && !glyph.AtlasBounds.has_value())
+                m_MissingGlyphs.push_back(glyph.Unicode);
         }
     }
+
+    const SGlyph* Font::FindGlyph(const int codepoint) const
+    {
+        const auto it = m_Glyphs.find(codepoint);
+        if (it != m_Glyphs.end())
+            return &it->second;
+
+        RequestGlyph(codepoint);
+        return nullptr;
+    }
+
+    void Font::RequestGlyph(const uint32_t codepoint) const
+    {
+        std::lock_guard lock(m_RequestsMutex);
+        if (m_RequestedGlyphs.insert(codepoint).second)
+            m_MissingGlyphs.push_back(codepoint);
+    }
 }
\ No newline at end of file
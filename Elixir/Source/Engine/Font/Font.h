@@ -4,6 +4,8 @@
 #include <Engine/Graphics/Definitions.h>
 #include <Engine/Graphics/Texture.h>
 
+#include <shared_mutex>
+
 namespace Elixir
 {
     using namespace Elixir::GUI;
@@ -14,6 +16,8 @@ namespace Elixir
         float Advance;
         std::optional<SRect> PlaneBounds;
         std::optional<SRect> AtlasBounds;
+        // Index of the atlas page holding the glyph in the font manager's texture set.
+        uint32_t AtlasIndex = 0;
     };
 
     struct SAtlasInfo
@@ -23,16 +27,51 @@ namespace Elixir
         int Height;
     };
 
-    struct SAtlas
+    /**
+     * Prefix advances of a string, computed once per text change so caret hit-testing and
+     * truncation can binary search instead of re-measuring substrings. Entry i holds the byte
+     * offset of the i-th character boundary and the pen position (in pixels) at it; the last
+     * entry is the end of the string.
+     */
+    struct ELIXIR_API STextAdvances
     {
-        SAtlasInfo Info;
-        Ref<Texture> MTSDF;
+        std::vector<uint32_t> Offsets = { 0 };
+        std::vector<float> Positions = { 0.0f };
+
+        /**
+         * Get the total width of the measured text in pixels.
+         * @return the pen position after the last character.
+         */
+        float GetWidth() const { return Positions.back(); }
+
+        /**
+         * Get the pen position at a byte index. Indices falling inside a multibyte
+         * character resolve to the start of that character.
+         * @param byteIndex byte index in the measured string.
+         * @return the x position in pixels, relative to the start of the text.
+         */
+        float GetPositionAt(size_t byteIndex) const;
+
+        /**
+         * Get the character boundary closest to an x position: the caret lands before a
+         * character when x is left of its midpoint, and after it otherwise.
+         * @param x the position in pixels, relative to the start of the text.
+         * @return the byte index of the boundary.
+         */
+        size_t GetIndexAtX(float x) const;
+
+        /**
+         * Get the longest prefix that fits in the given width.
+         * @param width the available width in pixels.
+         * @return the byte length of the prefix.
+         */
+        size_t GetFittingLength(float width) const;
     };
 
     struct SFontCreateInfo
     {
         std::string Name;
-        SAtlas Atlas;
+        SAtlasInfo Atlas;
         std::vector<SGlyph> Glyphs;
         float AscenderY;
         float DescenderY;
@@ -53,6 +92,14 @@ namespace Elixir
          */
         glm::vec2 MeasureText(const std::string& text, float fontSize) const;
 
+        /**
+         * Measure the pen position at every character boundary of the text, in a single pass.
+         * @param text The text to be measured
+         * @param fontSize The font size in pixels
+         * @return The prefix advances of the text, consistent with MeasureText.
+         */
+        STextAdvances MeasureAdvances(const std::string& text, float fontSize) const;
+
         float GetScale() const;
 
         /**
@@ -65,13 +112,22 @@ namespace Elixir
         float GetLineHeight(float fontSize) const;
 
         /**
-         * Get the glyph information for a given character.
+         * Get the glyph information for a given character. Glyphs are rasterized on demand:
+         * a character not generated yet is queued for generation on first lookup, and shows
+         * up in a later frame (see @ref GetGlyphVersion).
          * @param codepoint The Unicode code point of the character.
          * @return An optional containing the glyph information for the given character,
-         * or std::nullopt if the character is not found in the font.
+         * or std::nullopt if the character is not (yet) available in the font.
          */
         std::optional<const SGlyph> GetGlyph(int codepoint) const;
 
+        /**
+         * Get a counter that is bumped whenever glyphs are added to the font, so text
+         * widgets can re-measure once pending glyphs arrive.
+         * @return The current glyph version.
+         */
+        uint32_t GetGlyphVersion() const { return m_GlyphVersion.load(std::memory_order_acquire); }
+
         /**
          * Get the kerning adjustment in pixels between two characters, which is the amount of
          * horizontal space to add or subtract between the two characters when they are
@@ -97,40 +153,52 @@ namespace Elixir
         void SetKerning(int a, int b, float kerning);
 
         const std::string& GetName() const { return m_Name; }
-        const SResourceHandle& GetAtlasHandle() const { return m_AtlasHandle; }
-        const SAtlas& GetAtlas() const { return m_Atlas; }
+        const SAtlasInfo& GetAtlasInfo() const { return m_Atlas; }
         float GetAscenderY() const { return m_AscenderY; }
         float GetDescenderY() const { return m_DescenderY; }
 
         glm::vec2 GetUnitRange() const
         {
             return {
-                m_Atlas.Info.PxRange / m_Atlas.Info.Width,
-                m_Atlas.Info.PxRange / m_Atlas.Info.Height
+                m_Atlas.PxRange / m_Atlas.Width,
+                m_Atlas.PxRange / m_Atlas.Height
             };
         }
 
+      protected:
         /**
-         * Get the texture containing the multi-channel signed distance field (MTSDF) atlas
-         * for this font.
-         * @return The texture containing the MTSDF atlas for this font.
+         * Add or replace glyphs, typically once their MTSDF has been packed into the atlas.
+         * @param glyphs The glyphs to be stored.
          */
-        Ref<Texture2D> GetMTSDF() const { return std::dynamic_pointer_cast<Texture2D>(m_Atlas.MTSDF); }
+        void SetGlyphs(std::span<const SGlyph> glyphs);
 
-      protected:
-        void SetAtlasHandle(const SResourceHandle handle) { m_AtlasHandle = handle; }
+        /**
+         * Take the codepoints that were looked up but are not available yet. Each codepoint
+         * is reported only once.
+         * @return The codepoints to be generated.
+         */
+        std::vector<uint32_t> TakeMissingGlyphs();
 
       private:
         void InitGlyphs(const SFontCreateInfo& info);
 
+        // Must be called with m_GlyphsMutex held; requests the glyph when it is missing.
+        const SGlyph* FindGlyph(int codepoint) const;
+        void RequestGlyph(uint32_t codepoint) const;
+
         std::string m_Name;
 
-        // A handle to the atlas in the font manager's texture set.
-        SResourceHandle m_AtlasHandle;
-        SAtlas m_Atlas = {};
+        SAtlasInfo m_Atlas = {};
         std::unordered_map<int, SGlyph> m_Glyphs;
         std::unordered_map<uint64_t, float> m_Kerning;
 
+        // Glyphs are added from the main thread while the render thread reads them.
+        mutable std::shared_mutex m_GlyphsMutex;
+        mutable std::mutex m_RequestsMutex;
+        mutable std::unordered_set<uint32_t> m_RequestedGlyphs;
+        mutable std::vector<uint32_t> m_MissingGlyphs;
+        std::atomic<uint32_t> m_GlyphVersion = 0;
+
         float m_AscenderY = 0.0f;
         float m_DescenderY = 0.0f;
     };
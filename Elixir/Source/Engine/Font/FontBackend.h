@@ -1,9 +1,23 @@
 #pragma once
 
+#include <Engine/Core/MemoryTracker.h>
 #include <Engine/Font/Font.h>
 
 namespace Elixir
 {
+    /**
+     * The MTSDF of a single glyph, ready to be packed into the glyph atlas. Pixels are RGBA8,
+     * stored top-down; the glyph's AtlasBounds are relative to the bitmap, in y-up pixels.
+     */
+    struct SGlyphBitmap
+    {
+        std::string Font;
+        SGlyph Glyph;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        TaggedVector<EMemoryTag::Fonts, uint8_t> Pixels;
+    };
+
     class ELIXIR_API FontBackend
     {
     public:
@@ -11,9 +25,20 @@ namespace Elixir
 
         /**
          * Load a font from a file path. Supported formats: (TTF, OTF).
+         * Only the metrics are loaded, glyph bitmaps are produced by @ref GenerateGlyph.
+         * Safe to call from worker threads.
          * @param filepath The file path to the font file to be loaded.
          * @return A reference to the loaded font, or nullptr if the font cannot be loaded.
          */
         virtual Ref<Font> Load(const std::filesystem::path& filepath) = 0;
+
+        /**
+         * Generate the MTSDF of a glyph. Safe to call from worker threads.
+         * @param font The name of a font previously loaded by this backend.
+         * @param codepoint The Unicode code point of the character.
+         * @return The glyph bitmap, with no pixels for whitespace, or std::nullopt if the font
+         * has no glyph for the character.
+         */
+        virtual std::optional<SGlyphBitmap> GenerateGlyph(const std::string& font, uint32_t codepoint) = 0;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,322 @@
+#include "epch.h"
+#include "FontCache.h"
+
+#include <Engine/Core/File.h>
+
+namespace Elixir
+{
+    // File layout: header, glyph records, kerning pairs, pixels. Every section is 8-byte
+    // aligned so records can be read in place from the mapping.
+    struct FontCache::SHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t Key;
+        double GeometryScale;
+        float AscenderY;
+        float DescenderY;
+        uint32_t GlyphCount;
+        uint32_t KerningCount;
+        uint64_t PixelsSize;
+    };
+
+    struct FontCache::SGlyphRecord
+    {
+        int32_t Unicode;
+        float Advance;
+        uint32_t HasPlaneBounds;
+        uint32_t HasBitmap;
+        float PlaneBounds[4];
+        float AtlasBounds[4];
+        uint32_t Width;
+        uint32_t Height;
+        uint64_t PixelsOffset;
+    };
+
+    static_assert(std::is_trivially_copyable_v<SKerningPair>);
+
+    static size_t AlignUp(const size_t size)
+    {
+        return (size + 7) & ~size_t(7);
+    }
+
+    static void ToFloats(const SRect& rect, float (&out)[4])
+    {
+        out[0] = rect.Position.x;
+        out[1] = rect.Position.y;
+        out[2] = rect.Size.x;
+        out[3] = rect.Size.y;
+    }
+
+    static SRect ToRect(const float (&in)[4])
+    {
+        return SRect{ { in[0], in[1] }, { in[2], in[3] } };
+    }
+
+    // Checks 4 * Width * Height bytes from the offset fit the pixels, without overflowing
+    static bool FitsInPixels(const uint64_t offset, const uint32_t width, const uint32_t height, const uint64_t pixelsSize)
+    {
+        if (offset > pixelsSize) return false;
+        if (width == 0 || height == 0) return true;
+
+        return height <= (pixelsSize - offset) / 4 / width;
+    }
+
+    uint64_t FontCache::ComputeKey(
+        const std::span<const Byte> fontData,
+        const std::span<const Byte> charset,
+        const float pxRange,
+        const double glyphScale
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        uint64_t key = Hash::HashBytes(&VERSION, sizeof(VERSION));
+        key = Hash::HashBytes(fontData.data(), fontData.size(), key);
+        key = Hash::HashBytes(charset.data(), charset.size(), key);
+        key = Hash::HashBytes(&pxRange, sizeof(pxRange), key);
+        key = Hash::HashBytes(&glyphScale, sizeof(glyphScale), key);
+        return key;
+    }
+
+    std::filesystem::path FontCache::GetPath(const std::string& name, const uint64_t key)
+    {
+        return DIRECTORY / std::format("{0}-{1:016x}.mtsdf", name, key);
+    }
+
+    bool FontCache::Write(
+        const std::filesystem::path& filepath,
+        const uint64_t key,
+        const SFontCacheData& data
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        std::unordered_map<int, const SGlyphBitmap*> bitmaps;
+        for (const auto& bitmap : data.Bitmaps)
+            bitmaps[bitmap.Glyph.Unicode] = &bitmap;
+
+        std::vector<SGlyphRecord> records;
+        records.reserve(data.Info.Glyphs.size());
+
+        uint64_t pixelsSize = 0;
+        for (const auto& glyph : data.Info.Glyphs)
+        {
+            SGlyphRecord record = {};
+            record.Unicode = glyph.Unicode;
+            record.Advance = glyph.Advance;
+
+            if (glyph.PlaneBounds.has_value())
+            {
+                record.HasPlaneBounds = 1;
+                ToFloats(glyph.PlaneBounds.value(), record.PlaneBounds);
+            }
+
+            const auto it = bitmaps.find(glyph.Unicode);
+            if (it != bitmaps.end() && it->second->Glyph.AtlasBounds.has_value())
+            {
+                const auto& bitmap = *it->second;
+                record.HasBitmap = 1;
+                ToFloats(bitmap.Glyph.AtlasBounds.value(), record.AtlasBounds);
+                record.Width = bitmap.Width;
+                record.Height = bitmap.Height;
+                record.PixelsOffset = pixelsSize;
+                pixelsSize += bitmap.Pixels.size();
+            }
+
+            records.push_back(record);
+        }
+
+        SHeader header = {};
+        header.Magic = MAGIC;
+        header.Version = VERSION;
+        header.Key = key;
+        header.GeometryScale = data.GeometryScale;
+        header.AscenderY = data.Info.AscenderY;
+        header.DescenderY = data.Info.DescenderY;
+        header.GlyphCount = (uint32_t)records.size();
+        header.KerningCount = (uint32_t)data.Kerning.size();
+        header.PixelsSize = pixelsSize;
+
+        std::vector<Byte> file;
+        file.reserve(
+            AlignUp(sizeof(header)) +
+            AlignUp(records.size() * sizeof(SGlyphRecord)) +
+            AlignUp(data.Kerning.size() * sizeof(SKerningPair)) +
+            pixelsSize
+        );
+
+        const auto append = [&](const void* section, const size_t size)
+        {
+            const auto bytes = (const Byte*)section;
+            file.insert(file.end(), bytes, bytes + size);
+        };
+
+        const auto appendSection = [&](const void* section, const size_t size)
+        {
+            append(section, size);
+            file.resize(AlignUp(file.size()));
+        };
+
+        appendSection(&header, sizeof(header));
+        appendSection(records.data(), records.size() * sizeof(SGlyphRecord));
+        appendSection(data.Kerning.data(), data.Kerning.size() * sizeof(SKerningPair));
+
+        for (const auto& record : records)
+        {
+            if (!record.HasBitmap) continue;
+            const auto& pixels = bitmaps[record.Unicode]->Pixels;
+            append(pixels.data(), pixels.size());
+        }
+
+        if (!WriteFileAtomic(filepath, file))
+        {
+            EE_CORE_WARN("Cannot write font cache! [Path={0}]", filepath.string())
+            return false;
+        }
+
+        EE_CORE_TRACE("Font cache written [Path={0}, Glyphs={1}].", filepath.string(), records.size())
+        return true;
+    }
+
+    Scope<FontCache> FontCache::Open(const std::filesystem::path& filepath, const uint64_t key)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        auto file = MappedFile::Open(filepath);
+        if (!file || file->GetSize() < sizeof(SHeader))
+            return nullptr;
+
+        const auto header = (const SHeader*)file->GetData();
+        if (header->Magic != MAGIC || header->Version != VERSION || header->Key != key)
+            return nullptr;
+
+        const size_t sectionsSize =
+            AlignUp(sizeof(SHeader)) +
+            AlignUp((size_t)header->GlyphCount * sizeof(SGlyphRecord)) +
+            AlignUp((size_t)header->KerningCount * sizeof(SKerningPair));
+
+        if (file->GetSize() < sectionsSize || file->GetSize() - sectionsSize != header->PixelsSize)
+        {
+            EE_CORE_WARN("Ignoring corrupted font cache! [Path={0}]", filepath.string())
+            return nullptr;
+        }
+
+        // Bitmaps are copied straight out of the mapping, so every one must lie in the pixels
+        const auto records = (const SGlyphRecord*)(file->GetData() + AlignUp(sizeof(SHeader)));
+        for (uint32_t i = 0; i < header->GlyphCount; i++)
+        {
+            const auto& record = records[i];
+            if (record.HasBitmap && !FitsInPixels(record.PixelsOffset, record.Width, record.Height, header->PixelsSize))
+            {
+                EE_CORE_WARN("Ignoring corrupted font cache! [Path={0}, Glyph={1}]", filepath.string(), record.Unicode)
+                return nullptr;
+            }
+        }
+
+        return Scope<FontCache>(new FontCache(std::move(file)));
+    }
+
+    FontCache::FontCache(Scope<MappedFile> file)
+        : m_File(std::move(file))
+    {
+        const auto records = GetGlyphRecords();
+        const auto count = GetHeader()->GlyphCount;
+
+        m_Glyphs.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_Glyphs[records[i].Unicode] = &records[i];
+        }
+    }
+
+    SFontCreateInfo FontCache::GetCreateInfo(const std::string& name) const
+    {
+        const auto header = GetHeader();
+
+        SFontCreateInfo info = {};
+        info.Name = name;
+        info.AscenderY = header->AscenderY;
+        info.DescenderY = header->DescenderY;
+
+        const auto records = GetGlyphRecords();
+        info.Glyphs.reserve(header->GlyphCount);
+        for (uint32_t i = 0; i < header->GlyphCount; i++)
+        {
+            const auto& record = records[i];
+
+            SGlyph glyph;
+            glyph.Unicode = record.Unicode;
+            glyph.Advance = record.Advance;
+            if (record.HasPlaneBounds)
+                glyph.PlaneBounds = ToRect(record.PlaneBounds);
+
+            info.Glyphs.push_back(glyph);
+        }
+
+        return info;
+    }
+
+    std::vector<SKerningPair> FontCache::GetKerning() const
+    {
+        const auto pairs = GetKerningPairs();
+        return { pairs, pairs + GetHeader()->KerningCount };
+    }
+
+    double FontCache::GetGeometryScale() const
+    {
+        return GetHeader()->GeometryScale;
+    }
+
+    std::optional<SGlyphBitmap> FontCache::GetGlyphBitmap(
+        const std::string& font,
+        const uint32_t codepoint
+    ) const
+    {
+        const auto it = m_Glyphs.find(codepoint);
+        if (it == m_Glyphs.end() || !it->second->HasBitmap)
+            return std::nullopt;
+
+        const auto& record = *it->second;
+
+        SGlyphBitmap bitmap;
+        bitmap.Font = font;
+        bitmap.Glyph.Unicode = record.Unicode;
+        bitmap.Glyph.Advance = record.Advance;
+        bitmap.Glyph.PlaneBounds = ToRect(record.PlaneBounds);
+        bitmap.Glyph.AtlasBounds = ToRect(record.AtlasBounds);
+        bitmap.Width = record.Width;
+        bitmap.Height = record.Height;
+
+        const auto pixels = (const uint8_t*)(GetPixels() + record.PixelsOffset);
+        bitmap.Pixels.assign(pixels, pixels + (size_t)4 * record.Width * record.Height);
+        return bitmap;
+    }
+
+    const FontCache::SHeader* FontCache::GetHeader() const
+    {
+        return (const SHeader*)m_File->GetData();
+    }
+
+    const FontCache::SGlyphRecord* FontCache::GetGlyphRecords() const
+    {
+        return (const SGlyphRecord*)(m_File->GetData() + AlignUp(sizeof(SHeader)));
+    }
+
+    const SKerningPair* FontCache::GetKerningPairs() const
+    {
+        const auto offset =
+            AlignUp(sizeof(SHeader)) +
+            AlignUp(GetHeader()->GlyphCount * sizeof(SGlyphRecord));
+        return (const SKerningPair*)(m_File->GetData() + offset);
+    }
+
+    const Byte* FontCache::GetPixels() const
+    {
+        const auto offset =
+            AlignUp(sizeof(SHeader)) +
+            AlignUp(GetHeader()->GlyphCount * sizeof(SGlyphRecord)) +
+            AlignUp(GetHeader()->KerningCount * sizeof(SKerningPair));
+        return m_File->GetData() + offset;
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Engine/Core/MappedFile.h>
+#include <Engine/Font/FontBackend.h>
+
+namespace Elixir
+{
+    struct SKerningPair
+    {
+        int A;
+        int B;
+        float Kerning;
+    };
+
+    /**
+     * Everything needed to rebuild a font without FreeType/msdfgen work: its metrics,
+     * kerning and the MTSDF bitmaps of its base charset.
+     */
+    struct SFontCacheData
+    {
+        SFontCreateInfo Info;
+        double GeometryScale = 1.0;
+        std::vector<SKerningPair> Kerning;
+        std::vector<SGlyphBitmap> Bitmaps;
+    };
+
+    /**
+     * On-disk cache of generated fonts. The file is keyed by the font file contents and the
+     * generation settings, so editing the font or changing the charset/pixel range
+     * invalidates it. Cache files are memory mapped, glyph bitmaps are copied out of the
+     * mapping only when the glyph is requested.
+     */
+    class ELIXIR_API FontCache
+    {
+      public:
+        static constexpr uint32_t MAGIC = 0x544E4645; // "EFNT"
+        static constexpr uint32_t VERSION = 1;
+        static inline const std::filesystem::path DIRECTORY = "./Cache/Fonts";
+
+        /**
+         * Compute the cache key of a font.
+         * @param fontData The contents of the font file.
+         * @param charset The charset description the cache is generated for.
+         * @param pxRange The distance field range in pixels.
+         * @param glyphScale The glyph scale in pixels per em.
+         * @return The cache key.
+         */
+        static uint64_t ComputeKey(
+            std::span<const Byte> fontData,
+            std::span<const Byte> charset,
+            float pxRange,
+            double glyphScale
+        );
+
+        static std::filesystem::path GetPath(const std::string& name, uint64_t key);
+
+        /**
+         * Write a cache file, replacing the existing one atomically.
+         * @param filepath The cache file path.
+         * @param key The cache key of the font.
+         * @param data The font data to be cached.
+         * @return true if the file was written.
+         */
+        static bool Write(const std::filesystem::path& filepath, uint64_t key, const SFontCacheData& data);
+
+        /**
+         * Open a cache file.
+         * @param filepath The cache file path.
+         * @param key The expected cache key.
+         * @return The cache, or nullptr if the file is missing, stale or corrupted.
+         */
+        static Scope<FontCache> Open(const std::filesystem::path& filepath, uint64_t key);
+
+        /**
+         * Get the font create info, with glyph metrics but no atlas placement.
+         * @param name The font name.
+         */
+        SFontCreateInfo GetCreateInfo(const std::string& name) const;
+
+        std::vector<SKerningPair> GetKerning() const;
+        double GetGeometryScale() const;
+
+        /**
+         * Copy a cached glyph bitmap out of the mapping.
+         * @param font The font name to tag the bitmap with.
+         * @param codepoint The Unicode code point of the character.
+         * @return The glyph bitmap, or std::nullopt if the glyph is not cached.
+         */
+        std::optional<SGlyphBitmap> GetGlyphBitmap(const std::string& font, uint32_t codepoint) const;
+
+      private:
+        struct SHeader;
+        struct SGlyphRecord;
+
+        explicit FontCache(Scope<MappedFile> file);
+
+        const SHeader* GetHeader() const;
+        const SGlyphRecord* GetGlyphRecords() const;
+        const SKerningPair* GetKerningPairs() const;
+        const Byte* GetPixels() const;
+
+        Scope<MappedFile> m_File;
+        std::unordered_map<uint32_t, const SGlyphRecord*> m_Glyphs;
+    };
+}
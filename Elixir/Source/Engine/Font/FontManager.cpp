@@ -1,13 +1,50 @@
 #include "epch.h"
 #include "FontManager.h"
 
+#include <Engine/Core/Executor/Executor.h>
 #include <Platform/FreeType/FreeTypeFontBackend.h>
 
 namespace Elixir
 {
+    bool FontFuture::IsReady() const
+    {
+        return m_Future.valid() &&
+            m_Future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    Ref<Font> FontFuture::Get() const
+    {
+        if (IsReady())
+        {
+            try
+            {
+                if (auto font = m_Future.get())
+                    return font;
+            }
+            catch (const std::exception&)
+            {
+                // Failed loads fall back to the default font, Update reports them
+            }
+        }
+
+        return FontManager::GetDefaultFont();
+    }
+
+    Ref<Font> FontFuture::Wait() const
+    {
+        EE_CORE_ASSERT(m_Future.valid(), "Waiting on an invalid FontFuture!")
+        return m_Future.get();
+    }
+
     bool FontManager::s_Initialized = false;
     Scope<FontBackend> FontManager::s_FontBackend = nullptr;
     Ref<TextureSet> FontManager::s_FontsAtlases = nullptr;
+    Scope<GlyphAtlas> FontManager::s_GlyphAtlas = nullptr;
+    std::vector<SGlyphBitmap> FontManager::s_GeneratedGlyphs;
+    std::mutex FontManager::s_GeneratedGlyphsMutex;
+    WaitGroup FontManager::s_GenerationWaitGroup;
+    std::unordered_map<std::string, std::shared_future<Ref<Font>>> FontManager::s_PendingLoads;
+    WaitGroup FontManager::s_LoadWaitGroup;
     std::unordered_map<std::string, Ref<Font>> FontManager::s_Fonts;
     const GraphicsContext* FontManager::s_GraphicsContext = nullptr;
 
@@ -18,8 +55,9 @@ namespace Elixir
         if (!s_Initialized)
         {
             s_GraphicsContext = context;
-            s_FontBackend = CreateScope<FreeTypeFontBackend>(s_GraphicsContext);
+            s_FontBackend = CreateScope<FreeTypeFontBackend>();
             s_FontsAtlases = TextureSet::Create(context);
+            s_GlyphAtlas = CreateScope<GlyphAtlas>(context, s_FontsAtlases);
             s_Initialized = true;
             EE_CORE_INFO("Font Manager initialized.")
 
@@ -31,13 +69,96 @@ namespace Elixir
     void FontManager::Shutdown()
     {
         EE_PROFILE_ZONE_SCOPED()
+
+        // Load and generation tasks reference the backend
+        s_LoadWaitGroup.Wait();
+        s_GenerationWaitGroup.Wait();
+        s_PendingLoads.clear();
+        s_GeneratedGlyphs.clear();
+
         s_Fonts.clear();
+        s_GlyphAtlas.reset();
         s_FontsAtlases.reset();
         s_FontBackend.reset();
         s_Initialized = false;
         EE_CORE_INFO("Font Manager shutdown.")
     }
 
+    void FontManager::Update()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        MemoryTagScope tag(EMemoryTag::Fonts);
+
+        // Register the fonts loaded in the background
+        for (auto it = s_PendingLoads.begin(); it != s_PendingLoads.end();)
+        {
+            if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++it;
+                continue;
+            }
+
+            try
+            {
+                if (const auto& font = it->second.get())
+                    Register(it->first, font);
+            }
+            catch (const std::exception& e)
+            {
+                EE_CORE_ERROR("Cannot load font! [Name={0}, Error={1}]", it->first, e.what())
+            }
+
+            it = s_PendingLoads.erase(it);
+        }
+
+        // Dispatch the glyphs looked up since the last update
+        for (const auto& font : s_Fonts | std::views::values)
+        {
+            const auto missing = font->TakeMissingGlyphs();
+            for (size_t i = 0; i < missing.size(); i += GLYPHS_PER_TASK)
+            {
+                const auto end = std::min(i + GLYPHS_PER_TASK, missing.size());
+                std::vector batch(missing.begin() + i, missing.begin() + end);
+
+                Executor::Get().Enqueue([name = font->GetName(), batch = std::move(batch)]()
+                {
+                    std::vector<SGlyphBitmap> bitmaps;
+                    bitmaps.reserve(batch.size());
+                    for (const auto codepoint : batch)
+                    {
+                        if (auto bitmap = s_FontBackend->GenerateGlyph(name, codepoint))
+                            bitmaps.push_back(std::move(*bitmap));
+                    }
+
+                    std::lock_guard lock(s_GeneratedGlyphsMutex);
+                    std::ranges::move(bitmaps, std::back_inserter(s_GeneratedGlyphs));
+                }, &s_GenerationWaitGroup);
+            }
+        }
+
+        // Pack the finished glyphs into the atlas and hand them to their fonts
+        std::vector<SGlyphBitmap> generated;
+        {
+            std::lock_guard lock(s_GeneratedGlyphsMutex);
+            generated.swap(s_GeneratedGlyphs);
+        }
+
+        if (generated.empty()) return;
+
+        s_GlyphAtlas->Insert(generated);
+
+        std::unordered_map<std::string, std::vector<SGlyph>> glyphs;
+        for (const auto& bitmap : generated)
+            glyphs[bitmap.Font].push_back(bitmap.Glyph);
+
+        for (const auto& [name, fontGlyphs] : glyphs)
+        {
+            const auto it = s_Fonts.find(name);
+            if (it != s_Fonts.end())
+                it->second->SetGlyphs(fontGlyphs);
+        }
+    }
+
     Ref<Font> FontManager::GetDefaultFont()
     {
         EE_PROFILE_ZONE_SCOPED()
@@ -73,17 +194,72 @@ namespace Elixir
         if (it != s_Fonts.end())
             return it->second;
 
-        // If not found, call the backend to load it
+        // Already loading in the background, finish it here
+        const auto pending = s_PendingLoads.find(name);
+        if (pending != s_PendingLoads.end())
+        {
+            // Taken out first, so a failed load throws without leaving it pending
+            const auto future = std::move(pending->second);
+            s_PendingLoads.erase(pending);
+
+            const auto font = future.get();
+            if (font) Register(name, font);
+            return font;
+        }
+
+        // If not found, call the backend to load it; glyph MTSDFs are generated on the
+        // next updates
         EE_CORE_TRACE("Loading font: {0}", filepath.string())
         const auto font = s_FontBackend->Load(filepath);
+        if (!font) return nullptr;
+
+        Register(name, font);
+        return font;
+    }
+
+    FontFuture FontManager::LoadAsync(const std::filesystem::path& filepath)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        const auto name = filepath.stem().string();
+
+        const auto it = s_Fonts.find(name);
+        if (it != s_Fonts.end())
+        {
+            std::promise<Ref<Font>> loaded;
+            loaded.set_value(it->second);
+            return FontFuture(loaded.get_future().share());
+        }
+
+        const auto pending = s_PendingLoads.find(name);
+        if (pending != s_PendingLoads.end())
+            return FontFuture(pending->second);
 
-        // Bind the atlas to atlases texture set and save the returned index
-        const auto handle = s_FontsAtlases->AddTexture(font->GetMTSDF());
-        font->SetAtlasHandle(handle);
+        EE_CORE_TRACE("Loading font in background: {0}", filepath.string())
 
-        EE_CORE_TRACE("Loaded font: {0}", filepath.string())
-        s_Fonts[name] = std::move(font);
-        return s_Fonts[name];
+        std::promise<Ref<Font>> promise;
+        auto future = promise.get_future().share();
+
+        Executor::Get().Enqueue(ETaskPriority::Background, [filepath, promise = std::move(promise)]() mutable
+        {
+            try
+            {
+                promise.set_value(s_FontBackend->Load(filepath));
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+            }
+        }, &s_LoadWaitGroup);
+
+        s_PendingLoads[name] = future;
+        return FontFuture(future);
+    }
+
+    void FontManager::Register(const std::string& name, const Ref<Font>& font)
+    {
+        EE_CORE_TRACE("Loaded font: {0}", name)
+        s_Fonts[name] = font;
     }
 
     glm::vec2 FontManager::MeasureText(
@@ -96,6 +272,16 @@ namespace Elixir
         return font->MeasureText(text, fontSize);
     }
 
+    STextAdvances FontManager::MeasureAdvances(
+        const std::string& text,
+        const Ref<Font>& font,
+        const float fontSize
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        return font->MeasureAdvances(text, fontSize);
+    }
+
     float FontManager::GetLineHeight(const Ref<Font>& font, const float fontSize)
     {
         EE_PROFILE_ZONE_SCOPED()
@@ -2,19 +2,71 @@
 
 #include "Engine/Graphics/TextureSet.h"
 
+#include <Engine/Core/Executor/WaitGroup.h>
 #include <Engine/Font/Font.h>
 #include <Engine/Font/FontBackend.h>
+#include <Engine/Font/GlyphAtlas.h>
+
+#include <future>
+
+class FontManagerTest;
 
 namespace Elixir
 {
+    /**
+     * Handle to a font loaded in the background by @ref FontManager::LoadAsync. Until the
+     * font is ready, Get returns the default font so text can be laid out right away.
+     */
+    class ELIXIR_API FontFuture
+    {
+        friend class FontManager;
+      public:
+        FontFuture() = default;
+
+        bool IsValid() const { return m_Future.valid(); }
+
+        /**
+         * Check whether the load has finished, successfully or not.
+         * @return true if the load has finished.
+         */
+        bool IsReady() const;
+
+        /**
+         * Get the font without blocking.
+         * @return The loaded font, or the default font while loading or if the load failed.
+         */
+        Ref<Font> Get() const;
+
+        /**
+         * Block until the load has finished. Rethrows the exception the load threw, if any.
+         * @return The loaded font, or nullptr if the font cannot be loaded.
+         */
+        Ref<Font> Wait() const;
+
+      private:
+        explicit FontFuture(std::shared_future<Ref<Font>> future)
+            : m_Future(std::move(future)) {}
+
+        std::shared_future<Ref<Font>> m_Future;
+    };
+
     class ELIXIR_API FontManager
     {
+        friend class ::FontManagerTest;
       public:
         static inline const std::string DEFAULT_FONT_NAME = "SF-Pro-Display-Regular";
+        static constexpr size_t GLYPHS_PER_TASK = 16;
 
         static void Initialize(const GraphicsContext* context);
         static void Shutdown();
 
+        /**
+         * Dispatch the glyphs requested since the last update to the worker threads, and
+         * pack the glyphs they finished into the atlas. Must be called once per frame from
+         * the main thread, before the GUI is updated.
+         */
+        static void Update();
+
         /**
          * Get the default font.
          * @return A reference to the default font.
@@ -36,6 +88,15 @@ namespace Elixir
          */
         static Ref<Font> Load(const std::filesystem::path& filepath);
 
+        /**
+         * Load a font from a file path on a worker thread. Several fonts loaded this way are
+         * loaded concurrently. The font is registered (see @ref GetFont) and its glyphs
+         * start generating on the first @ref Update after it is ready.
+         * @param filepath The file path to the font file to be loaded.
+         * @return A handle to the font being loaded.
+         */
+        static FontFuture LoadAsync(const std::filesystem::path& filepath);
+
         /**
          * Measure the width and height of the rendered text in pixels, based on the font
          * metrics.
@@ -50,6 +111,20 @@ namespace Elixir
             float fontSize
         );
 
+        /**
+         * Measure the pen position at every character boundary of the text, in a single pass.
+         * Cache the result per text change and query it instead of measuring substrings.
+         * @param text The text to be measured
+         * @param font The font used to display the text
+         * @param fontSize The font size in pixels
+         * @return The prefix advances of the text.
+         */
+        static STextAdvances MeasureAdvances(
+            const std::string& text,
+            const Ref<Font>& font,
+            float fontSize
+        );
+
         /**
          * Get the line height in pixels, which is the distance from the baseline of one
          * line of text.
@@ -61,8 +136,8 @@ namespace Elixir
         static float GetLineHeight(const Ref<Font>& font, float fontSize);
 
         /**
-         * Get the TextureSet containing all loaded font atlases.
-         * @return The TextureSet containing all loaded font atlases.
+         * Get the TextureSet containing the glyph atlas pages of all loaded fonts.
+         * @return The TextureSet containing the glyph atlas pages.
          */
         static Ref<TextureSet> GetAtlasesTextureSet() { return s_FontsAtlases; }
 
@@ -71,9 +146,17 @@ namespace Elixir
         FontManager(const FontManager&) = delete;
         FontManager& operator=(const FontManager&) = delete;
 
+        static void Register(const std::string& name, const Ref<Font>& font);
+
         static bool s_Initialized;
         static Scope<FontBackend> s_FontBackend;
         static Ref<TextureSet> s_FontsAtlases;
+        static Scope<GlyphAtlas> s_GlyphAtlas;
+        static std::vector<SGlyphBitmap> s_GeneratedGlyphs;
+        static std::mutex s_GeneratedGlyphsMutex;
+        static WaitGroup s_GenerationWaitGroup;
+        static std::unordered_map<std::string, std::shared_future<Ref<Font>>> s_PendingLoads;
+        static WaitGroup s_LoadWaitGroup;
         static std::unordered_map<std::string, Ref<Font>> s_Fonts;
         static const GraphicsContext* s_GraphicsContext;
     };
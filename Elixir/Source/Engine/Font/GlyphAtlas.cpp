@@ -0,0 +1,145 @@
+#include "epch.h"
+#include "GlyphAtlas.h"
+
+#include <Engine/Font/FontBackend.h>
+#include <Engine/Graphics/Buffer.h>
+#include <Engine/Graphics/CommandBuffer.h>
+#include <Engine/Graphics/GraphicsContext.h>
+
+namespace Elixir
+{
+    GlyphAtlas::GlyphAtlas(const GraphicsContext* context, const Ref<TextureSet>& textureSet)
+        : m_TextureSet(textureSet), m_GraphicsContext(context)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+    }
+
+    void GlyphAtlas::Insert(const std::span<SGlyphBitmap> bitmaps)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        size_t size = 0;
+        for (const auto& bitmap : bitmaps)
+            size += bitmap.Pixels.size();
+
+        if (size == 0) return;
+
+        std::vector<uint8_t> staging;
+        staging.reserve(size);
+
+        // Copy regions grouped by page
+        std::vector<std::vector<SBufferImageCopy>> regions;
+
+        for (auto& bitmap : bitmaps)
+        {
+            if (bitmap.Pixels.empty()) continue;
+
+            const auto [page, x, y] = Allocate(bitmap.Width, bitmap.Height);
+            if (regions.size() < m_Pages.size())
+                regions.resize(m_Pages.size());
+
+            auto region = SBufferImageCopy::Default({ bitmap.Width, bitmap.Height, 1 });
+            region.BufferOffset = staging.size();
+            region.ImageOffset = { (int32_t)x, (int32_t)y, 0 };
+            regions[page].push_back(region);
+
+            staging.insert(staging.end(), bitmap.Pixels.begin(), bitmap.Pixels.end());
+
+            // Bitmap-relative y-up bounds to page y-up bounds; the page is stored top-down
+            const glm::vec2 offset = { (float)x, (float)(PAGE_SIZE - y - bitmap.Height) };
+            auto& bounds = bitmap.Glyph.AtlasBounds.value();
+            bounds.Position += offset;
+            bounds.Size += offset;
+            bitmap.Glyph.AtlasIndex = m_Pages[page].Handle.Index;
+        }
+
+        const auto stagingBuffer = StagingBuffer::Create(m_GraphicsContext, staging.size(), staging.data());
+
+        const auto cmd = m_GraphicsContext->GetUploadCommandBuffer();
+        cmd->Begin();
+
+        for (size_t page = 0; page < regions.size(); page++)
+        {
+            if (regions[page].empty()) continue;
+
+            const auto& texture = m_Pages[page].Texture;
+            texture->Transition(cmd, EImageLayout::TransferDst);
+            texture->CopyFrom(cmd, stagingBuffer, regions[page]);
+            texture->Transition(cmd, EImageLayout::ShaderReadOnly);
+        }
+
+        cmd->Flush();
+        stagingBuffer->Destroy();
+    }
+
+    GlyphAtlas::SAllocation GlyphAtlas::Allocate(const uint32_t width, const uint32_t height)
+    {
+        EE_CORE_ASSERT(
+            width + PADDING <= PAGE_SIZE && height + PADDING <= PAGE_SIZE,
+            "Glyph does not fit in an atlas page!"
+        )
+
+        // Only the last page can have room left, older pages were full when it was added
+        uint32_t x, y;
+        if (m_Pages.empty() || !AllocateInPage(m_Pages.back(), width, height, x, y))
+        {
+            AddPage();
+            AllocateInPage(m_Pages.back(), width, height, x, y);
+        }
+
+        return { (uint32_t)m_Pages.size() - 1, x, y };
+    }
+
+    bool GlyphAtlas::AllocateInPage(
+        SPage& page,
+        const uint32_t width,
+        const uint32_t height,
+        uint32_t& x,
+        uint32_t& y
+    )
+    {
+        const uint32_t paddedWidth = width + PADDING;
+        const uint32_t paddedHeight = height + PADDING;
+
+        // First shelf that is tall enough and has room left
+        for (auto& shelf : page.Shelves)
+        {
+            if (paddedHeight <= shelf.Height && shelf.Width + paddedWidth <= PAGE_SIZE)
+            {
+                x = shelf.Width;
+                y = shelf.Y;
+                shelf.Width += paddedWidth;
+                return true;
+            }
+        }
+
+        if (page.Height + paddedHeight > PAGE_SIZE)
+            return false;
+
+        page.Shelves.push_back({ page.Height, paddedHeight, paddedWidth });
+        x = 0;
+        y = page.Height;
+        page.Height += paddedHeight;
+        return true;
+    }
+
+    void GlyphAtlas::AddPage()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        // Start from a cleared page so filtering at glyph edges never samples garbage
+        const std::vector<uint8_t> clear((size_t)PAGE_SIZE * PAGE_SIZE * 4, 0);
+
+        SPage page;
+        page.Texture = Texture2D::Create(
+            m_GraphicsContext,
+            EImageFormat::R8G8B8A8_UNORM,
+            PAGE_SIZE, PAGE_SIZE,
+            clear.data()
+        );
+        page.Handle = m_TextureSet->AddTexture(page.Texture);
+
+        EE_CORE_TRACE("Glyph atlas page added [Pages = {0}].", m_Pages.size() + 1)
+        m_Pages.push_back(std::move(page));
+    }
+}
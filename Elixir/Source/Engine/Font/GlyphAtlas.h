@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Engine/Graphics/Texture.h>
+#include <Engine/Graphics/TextureSet.h>
+
+namespace Elixir
+{
+    struct SGlyphBitmap;
+
+    /**
+     * Glyph atlas shared by all fonts. Glyph MTSDFs are packed on shelves into fixed-size
+     * pages and uploaded in place; when a page is full a new one is appended to the texture
+     * set, so glyphs already placed (and their texture handles) never move.
+     */
+    class ELIXIR_API GlyphAtlas
+    {
+      public:
+        static constexpr uint32_t PAGE_SIZE = 1024;
+        static constexpr uint32_t PADDING = 1;
+
+        GlyphAtlas(const GraphicsContext* context, const Ref<TextureSet>& textureSet);
+
+        /**
+         * Pack a batch of glyph bitmaps and upload them with a single transfer. On return
+         * each glyph's AtlasBounds are in page pixels (y-up) and AtlasIndex refers to the page
+         * in the texture set. Bitmaps with no pixels are left untouched.
+         * @param bitmaps The glyph bitmaps to be packed.
+         */
+        void Insert(std::span<SGlyphBitmap> bitmaps);
+
+        uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+
+      private:
+        struct SShelf
+        {
+            uint32_t Y;
+            uint32_t Height;
+            uint32_t Width;
+        };
+
+        struct SPage
+        {
+            Ref<Texture2D> Texture;
+            SResourceHandle Handle;
+            std::vector<SShelf> Shelves;
+            uint32_t Height = 0;
+        };
+
+        struct SAllocation
+        {
+            uint32_t Page;
+            uint32_t X, Y;
+        };
+
+        SAllocation Allocate(uint32_t width, uint32_t height);
+        static bool AllocateInPage(SPage& page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+        void AddPage();
+
+        std::vector<SPage> m_Pages;
+        Ref<TextureSet> m_TextureSet;
+
+        const GraphicsContext* m_GraphicsContext;
+    };
+}
@@ -14,6 +14,18 @@ namespace Elixir::GUI
         m_DesiredSize = { 120.0f, 40.0f };
     }
 
+    void Button::Update(const Timestep frameTime)
+    {
+        ContentWidget::Update(frameTime);
+
+        // Redraw the label once glyphs generated since the last draw are available
+        if (m_GlyphVersion != m_Font->GetGlyphVersion())
+        {
+            m_GlyphVersion = m_Font->GetGlyphVersion();
+            MarkRenderDirty();
+        }
+    }
+
     glm::vec2 Button::ComputeDesiredSize()
     {
         return m_DesiredSize;
@@ -101,7 +113,7 @@ namespace Elixir::GUI
     {
         if (HasContent())
         {
-            const glm::vec2 childSize = m_ContentSlot->GetWidget()->ComputeDesiredSize();
+            const glm::vec2 childSize = m_ContentSlot->GetWidget()->Measure();
             const SRect innerSpace = ApplyPadding(allocatedSpace, m_Padding);
 
             const SRect childRect  = AlignChild(
@@ -171,26 +183,19 @@ namespace Elixir::GUI
 
     std::string Button::ProcessText(const std::string& text, const float availableWidth)
     {
-        auto size = FontManager::MeasureText(text, m_Font, m_FontSize);
-        if (size.x <= availableWidth)
+        const auto advances = FontManager::MeasureAdvances(text, m_Font, m_FontSize);
+        if (advances.GetWidth() <= availableWidth)
             return text;
 
-        std::string ellipsis = "...";
+        const std::string ellipsis = "...";
         const float ellipsisWidth = FontManager::MeasureText(ellipsis, m_Font, m_FontSize).x;
 
         if (ellipsisWidth >= availableWidth)
             return ellipsis;
 
-        std::string truncated = text;
-        while (!truncated.empty())
-        {
-            UTF8::UTF8RemoveLastChar(truncated);
-            size = FontManager::MeasureText(truncated, m_Font, m_FontSize);
-            if (size.x + ellipsisWidth <= availableWidth)
-                return truncated + ellipsis;
-        }
-
-        return ellipsis;
+        // Longest prefix that still leaves room for the ellipsis
+        const auto length = advances.GetFittingLength(availableWidth - ellipsisWidth);
+        return text.substr(0, length) + ellipsis;
     }
 
     glm::vec2 Button::MeasureTextSize(const std::string& text)
@@ -10,6 +10,8 @@ namespace Elixir::GUI
       public:
         explicit Button(const std::string& text = "");
 
+        void Update(Timestep frameTime) override;
+
         glm::vec2 ComputeDesiredSize() override;
 
         const std::string& GetText() const { return m_Text; }
@@ -76,6 +78,8 @@ namespace Elixir::GUI
         SColor m_TextColor{1.0f, 0.0f, 0.0f, 1.0f};
         Ref<Font> m_Font;
         float m_FontSize = 16.0f;
+        // Font glyph version the label was last drawn with
+        uint32_t m_GlyphVersion = 0;
 
         SPadding m_Padding;
 
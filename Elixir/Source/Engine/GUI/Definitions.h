@@ -19,6 +19,22 @@ namespace Elixir::GUI
             return Position.x != -1 && Position.y != -1 && Size.x != -1 && Size.y != -1;
         }
 
+        /**
+         * Intersect two rects, treating an invalid rect as unbounded (the "no scissor" value
+         * of draw commands). Disjoint rects produce an empty rect.
+         * @param other rect to intersect with.
+         * @return the overlapping area.
+         */
+        SRect Intersect(const SRect& other) const
+        {
+            if (!IsValid()) return other;
+            if (!other.IsValid()) return *this;
+
+            const glm::vec2 min = glm::max(Position, other.Position);
+            const glm::vec2 max = glm::min(Position + Size, other.Position + other.Size);
+            return SRect(min, glm::max(max - min, glm::vec2(0.0f)));
+        }
+
         SRect operator*(const float scale) const
         {
             return SRect(Position * scale, Size * scale);
@@ -0,0 +1,69 @@
+#include "epch.h"
+#include "HitGrid.h"
+
+#include <Engine/GUI/Widget.h>
+
+namespace Elixir::GUI
+{
+    void HitGrid::Clear()
+    {
+        m_Entries.clear();
+        m_Cells.clear();
+    }
+
+    void HitGrid::Insert(const Ref<Widget>& widget, const SRect& clipRect)
+    {
+        const auto geometry = widget->GetGeometry().Intersect(clipRect);
+        if (geometry.Size.x <= 0.0f || geometry.Size.y <= 0.0f)
+            return;
+
+        const auto index = (uint32_t)m_Entries.size();
+        m_Entries.push_back({ widget, geometry });
+
+        // Contains() is inclusive, so the far edge belongs to the last cell too
+        const int32_t minX = GetCell(geometry.Position.x);
+        const int32_t minY = GetCell(geometry.Position.y);
+        const int32_t maxX = GetCell(geometry.Position.x + geometry.Size.x);
+        const int32_t maxY = GetCell(geometry.Position.y + geometry.Size.y);
+
+        for (int32_t y = minY; y <= maxY; y++)
+        {
+            for (int32_t x = minX; x <= maxX; x++)
+            {
+                m_Cells[GetCellKey(x, y)].push_back(index);
+            }
+        }
+    }
+
+    std::vector<Ref<Widget>> HitGrid::Query(const glm::vec2& point) const
+    {
+        std::vector<Ref<Widget>> hits;
+
+        const auto it = m_Cells.find(GetCellKey(GetCell(point.x), GetCell(point.y)));
+        if (it == m_Cells.end())
+            return hits;
+
+        // Indices were appended in insertion order, so hits come out in paint order
+        for (const auto index : it->second)
+        {
+            const auto& entry = m_Entries[index];
+            if (!entry.Geometry.Contains(point))
+                continue;
+
+            if (auto widget = entry.Widget.lock())
+                hits.push_back(std::move(widget));
+        }
+
+        return hits;
+    }
+
+    int32_t HitGrid::GetCell(const float coordinate)
+    {
+        return (int32_t)std::floor(coordinate / CELL_SIZE);
+    }
+
+    uint64_t HitGrid::GetCellKey(const int32_t x, const int32_t y)
+    {
+        return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y;
+    }
+}
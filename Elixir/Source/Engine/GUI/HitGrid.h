@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Engine/GUI/Definitions.h>
+
+namespace Elixir::GUI
+{
+    class Widget;
+
+    /**
+     * Uniform grid over widget geometries, used by the Manager to find the widgets under the
+     * cursor without walking the whole tree. Widgets are inserted in paint order (pre-order)
+     * and queries return them in that same order.
+     */
+    class ELIXIR_API HitGrid
+    {
+      public:
+        static constexpr float CELL_SIZE = 64.0f;
+
+        void Clear();
+
+        /**
+         * Insert a widget with its current geometry. Widgets with an empty geometry (or
+         * clipped away entirely) are skipped, since they can never contain the cursor.
+         * @param widget the widget to insert.
+         * @param clipRect rect the widget's hit area is clipped to, or an invalid rect for none.
+         */
+        void Insert(const Ref<Widget>& widget, const SRect& clipRect = {{ -1, -1 }, { -1, -1 }});
+
+        /**
+         * Get the widgets whose geometry contains a point.
+         * @param point the point to test.
+         * @return the widgets, in insertion order.
+         */
+        std::vector<Ref<Widget>> Query(const glm::vec2& point) const;
+
+        size_t GetSize() const { return m_Entries.size(); }
+
+      private:
+        struct SEntry
+        {
+            WeakRef<Widget> Widget;
+            SRect Geometry;
+        };
+
+        static int32_t GetCell(float coordinate);
+        static uint64_t GetCellKey(int32_t x, int32_t y);
+
+        std::vector<SEntry> m_Entries;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells;
+    };
+}
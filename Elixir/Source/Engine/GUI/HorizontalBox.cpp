@@ -26,7 +26,7 @@ namespace Elixir::GUI
         {
             const auto layoutSlot = std::static_pointer_cast<LayoutSlot>(slot);
 
-            auto childSize = slot->GetWidget()->ComputeDesiredSize();
+            auto childSize = slot->GetWidget()->Measure();
             const auto margin = layoutSlot->GetMargin();
 
             // Add margin
@@ -65,7 +65,7 @@ namespace Elixir::GUI
 
             if (m_Stretching)
             {
-                const glm::vec2 childSize = slot->GetWidget()->ComputeDesiredSize();
+                const glm::vec2 childSize = slot->GetWidget()->Measure();
                 usedSpace += childSize.x + margin.GetTotalHorizontal();
             }
         }
@@ -80,7 +80,7 @@ namespace Elixir::GUI
         {
             const auto layoutSlot = std::static_pointer_cast<LayoutSlot>(slot);
 
-            const glm::vec2 childSize = slot->GetWidget()->ComputeDesiredSize();
+            const glm::vec2 childSize = slot->GetWidget()->Measure();
             const auto margin = layoutSlot->GetMargin();
             const auto hAlignment = layoutSlot->GetHorizontalAlignment();
             const auto vAlignment = layoutSlot->GetVerticalAlignment();
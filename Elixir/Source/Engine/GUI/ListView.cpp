@@ -0,0 +1,244 @@
+#include "epch.h"
+#include "ListView.h"
+
+namespace Elixir::GUI
+{
+    ListView::ListView()
+    {
+        m_DesiredSize = { 200.0f, 300.0f };
+    }
+
+    void ListView::Update(const Timestep frameTime)
+    {
+        for (const auto& row : m_Rows)
+            row->Update(frameTime);
+    }
+
+    glm::vec2 ListView::ComputeDesiredSize()
+    {
+        return m_DesiredSize;
+    }
+
+    void ListView::SetGenerator(const GeneratorFn& generator)
+    {
+        DiscardRows();
+        m_Generator = generator;
+        MarkLayoutDirty();
+    }
+
+    void ListView::SetBinder(const BinderFn& binder)
+    {
+        m_Binder = binder;
+        Refresh();
+    }
+
+    void ListView::SetItemCount(const size_t count)
+    {
+        if (m_ItemCount == count) return;
+        m_ItemCount = count;
+
+        // Items may have shifted, so every visible row is re-bound on the next layout
+        RecycleRows();
+        MarkLayoutDirty();
+    }
+
+    void ListView::SetItemHeight(const float height)
+    {
+        if (m_ItemHeight == height) return;
+        m_ItemHeight = height;
+        MarkLayoutDirty();
+    }
+
+    void ListView::SetItemSpacing(const float spacing)
+    {
+        if (m_ItemSpacing == spacing) return;
+        m_ItemSpacing = spacing;
+        MarkLayoutDirty();
+    }
+
+    void ListView::Refresh()
+    {
+        if (!m_Binder) return;
+
+        for (size_t i = 0; i < m_Rows.size(); i++)
+            m_Binder(m_Rows[i], m_FirstIndex + i);
+    }
+
+    void ListView::SetScrollOffset(const float offset)
+    {
+        const float clamped = std::clamp(offset, 0.0f, GetMaxScrollOffset());
+        if (m_ScrollOffset == clamped) return;
+        m_ScrollOffset = clamped;
+        MarkLayoutDirty();
+    }
+
+    void ListView::ScrollToItem(const size_t index)
+    {
+        if (index >= m_ItemCount) return;
+
+        const float top = (float)index * GetItemStride();
+        const float bottom = top + m_ItemHeight;
+        const float viewport = m_Geometry.Size.y;
+
+        if (top < m_ScrollOffset)
+            SetScrollOffset(top);
+        else if (bottom > m_ScrollOffset + viewport)
+            SetScrollOffset(bottom - viewport);
+    }
+
+    float ListView::GetMaxScrollOffset() const
+    {
+        if (m_ItemCount == 0) return 0.0f;
+
+        const float contentHeight = (float)m_ItemCount * GetItemStride() - m_ItemSpacing;
+        return std::max(0.0f, contentHeight - m_Geometry.Size.y);
+    }
+
+    void ListView::SetBackground(const SColor& color)
+    {
+        m_Background = color;
+        MarkRenderDirty();
+    }
+
+    Ref<Widget> ListView::GetRow(const size_t index) const
+    {
+        if (index < m_FirstIndex || index >= m_FirstIndex + m_Rows.size())
+            return nullptr;
+
+        return m_Rows[index - m_FirstIndex];
+    }
+
+    void ListView::RemoveChild(const Ref<Widget>& child)
+    {
+        if (!child) return;
+
+        if (std::ranges::find(m_Rows, child) != m_Rows.end())
+            RecycleRows();
+
+        const auto it = std::ranges::find(m_Pool, child);
+        if (it == m_Pool.end()) return;
+
+        m_Pool.erase(it);
+        DetachChild(child);
+    }
+
+    void ListView::ForEachChild(const std::function<void(const Ref<Widget>&)>& fn) const
+    {
+        for (const auto& row : m_Rows)
+            fn(row);
+    }
+
+    void ListView::LayoutChildren(const SRect& allocatedSpace)
+    {
+        // The viewport may have grown, which lowers the maximum scroll offset
+        m_ScrollOffset = std::clamp(m_ScrollOffset, 0.0f, GetMaxScrollOffset());
+
+        const float stride = GetItemStride();
+        const float viewport = allocatedSpace.Size.y;
+
+        if (m_ItemCount == 0 || !m_Generator || stride <= 0.0f || viewport <= 0.0f)
+        {
+            RecycleRows();
+            return;
+        }
+
+        // Visible window: [first, last)
+        const auto first = std::min(m_ItemCount - 1, (size_t)(m_ScrollOffset / stride));
+        const auto last = std::min(m_ItemCount, (size_t)std::ceil((m_ScrollOffset + viewport) / stride));
+
+        // Keep the rows still showing an item in the window, recycle the others
+        std::vector<Ref<Widget>> rows(last - first);
+        for (size_t i = 0; i < m_Rows.size(); i++)
+        {
+            const size_t index = m_FirstIndex + i;
+            if (index >= first && index < last)
+                rows[index - first] = std::move(m_Rows[i]);
+            else
+                m_Pool.push_back(std::move(m_Rows[i]));
+        }
+
+        // Fill the gaps with recycled (or new) rows
+        for (size_t i = 0; i < rows.size(); i++)
+        {
+            if (rows[i]) continue;
+
+            rows[i] = AcquireRow();
+            if (m_Binder) m_Binder(rows[i], first + i);
+        }
+
+        m_Rows = std::move(rows);
+        m_FirstIndex = first;
+
+        for (size_t i = 0; i < m_Rows.size(); i++)
+        {
+            const SRect rowRect = {
+                {
+                    allocatedSpace.Position.x,
+                    allocatedSpace.Position.y + (float)(first + i) * stride - m_ScrollOffset
+                },
+                { allocatedSpace.Size.x, m_ItemHeight }
+            };
+
+            m_Rows[i]->ArrangeChildren(rowRect);
+        }
+    }
+
+    void ListView::BuildDrawCommands(RenderBatch& batch, const int zOrder)
+    {
+        if (m_Background.A > 0.0f)
+        {
+            batch.AddRect(
+                m_Geometry,
+                m_Background,
+                glm::vec4(0.0f),
+                m_InsetShadow,
+                m_DropShadow,
+                m_Outline,
+                zOrder
+            );
+        }
+    }
+
+    bool ListView::HandleMouseScroll(const MouseScrolledEvent& event)
+    {
+        const float previous = m_ScrollOffset;
+        ScrollBy(-event.GetOffsetY() * m_ScrollSpeed);
+
+        // Not consumed at either end, so an enclosing scrollable can take over
+        return m_ScrollOffset != previous;
+    }
+
+    void ListView::RecycleRows()
+    {
+        for (auto& row : m_Rows)
+            m_Pool.push_back(std::move(row));
+
+        m_Rows.clear();
+        m_FirstIndex = 0;
+    }
+
+    void ListView::DiscardRows()
+    {
+        RecycleRows();
+
+        for (const auto& row : m_Pool)
+            DetachChild(row);
+
+        m_Pool.clear();
+    }
+
+    Ref<Widget> ListView::AcquireRow()
+    {
+        if (!m_Pool.empty())
+        {
+            auto row = std::move(m_Pool.back());
+            m_Pool.pop_back();
+            return row;
+        }
+
+        auto row = m_Generator();
+        EE_CORE_ASSERT(row, "ListView generator returned a null row")
+        AttachChild(row);
+        return row;
+    }
+}
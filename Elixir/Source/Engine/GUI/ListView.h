@@ -0,0 +1,152 @@
+#pragma once
+
+#include <Engine/GUI/Widget.h>
+
+namespace Elixir::GUI
+{
+    /**
+     * Vertically scrolling list of fixed-height rows, virtualized: only the rows intersecting
+     * the viewport are materialized as widgets, and rows scrolled out of view are recycled for
+     * the ones scrolling in. Layout, input and draw cost scale with the viewport height
+     * instead of the item count. Rows are clipped to the list's geometry.
+     *
+     * Items are not widgets: the list asks the generator for a row widget when it needs a new
+     * one, and the binder to show a given item index in a (new or recycled) row.
+     */
+    class ELIXIR_API ListView final : public Widget
+    {
+      public:
+        using GeneratorFn = std::function<Ref<Widget>()>;
+        using BinderFn = std::function<void(const Ref<Widget>& row, size_t index)>;
+
+        ListView();
+
+        void Update(Timestep frameTime) override;
+
+        glm::vec2 ComputeDesiredSize() override;
+
+        bool IsClippingChildren() const override { return true; }
+
+        /**
+         * Set the callback creating row widgets. Existing rows are discarded.
+         * @param generator callback returning a new row widget.
+         */
+        void SetGenerator(const GeneratorFn& generator);
+
+        /**
+         * Set the callback showing an item in a row. Visible rows are re-bound.
+         * @param binder callback binding an item index to a row widget.
+         */
+        void SetBinder(const BinderFn& binder);
+
+        size_t GetItemCount() const { return m_ItemCount; }
+        void SetItemCount(size_t count);
+
+        float GetItemHeight() const { return m_ItemHeight; }
+        void SetItemHeight(float height);
+
+        float GetItemSpacing() const { return m_ItemSpacing; }
+        void SetItemSpacing(float spacing);
+
+        /**
+         * Re-bind every materialized row, e.g. after the underlying items changed.
+         */
+        void Refresh();
+
+        float GetScrollOffset() const { return m_ScrollOffset; }
+
+        /**
+         * Scroll to an offset, clamped to [0, GetMaxScrollOffset()].
+         * @param offset distance in pixels from the top of the first item.
+         */
+        void SetScrollOffset(float offset);
+        void ScrollBy(const float delta) { SetScrollOffset(m_ScrollOffset + delta); }
+
+        /**
+         * Scroll the minimum amount that makes an item fully visible.
+         * @param index the item index.
+         */
+        void ScrollToItem(size_t index);
+
+        /**
+         * Get the largest valid scroll offset for the current item count and viewport.
+         * @return the content height minus the viewport height, or 0 if everything fits.
+         */
+        float GetMaxScrollOffset() const;
+
+        float GetScrollSpeed() const { return m_ScrollSpeed; }
+        void SetScrollSpeed(const float speed) { m_ScrollSpeed = speed; }
+
+        SColor GetBackground() const { return m_Background; }
+        void SetBackground(const SColor& color);
+
+        /**
+         * Get the index of the first materialized item.
+         * @return the first visible item index.
+         */
+        size_t GetFirstVisibleIndex() const { return m_FirstIndex; }
+
+        /**
+         * Get the number of materialized rows, i.e. the items intersecting the viewport.
+         * @return the number of visible rows.
+         */
+        size_t GetVisibleRowCount() const { return m_Rows.size(); }
+
+        /**
+         * Get the row widget showing an item, if it is materialized.
+         * @param index the item index.
+         * @return the row widget, or nullptr if the item is not visible.
+         */
+        Ref<Widget> GetRow(size_t index) const;
+
+      protected:
+        void RemoveChild(const Ref<Widget>& child) override;
+        void ForEachChild(const std::function<void(const Ref<Widget>&)>& fn) const override;
+
+        void LayoutChildren(const SRect& allocatedSpace) override;
+        void BuildDrawCommands(RenderBatch& batch, int zOrder) override;
+
+        bool HandleMouseScroll(const MouseScrolledEvent& event) override;
+
+      private:
+        /**
+         * Get the distance between the tops of two consecutive items.
+         */
+        float GetItemStride() const { return m_ItemHeight + m_ItemSpacing; }
+
+        /**
+         * Move every row to the recycle pool; the next layout re-binds the visible ones.
+         */
+        void RecycleRows();
+
+        /**
+         * Detach and drop every row, pooled or not, e.g. when the generator changes.
+         */
+        void DiscardRows();
+
+        /**
+         * Take a row from the recycle pool, or generate and adopt a new one.
+         */
+        Ref<Widget> AcquireRow();
+
+        GeneratorFn m_Generator;
+        BinderFn m_Binder;
+
+        size_t m_ItemCount = 0;
+        float m_ItemHeight = 24.0f;
+        float m_ItemSpacing = 0.0f;
+
+        float m_ScrollOffset = 0.0f;
+        float m_ScrollSpeed = 48.0f;
+
+        SColor m_Background;
+
+        // Materialized rows, showing items [m_FirstIndex, m_FirstIndex + m_Rows.size()).
+        std::vector<Ref<Widget>> m_Rows;
+        size_t m_FirstIndex = 0;
+
+        // Rows scrolled out of view, kept for reuse instead of generating new widgets.
+        // They stay parented to the list, but are neither laid out, drawn nor hit-tested.
+        std::vector<Ref<Widget>> m_Pool;
+    };
+}
@@ -43,6 +43,8 @@ namespace Elixir::GUI
     {
         if (!m_RootWidget || !m_RootWidget->IsVisible()) return;
 
+        MemoryTagScope tag(EMemoryTag::GUI);
+
         if (NeedsRebuild())
         {
             AssembleFrame();
@@ -59,6 +61,7 @@ namespace Elixir::GUI
         dispatcher.Dispatch<FramebufferResizeEvent>(EE_BIND_EVENT_FN(Manager::HandleFramebufferResize));
         dispatcher.Dispatch<KeyPressedEvent>(EE_BIND_EVENT_FN(Manager::HandleKeyPressed));
         dispatcher.Dispatch<KeyTypedEvent>(EE_BIND_EVENT_FN(Manager::HandleKeyTyped));
+        dispatcher.Dispatch<MouseScrolledEvent>(EE_BIND_EVENT_FN(Manager::HandleMouseScrolled));
     }
 
     void Manager::AssembleFrame()
@@ -115,6 +118,19 @@ namespace Elixir::GUI
         return true;
     }
 
+    bool Manager::HandleMouseScrolled(const MouseScrolledEvent& event) const
+    {
+        // Hits come back in paint order, so the topmost (innermost) widget gets it first
+        const auto hits = m_HitGrid.Query(m_MousePos);
+        for (auto it = hits.rbegin(); it != hits.rend(); ++it)
+        {
+            if ((*it)->IsVisible() && (*it)->HandleMouseScroll(event))
+                return true;
+        }
+
+        return false;
+    }
+
     void Manager::ProcessInput()
     {
         const auto [x, y] = InputManager::GetMousePosition();
@@ -128,9 +144,30 @@ namespace Elixir::GUI
         m_MouseReleased = !isMouseDown && m_WasMouseDown;
         m_WasMouseDown = isMouseDown;
 
+        // Widgets moving under a still cursor can change hover state, so a rebuilt grid
+        // is processed too.
+        const bool gridRebuilt = UpdateHitGrid();
+        if (!m_MouseMoved && !m_MousePressed && !m_MouseReleased && !gridRebuilt)
+            return;
+
         if (m_RootWidget)
         {
-            ProcessInputRecursive(m_RootWidget);
+            const auto hits = m_HitGrid.Query(m_MousePos);
+
+            // Leave: widgets hovered last time and no longer under the cursor
+            for (const auto& hovered : m_HoveredWidgets)
+            {
+                const auto widget = hovered.lock();
+                if (widget && widget->IsHovered() && std::ranges::find(hits, widget) == hits.end())
+                    widget->HandleMouseLeave();
+            }
+
+            m_HoveredWidgets.clear();
+            for (const auto& widget : hits)
+            {
+                ProcessWidget(widget);
+                m_HoveredWidgets.push_back(widget);
+            }
 
             if (m_MouseReleased && m_PressedWidget)
             {
@@ -155,25 +192,53 @@ namespace Elixir::GUI
         }
     }
 
-    void Manager::ProcessWidget(const Ref<Widget>& widget)
+    bool Manager::UpdateHitGrid()
     {
-        if (!widget || !widget->IsVisible()) return;
+        if (m_HitGridEpoch == Widget::CurrentLayoutEpoch() && m_HitGridRoot.lock() == m_RootWidget)
+            return false;
 
-        const auto geometry = widget->GetGeometry();
-        const bool isOver = geometry.Contains(m_MousePos);
+        EE_PROFILE_ZONE_SCOPED()
 
-        // Hover
-        if (isOver && !widget->IsHovered())
+        m_HitGrid.Clear();
+        if (m_RootWidget)
+            InsertHitGridRecursive(m_RootWidget, {{ -1, -1 }, { -1, -1 }});
+
+        m_HitGridEpoch = Widget::CurrentLayoutEpoch();
+        m_HitGridRoot = m_RootWidget;
+        return true;
+    }
+
+    void Manager::InsertHitGridRecursive(const Ref<Widget>& widget, const SRect& clipRect)
+    {
+        // Visibility is checked per query (opacity changes do not move widgets), so the
+        // whole tree goes in, in the same pre-order the input used to be dispatched in.
+        m_HitGrid.Insert(widget, clipRect);
+
+        const SRect childClipRect = widget->GetChildClipRect(clipRect);
+        widget->ForEachChild([this, &childClipRect](const Ref<Widget>& child)
         {
-            widget->HandleMouseEnter();
+            InsertHitGridRecursive(child, childClipRect);
+        });
+    }
+
+    void Manager::ProcessWidget(const Ref<Widget>& widget)
+    {
+        // Only called for widgets under the cursor
+        if (!widget->IsVisible())
+        {
+            if (widget->IsHovered())
+                widget->HandleMouseLeave();
+            return;
         }
-        else if (!isOver && widget->IsHovered())
+
+        // Hover
+        if (!widget->IsHovered())
         {
-            widget->HandleMouseLeave();
+            widget->HandleMouseEnter();
         }
 
         // Press + Focus
-        if (isOver && m_MousePressed)
+        if (m_MousePressed)
         {
             const auto event = MouseButtonPressedEvent(EE_MOUSE_BUTTON_LEFT, m_MousePos);
             widget->HandleMouseDown(event);
@@ -191,7 +256,7 @@ namespace Elixir::GUI
         }
 
         // Click
-        if (isOver && m_MouseReleased)
+        if (m_MouseReleased)
         {
             const auto event = MouseButtonReleasedEvent(EE_MOUSE_BUTTON_LEFT, m_MousePos);
             widget->HandleMouseUp(event);
@@ -201,16 +266,6 @@ namespace Elixir::GUI
         }
     }
 
-    void Manager::ProcessInputRecursive(const Ref<Widget>& widget)
-    {
-        ProcessWidget(widget);
-
-        widget->ForEachChild([this](const Ref<Widget>& child)
-        {
-            ProcessInputRecursive(child);
-        });
-    }
-
     void Manager::ProcessKeyPressedRecursive(
         const Ref<Widget>& widget,
         const KeyPressedEvent& event
@@ -3,6 +3,7 @@
 #include <Engine/Event/KeyEvent.h>
 #include <Engine/Event/WindowEvent.h>
 #include <Engine/GUI/Renderer/Renderer.h>
+#include <Engine/GUI/HitGrid.h>
 #include <Engine/GUI/Panel.h>
 
 namespace Elixir::GUI
@@ -29,10 +30,18 @@ namespace Elixir::GUI
         }
 
         const RenderBatch& GetRenderBatch() const { return m_RenderBatch; }
+        const HitGrid& GetHitGrid() const { return m_HitGrid; }
 
     protected:
         void AssembleFrame();
 
+        /**
+         * Rebuild the hit-test grid if any widget may have moved since the last build.
+         * @return true if the grid was rebuilt.
+         */
+        bool UpdateHitGrid();
+        void InsertHitGridRecursive(const Ref<Widget>& widget, const SRect& clipRect);
+
         bool NeedsRebuild() const;
         void MarkRebuilt();
 
@@ -40,10 +49,15 @@ namespace Elixir::GUI
         bool HandleFramebufferResize(const FramebufferResizeEvent& event) const;
         bool HandleKeyPressed(const KeyPressedEvent& event) const;
         bool HandleKeyTyped(const KeyTypedEvent& event) const;
+        bool HandleMouseScrolled(const MouseScrolledEvent& event) const;
 
+        /**
+         * Dispatch mouse input to the widgets under the cursor. Only queries the hit-test
+         * grid, and does nothing when the cursor did not move, no button changed and no
+         * widget moved since the last frame.
+         */
         void ProcessInput();
         void ProcessWidget(const Ref<Widget>& widget);
-        void ProcessInputRecursive(const Ref<Widget>& widget);
 
         static void ProcessKeyPressedRecursive(const Ref<Widget>& widget, const KeyPressedEvent& event);
         static void ProcessKeyTypedRecursive(const Ref<Widget>& widget, const KeyTypedEvent& event);
@@ -62,6 +76,14 @@ namespace Elixir::GUI
         bool m_MouseReleased = false;
         bool m_MouseMoved = false;
 
+        HitGrid m_HitGrid;
+        // Layout epoch and root the hit-test grid was built from.
+        uint64_t m_HitGridEpoch = 0;
+        WeakRef<Panel> m_HitGridRoot;
+
+        // Widgets under the cursor on the last processed frame, to send leave events.
+        std::vector<WeakRef<Widget>> m_HoveredWidgets;
+
         // Dirty epoch of the last frame we assembled + uploaded. When it still matches the
         // current epoch, the batch and GPU buffers are reused and only the draws are re-issued.
         uint64_t m_LastRenderedEpoch = 0;
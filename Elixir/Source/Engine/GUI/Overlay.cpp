@@ -26,7 +26,7 @@ namespace Elixir::GUI
         {
             const auto layoutSlot = std::static_pointer_cast<LayoutSlot>(slot);
 
-            auto childSize = slot->GetWidget()->ComputeDesiredSize();
+            auto childSize = slot->GetWidget()->Measure();
             const auto margin = layoutSlot->GetMargin();
 
             // Add margin
@@ -55,7 +55,7 @@ namespace Elixir::GUI
         {
             const auto layoutSlot = std::static_pointer_cast<LayoutSlot>(slot);
 
-            const glm::vec2 childSize = slot->GetWidget()->ComputeDesiredSize();
+            const glm::vec2 childSize = slot->GetWidget()->Measure();
             const auto margin = layoutSlot->GetMargin();
             const auto hAlignment = layoutSlot->GetHorizontalAlignment();
             const auto vAlignment = layoutSlot->GetVerticalAlignment();
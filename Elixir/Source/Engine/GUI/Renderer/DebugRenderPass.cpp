@@ -8,43 +8,45 @@ namespace Elixir::GUI
 {
     DebugRenderPass::DebugRenderPass(
         const GraphicsContext* context,
-        const ShaderLoader* shaderLoader,
+        PipelineBatch& batch,
         const float dpiScale,
         const Ref<UniformBuffer>& perFrameCB
     ) : m_DPIScale(dpiScale), m_PerFrameConstantBuffer(perFrameCB), m_GraphicsContext(context)
     {
         EE_CORE_TRACE("Initializing GUI: DebugRenderPass.")
-        InitRenderPass(shaderLoader);
-        BindShaderParameters();
+        InitRenderPass(batch);
     }
 
-    void DebugRenderPass::GenerateDrawCommands(const RenderBatch& batch)
+    bool DebugRenderPass::Accepts(const SDrawCommand::EType type) const
     {
-        m_Vertices.clear();
+        return type == SDrawCommand::EType::DebugRect;
+    }
 
-        for (const auto& drawCmd : batch.GetCommands())
-        {
-            switch (drawCmd.Type)
-            {
-                case SDrawCommand::EType::DebugRect:
-                    BuildDebugRectGeometry(drawCmd);
-                    break;
-                default:
-                    break;
-            }
-        }
+    SDrawRange DebugRenderPass::Build(const SDrawCommand& command)
+    {
+        const auto first = (uint32_t)m_Vertices.size();
+        BuildDebugRectGeometry(command);
+
+        return { first, (uint32_t)m_Vertices.size() - first, command.Geometry };
+    }
 
+    void DebugRenderPass::Upload()
+    {
         if (!m_Vertices.empty())
         {
             m_VertexBuffer->UpdateData(m_Vertices.data(), m_Vertices.size() * sizeof(SVertex));
         }
     }
 
-    void DebugRenderPass::Render(const Ref<CommandBuffer>& cmd)
+    void DebugRenderPass::Bind(const Ref<CommandBuffer>& cmd)
     {
         m_Pipeline->Bind(cmd);
         m_VertexBuffer->Bind(cmd);
-        cmd->Draw(m_Vertices.size());
+    }
+
+    void DebugRenderPass::Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range)
+    {
+        cmd->Draw(range.Count, 1, range.First);
     }
 
     bool DebugRenderPass::HasData() const
@@ -57,7 +59,14 @@ namespace Elixir::GUI
         m_Vertices.clear();
     }
 
-    void DebugRenderPass::InitRenderPass(const ShaderLoader* shaderLoader)
+    void DebugRenderPass::OnPipelinesReady()
+    {
+        m_Pipeline = m_PendingPipeline.Get();
+        m_Shader = m_Pipeline->GetShader();
+        BindShaderParameters();
+    }
+
+    void DebugRenderPass::InitRenderPass(PipelineBatch& batch)
     {
         const BufferLayout bufferLayout({
             {
@@ -68,10 +77,9 @@ namespace Elixir::GUI
             }
         });
 
-        m_Shader = shaderLoader->LoadShader("./Shaders/", "Debug");
+        const auto shader = batch.LoadShader("./Shaders/", "Debug");
 
         PipelineBuilder builder;
-        builder.SetShader(m_Shader);
         builder.SetInputTopology(EPrimitiveTopology::LineList);
         builder.SetPolygonMode(EPolygonMode::Line);
         builder.SetCullMode(ECullMode::None, EFrontFace::CounterClockwise);
@@ -79,7 +87,7 @@ namespace Elixir::GUI
         builder.DisableDepthTest();
         builder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
         builder.SetBufferLayout(bufferLayout);
-        m_Pipeline = builder.Build(m_GraphicsContext);
+        m_PendingPipeline = batch.Build(builder, shader);
 
         constexpr auto vertexCount = MAX_LINES * 2;
         m_VertexBuffer = DynamicVertexBuffer::Create(m_GraphicsContext, vertexCount * sizeof(SVertex));
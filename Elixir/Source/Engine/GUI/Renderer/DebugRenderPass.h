@@ -3,7 +3,7 @@
 #include <Engine/GUI/Renderer/RenderBatch.h>
 #include <Engine/GUI/Renderer/RenderPass.h>
 #include <Engine/Graphics/GraphicsContext.h>
-#include <Engine/Graphics/Shader/ShaderLoader.h>
+#include <Engine/Graphics/Pipeline/PipelineBatch.h>
 
 namespace Elixir::GUI
 {
@@ -14,18 +14,22 @@ namespace Elixir::GUI
 
         DebugRenderPass(
             const GraphicsContext* context,
-            const ShaderLoader* shaderLoader,
+            PipelineBatch& batch,
             float dpiScale,
             const Ref<UniformBuffer>& perFrameCB
         );
 
-        void GenerateDrawCommands(const RenderBatch& batch) override;
-        void Render(const Ref<CommandBuffer>& cmd) override;
+        bool Accepts(SDrawCommand::EType type) const override;
+        SDrawRange Build(const SDrawCommand& command) override;
+        void Upload() override;
+        void Bind(const Ref<CommandBuffer>& cmd) override;
+        void Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range) override;
         bool HasData() const override;
         void Clear() override;
+        void OnPipelinesReady() override;
 
       private:
-        void InitRenderPass(const ShaderLoader* shaderLoader);
+        void InitRenderPass(PipelineBatch& batch);
         void BindShaderParameters() const;
 
         void BuildDebugRectGeometry(const SDrawCommand& cmd);
@@ -40,6 +44,7 @@ namespace Elixir::GUI
 
         Ref<Shader> m_Shader;
         Ref<GraphicsPipeline> m_Pipeline;
+        GraphicsPipelineFuture m_PendingPipeline;
         Ref<DynamicVertexBuffer> m_VertexBuffer;
 
         float m_DPIScale;
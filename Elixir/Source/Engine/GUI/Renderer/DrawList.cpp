@@ -0,0 +1,66 @@
+#include "epch.h"
+#include "DrawList.h"
+
+namespace Elixir::GUI
+{
+    namespace
+    {
+        bool Overlaps(const SRect& a, const SRect& b)
+        {
+            return a.Position.x < b.Position.x + b.Size.x && b.Position.x < a.Position.x + a.Size.x &&
+                   a.Position.y < b.Position.y + b.Size.y && b.Position.y < a.Position.y + a.Size.y;
+        }
+
+        SRect Union(const SRect& a, const SRect& b)
+        {
+            const glm::vec2 min = glm::min(a.Position, b.Position);
+            const glm::vec2 max = glm::max(a.Position + a.Size, b.Position + b.Size);
+            return { min, max - min };
+        }
+    }
+
+    void DrawList::Clear()
+    {
+        m_Segments.clear();
+        m_LastSegment.clear();
+    }
+
+    void DrawList::Add(const uint32_t pass, const SDrawRange& range, const SRect& scissorRect)
+    {
+        if (range.Count == 0) return;
+
+        // Fully clipped geometry is never drawn
+        const SRect bounds = range.Bounds.Intersect(scissorRect);
+        if (bounds.Size.x <= 0.0f || bounds.Size.y <= 0.0f)
+            return;
+
+        if (pass >= m_LastSegment.size())
+            m_LastSegment.resize(pass + 1, -1);
+
+        const int32_t last = m_LastSegment[pass];
+        if (last >= 0)
+        {
+            auto& segment = m_Segments[last];
+
+            // Culled geometry leaves a gap that must not be drawn with this segment
+            const size_t between = m_Segments.size() - last - 1;
+            bool blocked = segment.Range.First + segment.Range.Count != range.First
+                || segment.ScissorRect != scissorRect
+                || between > MAX_LOOKBACK;
+
+            // Moving ahead of other passes is only safe if none of their geometry overlaps
+            for (size_t i = last + 1; !blocked && i < m_Segments.size(); i++)
+                blocked = Overlaps(m_Segments[i].Range.Bounds, bounds);
+
+            if (!blocked)
+            {
+                segment.Range.Count += range.Count;
+                segment.Range.Bounds = Union(segment.Range.Bounds, bounds);
+                return;
+            }
+        }
+
+        m_LastSegment[pass] = (int32_t)m_Segments.size();
+        m_Segments.push_back({ pass, { range.First, range.Count, bounds }, scissorRect });
+    }
+}
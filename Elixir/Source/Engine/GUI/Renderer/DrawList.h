@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Engine/GUI/Renderer/RenderPass.h>
+
+namespace Elixir::GUI
+{
+    /**
+     * Contiguous range of one pass's geometry drawn with a single scissor rect.
+     */
+    struct SDrawSegment
+    {
+        uint32_t Pass = 0;
+        SDrawRange Range;
+
+        // Scissor rect in pixels, invalid for none
+        SRect ScissorRect;
+    };
+
+    /**
+     * Ordered list of draw segments for a GUI frame. Commands arrive in z-order; each one is
+     * merged into the latest segment of its pass when they share a scissor rect and nothing
+     * drawn in between overlaps it, so text and quads interleave correctly while consecutive
+     * widgets still batch into a handful of draw calls.
+     */
+    class ELIXIR_API DrawList final
+    {
+      public:
+        // How many segments of other passes a command may be moved ahead of.
+        static constexpr size_t MAX_LOOKBACK = 16;
+
+        void Clear();
+
+        /**
+         * Add the geometry a pass generated for one command.
+         * @param pass index of the pass that generated the geometry.
+         * @param range the generated range; a pass's ranges must be added in generation order.
+         * @param scissorRect scissor rect in pixels, invalid for none.
+         */
+        void Add(uint32_t pass, const SDrawRange& range, const SRect& scissorRect);
+
+        const std::vector<SDrawSegment>& GetSegments() const { return m_Segments; }
+
+      private:
+        std::vector<SDrawSegment> m_Segments;
+
+        // Index of the latest segment of each pass (-1 if none), the only one a pass can
+        // append to without breaking the contiguity of its geometry.
+        std::vector<int32_t> m_LastSegment;
+    };
+}
@@ -0,0 +1,146 @@
+#include "epch.h"
+#include "LayerRenderPass.h"
+
+#include <Engine/Graphics/Pipeline/PipelineBuilder.h>
+#include <Engine/Graphics/SamplerBuilder.h>
+
+namespace Elixir::GUI
+{
+    LayerRenderPass::LayerRenderPass(
+        const GraphicsContext* context,
+        PipelineBatch& batch,
+        const float dpiScale,
+        const Ref<UniformBuffer>& perFrameCB
+    ) : m_DPIScale(dpiScale), m_PerFrameConstantBuffer(perFrameCB), m_GraphicsContext(context)
+    {
+        EE_CORE_TRACE("Initializing GUI: LayerRenderPass.")
+        InitRenderPass(batch);
+    }
+
+    LayerRenderPass::~LayerRenderPass()
+    {
+        m_Quads.clear();
+    }
+
+    bool LayerRenderPass::Accepts(const SDrawCommand::EType type) const
+    {
+        return type == SDrawCommand::EType::Layer;
+    }
+
+    SDrawRange LayerRenderPass::Build(const SDrawCommand& command)
+    {
+        if (!command.Texture) return {};
+
+        if (m_Quads.size() >= MAX_LAYERS)
+        {
+            EE_CORE_WARN("GUI: LayerRenderPass is full, dropping layers.")
+            return {};
+        }
+
+        // The texture is already registered, this only looks its handle up
+        const SLayerQuad quad = {
+            .Position = command.Geometry.Position * m_DPIScale,
+            .Size = command.Geometry.Size * m_DPIScale,
+            .Color = command.Color,
+            .TextureIndex = m_TextureSet->AddTexture(command.Texture).Index
+        };
+
+        const auto first = (uint32_t)m_Quads.size();
+        m_Quads.push_back(quad);
+
+        return { first, 1, { quad.Position, quad.Size } };
+    }
+
+    void LayerRenderPass::Upload()
+    {
+        if (!m_Quads.empty())
+        {
+            m_QuadBuffer->UpdateData(m_Quads.data(), m_Quads.size() * sizeof(SLayerQuad));
+        }
+    }
+
+    void LayerRenderPass::Bind(const Ref<CommandBuffer>& cmd)
+    {
+        m_Pipeline->Bind(cmd);
+        m_QuadBuffer->Bind(cmd);
+    }
+
+    void LayerRenderPass::Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range)
+    {
+        cmd->Draw(6, range.Count, 0, range.First);
+    }
+
+    bool LayerRenderPass::HasData() const
+    {
+        return !m_Quads.empty();
+    }
+
+    void LayerRenderPass::Clear()
+    {
+        m_Quads.clear();
+    }
+
+    void LayerRenderPass::OnPipelinesReady()
+    {
+        m_Pipeline = m_PendingPipeline.Get();
+        m_Shader = m_Pipeline->GetShader();
+        BindShaderParameters();
+    }
+
+    SResourceHandle LayerRenderPass::AddTexture(const Ref<Texture2D>& texture) const
+    {
+        return m_TextureSet->AddTexture(texture);
+    }
+
+    void LayerRenderPass::RemoveTexture(const SResourceHandle handle) const
+    {
+        m_TextureSet->RemoveTexture(handle);
+    }
+
+    void LayerRenderPass::InitRenderPass(PipelineBatch& batch)
+    {
+        const BufferLayout bufferLayout({
+            {
+                {
+                    { EDataType::Vec2,  "Position"      },
+                    { EDataType::Vec2,  "Size"          },
+                    { EDataType::Vec4,  "Color"         },
+                    { EDataType::UInt,  "TextureIndex"  },
+                },
+                EInputRate::Instance
+            }
+        });
+
+        const auto shader = batch.LoadShader("./Shaders/", "Layer");
+
+        // Layer contents are blended over a transparent clear, so their color is premultiplied
+        PipelineBuilder builder;
+        builder.SetInputTopology(EPrimitiveTopology::TriangleList);
+        builder.SetPolygonMode(EPolygonMode::Fill);
+        builder.SetCullMode(ECullMode::Back, EFrontFace::CounterClockwise);
+        builder.EnablePremultipliedAlphaBlending();
+        builder.DisableDepthTest();
+        builder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
+        builder.SetBufferLayout(bufferLayout);
+        m_PendingPipeline = batch.Build(builder, shader);
+
+        m_Quads.reserve(MAX_LAYERS);
+        m_QuadBuffer = DynamicVertexBuffer::Create(m_GraphicsContext, MAX_LAYERS * sizeof(SLayerQuad));
+        m_QuadBuffer->SetLayout(bufferLayout);
+
+        m_TextureSet = TextureSet::Create(m_GraphicsContext);
+    }
+
+    void LayerRenderPass::BindShaderParameters() const
+    {
+        m_Shader->BindConstantBuffer("cbPerFrame", m_PerFrameConstantBuffer);
+        m_Shader->BindTextureSet("textures", m_TextureSet);
+
+        // One texel per pixel: nearest sampling keeps the layer exactly as rendered
+        const auto sampler = SamplerBuilder()
+            .SetMagFilter(ESamplerFilter::Nearest)
+            .SetMinFilter(ESamplerFilter::Nearest)
+            .Build(m_GraphicsContext);
+        m_Shader->BindSampler("samplerState", sampler);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Engine/GUI/Renderer/RenderBatch.h>
+#include <Engine/GUI/Renderer/RenderPass.h>
+#include <Engine/Graphics/TextureSet.h>
+#include <Engine/Graphics/GraphicsContext.h>
+#include <Engine/Graphics/Pipeline/PipelineBatch.h>
+
+namespace Elixir::GUI
+{
+    /**
+     * Composites retained layers: each layer command is drawn as one quad sampling the
+     * texture its contents were rendered into. The Renderer replaces the command's contents
+     * with that texture before building it.
+     */
+    class LayerRenderPass final : public RenderPass
+    {
+      public:
+        static constexpr size_t MAX_LAYERS = 1000;
+
+        LayerRenderPass(
+            const GraphicsContext* context,
+            PipelineBatch& batch,
+            float dpiScale,
+            const Ref<UniformBuffer>& perFrameCB
+        );
+
+        ~LayerRenderPass() override;
+
+        bool Accepts(SDrawCommand::EType type) const override;
+        SDrawRange Build(const SDrawCommand& command) override;
+        void Upload() override;
+        void Bind(const Ref<CommandBuffer>& cmd) override;
+        void Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range) override;
+        bool HasData() const override;
+        void Clear() override;
+        void OnPipelinesReady() override;
+
+        /**
+         * Register a layer texture, so layer commands can sample it.
+         * @param texture the layer texture.
+         * @return the texture handle, to remove it once the layer is released.
+         */
+        SResourceHandle AddTexture(const Ref<Texture2D>& texture) const;
+        void RemoveTexture(SResourceHandle handle) const;
+
+      private:
+        void InitRenderPass(PipelineBatch& batch);
+        void BindShaderParameters() const;
+
+        struct SLayerQuad
+        {
+            glm::vec2 Position;
+            glm::vec2 Size;
+            SColor Color;
+            uint32_t TextureIndex = 0;
+        };
+
+        std::vector<SLayerQuad> m_Quads;
+
+        Ref<Shader> m_Shader;
+        Ref<GraphicsPipeline> m_Pipeline;
+        GraphicsPipelineFuture m_PendingPipeline;
+        Ref<DynamicVertexBuffer> m_QuadBuffer;
+        Ref<TextureSet> m_TextureSet;
+
+        float m_DPIScale;
+        Ref<UniformBuffer> m_PerFrameConstantBuffer;
+        const GraphicsContext* m_GraphicsContext;
+    };
+}
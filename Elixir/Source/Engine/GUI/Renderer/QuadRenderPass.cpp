@@ -11,14 +11,13 @@ namespace Elixir::GUI
 {
     QuadRenderPass::QuadRenderPass(
         const GraphicsContext* context,
-        const ShaderLoader* shaderLoader,
+        PipelineBatch& batch,
         const float dpiScale,
         const Ref<UniformBuffer>& perFrameCB
     ) : m_DPIScale(dpiScale), m_PerFrameConstantBuffer(perFrameCB), m_GraphicsContext(context)
     {
         EE_CORE_TRACE("Initializing GUI: QuadRenderPass.")
-        InitRenderPass(shaderLoader);
-        BindShaderParameters();
+        InitRenderPass(batch);
     }
 
     QuadRenderPass::~QuadRenderPass()
@@ -27,33 +26,63 @@ namespace Elixir::GUI
         m_WhiteTexture.reset();
     }
 
-    void QuadRenderPass::GenerateDrawCommands(const RenderBatch& batch)
+    bool QuadRenderPass::Accepts(const SDrawCommand::EType type) const
     {
-        m_Quads.clear();
+        return type == SDrawCommand::EType::Rect;
+    }
 
-        for (const auto& drawCmd : batch.GetCommands())
+    SDrawRange QuadRenderPass::Build(const SDrawCommand& command)
+    {
+        if (m_Quads.size() >= MAX_QUADS)
         {
-            switch (drawCmd.Type)
-            {
-                case SDrawCommand::EType::Rect:
-                    BuildRectGeometry(drawCmd);
-                    break;
-                default:
-                    break;
-            }
+            EE_CORE_WARN("GUI: QuadRenderPass is full, dropping quads.")
+            return {};
         }
 
+        const SQuad quad = {
+            .Position = command.Geometry.Position * m_DPIScale,
+            .Size = command.Geometry.Size * m_DPIScale,
+            .Border = command.Border * m_DPIScale,
+            .InsetShadow = command.InsetShadow * m_DPIScale,
+            .DropShadow = command.DropShadow * m_DPIScale,
+            .Color = command.Color,
+            .OutlineColor = command.Outline.Color,
+            .OutlineThickness = command.Outline.Thickness * m_DPIScale,
+            .TextureIndex = ResolveTextureIndex(command.Texture)
+        };
+
+        const auto first = (uint32_t)m_Quads.size();
+        m_Quads.push_back(quad);
+
+        // Same expansion as the vertex shader: outline or drop shadow, whichever is larger
+        float expansion = quad.OutlineThickness;
+        if (quad.DropShadow.w > 0.0f)
+        {
+            const float shadow = glm::length(glm::vec2(quad.DropShadow)) + quad.DropShadow.z * 3.0f;
+            expansion = std::max(expansion, shadow);
+        }
+
+        const SRect bounds = { quad.Position - expansion, quad.Size + expansion * 2.0f };
+        return { first, 1, bounds };
+    }
+
+    void QuadRenderPass::Upload()
+    {
         if (!m_Quads.empty())
         {
             m_QuadBuffer->UpdateData(m_Quads.data(),  m_Quads.size() * sizeof(SQuad));
         }
     }
 
-    void QuadRenderPass::Render(const Ref<CommandBuffer>& cmd)
+    void QuadRenderPass::Bind(const Ref<CommandBuffer>& cmd)
     {
         m_Pipeline->Bind(cmd);
         m_QuadBuffer->Bind(cmd);
-        cmd->Draw(6, m_Quads.size());
+    }
+
+    void QuadRenderPass::Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range)
+    {
+        cmd->Draw(6, range.Count, 0, range.First);
     }
 
     bool QuadRenderPass::HasData() const
@@ -64,9 +93,17 @@ namespace Elixir::GUI
     void QuadRenderPass::Clear()
     {
         m_Quads.clear();
+        m_TextureIndices.clear();
+    }
+
+    void QuadRenderPass::OnPipelinesReady()
+    {
+        m_Pipeline = m_PendingPipeline.Get();
+        m_Shader = m_Pipeline->GetShader();
+        BindShaderParameters();
     }
 
-    void QuadRenderPass::InitRenderPass(const ShaderLoader* shaderLoader)
+    void QuadRenderPass::InitRenderPass(PipelineBatch& batch)
     {
         const BufferLayout bufferLayout({
             {
@@ -80,16 +117,14 @@ namespace Elixir::GUI
                     { EDataType::Vec4,  "OutlineColor"      },
                     { EDataType::Float, "OutlineThickness"  },
                     { EDataType::UInt,  "TextureIndex"      },
-                    { EDataType::Vec4,  "ScissorRect"       },
                 },
                 EInputRate::Instance
             }
         });
 
-        m_Shader = shaderLoader->LoadShader("./Shaders/", "GUI");
+        const auto shader = batch.LoadShader("./Shaders/", "GUI");
 
         PipelineBuilder builder;
-        builder.SetShader(m_Shader);
         builder.SetInputTopology(EPrimitiveTopology::TriangleList);
         builder.SetPolygonMode(EPolygonMode::Fill);
         builder.SetCullMode(ECullMode::Back, EFrontFace::CounterClockwise);
@@ -97,7 +132,7 @@ namespace Elixir::GUI
         builder.DisableDepthTest();
         builder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
         builder.SetBufferLayout(bufferLayout);
-        m_Pipeline = builder.Build(m_GraphicsContext);
+        m_PendingPipeline = batch.Build(builder, shader);
 
         m_Quads.reserve(MAX_QUADS);
         m_QuadBuffer = DynamicVertexBuffer::Create(m_GraphicsContext, MAX_QUADS * sizeof(SQuad));
@@ -127,25 +162,21 @@ namespace Elixir::GUI
         m_Shader->BindSampler("samplerState", sampler);
     }
 
-    void QuadRenderPass::BuildRectGeometry(const SDrawCommand& cmd)
+    uint32_t QuadRenderPass::ResolveTextureIndex(const Ref<Texture2D>& texture)
     {
-        const SQuad quad = {
-            .Position = cmd.Geometry.Position * m_DPIScale,
-            .Size = cmd.Geometry.Size * m_DPIScale,
-            .Border = cmd.Border * m_DPIScale,
-            .InsetShadow = cmd.InsetShadow * m_DPIScale,
-            .DropShadow = cmd.DropShadow * m_DPIScale,
-            .Color = cmd.Color,
-            .OutlineColor = cmd.Outline.Color,
-            .OutlineThickness = cmd.Outline.Thickness * m_DPIScale,
-            .TextureIndex = cmd.Texture
-                ? m_TextureSet->AddTexture(cmd.Texture).Index
-                : m_WhiteTextureHandle.Index,
-            .ScissorRect = cmd.ScissorRect.IsValid()
-                ? cmd.ScissorRect * m_DPIScale
-                : cmd.ScissorRect
-        };
+        if (!texture)
+            return m_WhiteTextureHandle.Index;
 
-        m_Quads.push_back(quad);
+        const auto [it, inserted] = m_TextureIndices.try_emplace(texture.get(), 0);
+        if (!inserted)
+            return it->second;
+
+        // Cached textures are in the shared bindless pool already, and must not be kept
+        // alive by this set or they could never be evicted
+        const auto& cache = TextureLoader::GetCache();
+        const auto handle = cache ? cache->GetHandle(texture.get()) : SResourceHandle{};
+
+        it->second = handle.IsValid() ? handle.Index : m_TextureSet->AddTexture(texture).Index;
+        return it->second;
     }
 }
\ No newline at end of file
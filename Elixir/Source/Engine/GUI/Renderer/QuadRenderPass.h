@@ -4,7 +4,7 @@
 #include <Engine/GUI/Renderer/RenderPass.h>
 #include <Engine/Graphics/TextureSet.h>
 #include <Engine/Graphics/GraphicsContext.h>
-#include <Engine/Graphics/Shader/ShaderLoader.h>
+#include <Engine/Graphics/Pipeline/PipelineBatch.h>
 
 namespace Elixir::GUI
 {
@@ -15,23 +15,33 @@ namespace Elixir::GUI
 
         QuadRenderPass(
             const GraphicsContext* context,
-            const ShaderLoader* shaderLoader,
+            PipelineBatch& batch,
             float dpiScale,
             const Ref<UniformBuffer>& perFrameCB
         );
 
         ~QuadRenderPass() override;
 
-        void GenerateDrawCommands(const RenderBatch& batch) override;
-        void Render(const Ref<CommandBuffer>& cmd) override;
+        bool Accepts(SDrawCommand::EType type) const override;
+        SDrawRange Build(const SDrawCommand& command) override;
+        void Upload() override;
+        void Bind(const Ref<CommandBuffer>& cmd) override;
+        void Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range) override;
         bool HasData() const override;
         void Clear() override;
+        void OnPipelinesReady() override;
 
       private:
-        void InitRenderPass(const ShaderLoader* shaderLoader);
+        void InitRenderPass(PipelineBatch& batch);
         void BindShaderParameters() const;
 
-        void BuildRectGeometry(const SDrawCommand& cmd);
+        /**
+         * Get the texture set index of a texture, adding it to the set on first use.
+         * Resolved once per texture per rebuild: the set lookup takes a lock.
+         * @param texture the texture, or nullptr for the white texture.
+         * @return the index in the texture set.
+         */
+        uint32_t ResolveTextureIndex(const Ref<Texture2D>& texture);
 
         struct SQuad
         {
@@ -63,14 +73,16 @@ namespace Elixir::GUI
             float OutlineThickness = 0.0f;
 
             uint32_t TextureIndex = 0;
-
-            SRect ScissorRect;
         };
 
-        std::vector<SQuad> m_Quads;
+        TaggedVector<EMemoryTag::GUI, SQuad> m_Quads;
+
+        // Texture set indices resolved since the last Clear
+        std::unordered_map<const Texture2D*, uint32_t> m_TextureIndices;
 
         Ref<Shader> m_Shader;
         Ref<GraphicsPipeline> m_Pipeline;
+        GraphicsPipelineFuture m_PendingPipeline;
         Ref<DynamicVertexBuffer> m_QuadBuffer;
         Ref<TextureSet> m_TextureSet;
 
@@ -3,7 +3,7 @@
 
 namespace Elixir::GUI
 {
-    void RenderBatch::Append(const RenderBatch& other, const int zOffset)
+    void RenderBatch::Append(const RenderBatch& other, const int zOffset, const SRect& clipRect)
     {
         m_Commands.reserve(m_Commands.size() + other.m_Commands.size());
         for (const auto& command : other.m_Commands)
@@ -11,6 +11,7 @@ namespace Elixir::GUI
             m_Commands.push_back(command);
             auto& cmd = m_Commands.back();
             cmd.ZOrder += zOffset;
+            cmd.ScissorRect = cmd.ScissorRect.Intersect(clipRect);
         }
     }
 
@@ -107,6 +108,28 @@ namespace Elixir::GUI
         m_Commands.push_back(cmd);
     }
 
+    void RenderBatch::AddLayer(
+        const Ref<const RenderBatch>& layer,
+        const SRect& rect,
+        const uint64_t layerId,
+        const uint64_t version,
+        const int zOrder,
+        const SRect& scissorRect
+    )
+    {
+        SDrawCommand cmd;
+        cmd.Type = SDrawCommand::EType::Layer;
+        cmd.Geometry = rect;
+        cmd.Color = { 1.0f, 1.0f, 1.0f, 1.0f };
+        cmd.Layer = layer;
+        cmd.LayerId = layerId;
+        cmd.LayerVersion = version;
+        cmd.ZOrder = zOrder;
+        cmd.ScissorRect = scissorRect;
+
+        m_Commands.push_back(cmd);
+    }
+
     void RenderBatch::AddDebugRect(const SRect& rect, const SColor& color)
     {
         SDrawCommand cmd;
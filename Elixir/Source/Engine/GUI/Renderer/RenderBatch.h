@@ -1,16 +1,19 @@
 #pragma once
 
+#include <Engine/Core/MemoryTracker.h>
 #include <Engine/Font/Font.h>
 #include <Engine/GUI/Definitions.h>
 #include <Engine/Graphics/Texture.h>
 
 namespace Elixir::GUI
 {
+    class RenderBatch;
+
     struct SDrawCommand
     {
         enum class EType : uint8_t
         {
-            Rect, Text, DebugRect
+            Rect, Text, DebugRect, Layer
         };
 
         EType Type;
@@ -47,6 +50,12 @@ namespace Elixir::GUI
         Ref<Texture2D> Texture;
         SRect TexCoords;
 
+        // For layer rendering: the layer contents, drawn offscreen and composited as one quad.
+        // The version changes whenever the contents do, so the layer is only redrawn then.
+        Ref<const RenderBatch> Layer;
+        uint64_t LayerId = 0;
+        uint64_t LayerVersion = 0;
+
         // Z-order for sorting
         int ZOrder = 0;
 
@@ -62,8 +71,14 @@ namespace Elixir::GUI
          * Used to assemble the per-widget command caches into the frame batch.
          * @param other batch whose commands are copied in.
          * @param zOffset value added to each appended command's ZOrder.
+         * @param clipRect rect every appended command is clipped to (intersected with its own
+         * scissor rect), or an invalid rect for no clipping.
          */
-        void Append(const RenderBatch& other, int zOffset);
+        void Append(
+            const RenderBatch& other,
+            int zOffset,
+            const SRect& clipRect = {{ -1, -1 }, { -1, -1 }}
+        );
 
         void Sort();
         void Clear();
@@ -104,11 +119,28 @@ namespace Elixir::GUI
             const SRect& scissorRect = {{ -1, -1 }, { -1, -1 }}
         );
 
+        /**
+         * Add a retained layer: a subtree's commands, rendered into a texture that is
+         * reused until the version changes.
+         * @param layer commands of the layer, sorted by z-order.
+         * @param rect area of the layer's owner widget.
+         * @param layerId unique identifier of the layer.
+         * @param version version of the layer contents.
+         */
+        void AddLayer(
+            const Ref<const RenderBatch>& layer,
+            const SRect& rect,
+            uint64_t layerId,
+            uint64_t version,
+            int zOrder = 0,
+            const SRect& scissorRect = {{ -1, -1 }, { -1, -1 }}
+        );
+
         void AddDebugRect(const SRect& rect, const SColor& color = { 1.0f, 0.0f, 0.0f, 1.0f });
 
-        const std::vector<SDrawCommand>& GetCommands() const { return m_Commands; }
+        const TaggedVector<EMemoryTag::GUI, SDrawCommand>& GetCommands() const { return m_Commands; }
 
       private:
-        std::vector<SDrawCommand> m_Commands;
+        TaggedVector<EMemoryTag::GUI, SDrawCommand> m_Commands;
     };
 }
\ No newline at end of file
@@ -1,19 +1,59 @@
 #pragma once
 
+#include <Engine/GUI/Renderer/RenderBatch.h>
 #include <Engine/Graphics/CommandBuffer.h>
 
 namespace Elixir::GUI
 {
-    class RenderBatch;
+    /**
+     * Range of instances (or vertices) a pass generated, and the screen area they cover.
+     */
+    struct SDrawRange
+    {
+        uint32_t First = 0;
+        uint32_t Count = 0;
+
+        // Area covered by the geometry, in pixels, used to reorder draws that do not overlap
+        SRect Bounds{};
+    };
 
     class RenderPass
     {
     public:
         virtual ~RenderPass() = default;
 
-        virtual void GenerateDrawCommands(const RenderBatch& batch) = 0;
-        virtual void Render(const Ref<CommandBuffer>& cmd) = 0;
+        /**
+         * @param type the draw command type.
+         * @return true if this pass draws commands of the given type.
+         */
+        virtual bool Accepts(SDrawCommand::EType type) const = 0;
+
+        /**
+         * Append the geometry for a draw command to this pass.
+         * @param command a command of a type this pass accepts.
+         * @return the range of the appended geometry, empty if nothing is drawn.
+         */
+        virtual SDrawRange Build(const SDrawCommand& command) = 0;
+
+        /**
+         * Upload the geometry built since the last Clear to the GPU.
+         */
+        virtual void Upload() = 0;
+
+        /**
+         * Bind the pipeline and buffers of this pass. Draw can then be called any number
+         * of times, until another pass is bound.
+         */
+        virtual void Bind(const Ref<CommandBuffer>& cmd) = 0;
+        virtual void Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range) = 0;
+
         virtual bool HasData() const = 0;
         virtual void Clear() = 0;
+
+        /**
+         * Finish initializing once the PipelineBatch the pass requested its pipelines from
+         * has been waited on. Called once, before the pass is used.
+         */
+        virtual void OnPipelinesReady() = 0;
     };
-}
\ No newline at end of file
+}
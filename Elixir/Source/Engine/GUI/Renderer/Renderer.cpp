@@ -8,6 +8,7 @@
 #include <Engine/GUI/Renderer/QuadRenderPass.h>
 #include <Engine/GUI/Renderer/TextRenderPass.h>
 #include <Engine/GUI/Renderer/DebugRenderPass.h>
+#include <Engine/GUI/Renderer/LayerRenderPass.h>
 #include <Engine/Graphics/Pipeline/PipelineBuilder.h>
 #include <Engine/Graphics/CommandBuffer.h>
 
@@ -34,22 +35,66 @@ namespace Elixir::GUI
         m_RenderExtent = extent;
         CalculateProjectionMatrix();
         m_PerFrameConstantBuffer->UpdateData(&m_PerFrameData, sizeof(SPerFrameData));
+
+        // Layers are bounded by the render extent, rebuild them within the new one
+        for (auto& [id, layer] : m_Layers)
+            layer.Version = 0;
     }
 
-    void Renderer::Rebuild(const RenderBatch& batch) const
+    void Renderer::Rebuild(const RenderBatch& batch)
     {
+        EE_PROFILE_ZONE_SCOPED()
+
+        m_DrawList.Clear();
         for (const auto& pass : m_RenderPasses)
-            pass->GenerateDrawCommands(batch);
+            pass->Clear();
+
+        // Layers still pending are rebuilt too (their geometry was just cleared) and queued
+        // again in dependency order
+        m_PendingLayers.clear();
+        for (auto& [id, layer] : m_Layers)
+            layer.Used = false;
+
+        BuildCommands(batch, m_DrawList);
+
+        // Release the layers whose widget is gone or hidden
+        for (auto it = m_Layers.begin(); it != m_Layers.end();)
+        {
+            if (it->second.Used)
+            {
+                ++it;
+                continue;
+            }
+
+            ReleaseLayerTexture(it->second);
+            it = m_Layers.erase(it);
+        }
+
+        for (const auto& pass : m_RenderPasses)
+            if (pass->HasData())
+                pass->Upload();
     }
 
-    void Renderer::Draw() const
+    void Renderer::Draw()
     {
+        ReleaseRetiredTextures();
+
         const auto cmd = m_GraphicsContext->GetSecondaryCommandBuffer();
+
+        // Layers are rendered before, and outside of, the GUI rendering scope
+        if (!m_PendingLayers.empty())
+        {
+            cmd->Begin({
+                .ColorAttachment = m_GraphicsContext->GetRenderTarget(),
+                .RenderArea = m_RenderExtent
+            });
+            RenderLayers(cmd);
+        }
+
         BeginRendering(cmd);
 
-        for (const auto& pass : m_RenderPasses)
-            if (pass->HasData())
-                pass->Render(cmd);
+        const SRect target = { { 0, 0 }, { (float)m_RenderExtent.Width, (float)m_RenderExtent.Height } };
+        DrawSegments(cmd, m_DrawList, target);
 
         EndRendering(cmd);
     }
@@ -73,9 +118,12 @@ namespace Elixir::GUI
 
     void Renderer::InitRenderPasses(const ShaderLoader* shaderLoader)
     {
+        // The passes' shaders and pipelines are created concurrently
+        PipelineBatch batch(m_GraphicsContext, shaderLoader);
+
         const auto& quad = CreateRef<QuadRenderPass>(
             m_GraphicsContext,
-            shaderLoader,
+            batch,
             m_DPIScale,
             m_PerFrameConstantBuffer
         );
@@ -83,19 +131,31 @@ namespace Elixir::GUI
 
         const auto& text = CreateRef<TextRenderPass>(
             m_GraphicsContext,
-            shaderLoader,
+            batch,
             m_DPIScale,
             m_PerFrameConstantBuffer
         );
         RegisterRenderPass(text);
 
+        m_LayerPass = CreateRef<LayerRenderPass>(
+            m_GraphicsContext,
+            batch,
+            m_DPIScale,
+            m_PerFrameConstantBuffer
+        );
+        RegisterRenderPass(m_LayerPass);
+
         const auto& debug = CreateRef<DebugRenderPass>(
             m_GraphicsContext,
-            shaderLoader,
+            batch,
             m_DPIScale,
             m_PerFrameConstantBuffer
         );
         RegisterRenderPass(debug);
+
+        batch.Wait();
+        for (const auto& pass : m_RenderPasses)
+            pass->OnPipelinesReady();
     }
 
     void Renderer::BeginRendering(const Ref<CommandBuffer>& cmd) const
@@ -129,6 +189,243 @@ namespace Elixir::GUI
         m_GraphicsContext->EnqueueSecondaryCommandBuffer(cmd);
     }
 
+    int32_t Renderer::FindRenderPass(const SDrawCommand::EType type) const
+    {
+        for (size_t i = 0; i < m_RenderPasses.size(); i++)
+        {
+            if (m_RenderPasses[i]->Accepts(type))
+                return (int32_t)i;
+        }
+
+        return -1;
+    }
+
+    void Renderer::BuildCommands(const RenderBatch& batch, DrawList& drawList)
+    {
+        for (const auto& command : batch.GetCommands())
+        {
+            // Layers are built as a quad sampling the texture their contents are rendered to
+            SDrawCommand composite;
+            const SDrawCommand* source = &command;
+
+            if (command.Type == SDrawCommand::EType::Layer)
+            {
+                const auto layer = UpdateLayer(command);
+                if (!layer) continue;
+
+                composite.Type = SDrawCommand::EType::Layer;
+                composite.Geometry = { layer->Rect.Position / m_DPIScale, layer->Rect.Size / m_DPIScale };
+                composite.Color = command.Color;
+                composite.Texture = layer->Texture;
+                composite.ScissorRect = command.ScissorRect;
+                source = &composite;
+            }
+
+            const auto index = FindRenderPass(source->Type);
+            if (index < 0) continue;
+
+            const auto range = m_RenderPasses[index]->Build(*source);
+            const auto scissorRect = source->ScissorRect.IsValid()
+                ? source->ScissorRect * m_DPIScale
+                : source->ScissorRect;
+
+            drawList.Add(index, range, scissorRect);
+        }
+    }
+
+    Renderer::SLayer* Renderer::UpdateLayer(const SDrawCommand& command)
+    {
+        // References to map elements survive the insertions of nested layers
+        auto& layer = m_Layers[command.LayerId];
+        layer.Used = true;
+
+        if (layer.Version == command.LayerVersion && !layer.Pending)
+        {
+            for (const auto child : layer.Children)
+                MarkLayerUsed(child);
+
+            return layer.Texture ? &layer : nullptr;
+        }
+
+        layer.Version = command.LayerVersion;
+        layer.Contents.Clear();
+        layer.Children.clear();
+
+        for (const auto& child : command.Layer->GetCommands())
+        {
+            if (child.Type == SDrawCommand::EType::Layer)
+                layer.Children.push_back(child.LayerId);
+        }
+
+        // Nested layers are updated (and queued) here, before this one
+        BuildCommands(*command.Layer, layer.Contents);
+
+        // The texture covers the pixels the contents touch, within the render extent
+        glm::vec2 min(std::numeric_limits<float>::max());
+        glm::vec2 max(std::numeric_limits<float>::lowest());
+        for (const auto& segment : layer.Contents.GetSegments())
+        {
+            min = glm::min(min, segment.Range.Bounds.Position);
+            max = glm::max(max, segment.Range.Bounds.Position + segment.Range.Bounds.Size);
+        }
+
+        min = glm::max(glm::floor(min), glm::vec2(0.0f));
+        max = glm::min(glm::ceil(max), glm::vec2(m_RenderExtent.Width, m_RenderExtent.Height));
+
+        if (max.x <= min.x || max.y <= min.y)
+        {
+            ReleaseLayerTexture(layer);
+            return nullptr;
+        }
+
+        layer.Rect = { min, max - min };
+
+        const auto width = (uint32_t)layer.Rect.Size.x;
+        const auto height = (uint32_t)layer.Rect.Size.y;
+        if (!layer.Texture || layer.Texture->GetWidth() != width || layer.Texture->GetHeight() != height)
+        {
+            ReleaseLayerTexture(layer);
+
+            const SImageCreateInfo info = {
+                .Width = width,
+                .Height = height,
+                .Type = EImageType::_2D,
+                .Format = EImageFormat::R8G8B8A8_SRGB,
+                .Usage = EImageUsage::ColorAttachment | EImageUsage::Sampled,
+                .InitialLayout = EImageLayout::ShaderReadOnly,
+                .AllocationInfo = {
+                    .RequiredFlags = EMemoryProperty::DeviceLocal
+                }
+            };
+
+            layer.Texture = Texture2D::Create(m_GraphicsContext, info);
+            layer.Handle = m_LayerPass->AddTexture(layer.Texture);
+        }
+
+        layer.Pending = true;
+        m_PendingLayers.push_back(command.LayerId);
+        return &layer;
+    }
+
+    void Renderer::MarkLayerUsed(const uint64_t id)
+    {
+        const auto it = m_Layers.find(id);
+        if (it == m_Layers.end()) return;
+
+        it->second.Used = true;
+        for (const auto child : it->second.Children)
+            MarkLayerUsed(child);
+    }
+
+    void Renderer::ReleaseLayerTexture(SLayer& layer)
+    {
+        if (!layer.Texture) return;
+
+        // Frames still in flight may sample it
+        m_RetiredTextures.emplace_back(layer.Texture, layer.Handle, m_GraphicsContext->GetFrameNumber());
+        layer.Texture.reset();
+    }
+
+    void Renderer::ReleaseRetiredTextures()
+    {
+        const auto frameNumber = m_GraphicsContext->GetFrameNumber();
+        const auto framesInFlight = m_GraphicsContext->GetFramesInFlight();
+
+        std::erase_if(m_RetiredTextures, [&](const auto& retired)
+        {
+            const auto& [texture, handle, frame] = retired;
+            if (frameNumber - frame < framesInFlight)
+                return false;
+
+            m_LayerPass->RemoveTexture(handle);
+            return true;
+        });
+    }
+
+    void Renderer::RenderLayers(const Ref<CommandBuffer>& cmd)
+    {
+        for (const auto id : m_PendingLayers)
+        {
+            auto& layer = m_Layers.at(id);
+            const Extent2D extent = { layer.Texture->GetWidth(), layer.Texture->GetHeight() };
+
+            layer.Texture->Transition(cmd, EImageLayout::ColorAttachment);
+
+            cmd->BeginRendering({
+                .ColorAttachment = layer.Texture,
+                .RenderArea = extent,
+                .ClearColor = glm::vec4(0.0f)
+            });
+
+            // Same projection as the GUI, shifted so the layer's area lands on the texture
+            Viewport viewport = {};
+            viewport.X = -layer.Rect.Position.x;
+            viewport.Y = -layer.Rect.Position.y;
+            viewport.Width = m_RenderExtent.Width;
+            viewport.Height = m_RenderExtent.Height;
+            viewport.MinDepth = 0.0f;
+            viewport.MaxDepth = 1.0f;
+
+            Rect2D scissor = {};
+            scissor.Offset = { 0, 0 };
+            scissor.Extent = extent;
+
+            cmd->SetViewports({ viewport });
+            cmd->SetScissors({ scissor });
+
+            DrawSegments(cmd, layer.Contents, layer.Rect);
+
+            cmd->EndRendering();
+            layer.Texture->Transition(cmd, EImageLayout::ShaderReadOnly);
+            layer.Pending = false;
+        }
+
+        m_PendingLayers.clear();
+    }
+
+    void Renderer::DrawSegments(
+        const Ref<CommandBuffer>& cmd,
+        const DrawList& drawList,
+        const SRect& target
+    ) const
+    {
+        // The scissor is set to the whole target when rendering begins
+        int32_t boundPass = -1;
+        SRect boundScissorRect = {{ -1, -1 }, { -1, -1 }};
+
+        for (const auto& segment : drawList.GetSegments())
+        {
+            const auto& pass = m_RenderPasses[segment.Pass];
+
+            if ((int32_t)segment.Pass != boundPass)
+            {
+                pass->Bind(cmd);
+                boundPass = (int32_t)segment.Pass;
+            }
+
+            if (segment.ScissorRect != boundScissorRect)
+            {
+                cmd->SetScissors({ GetHardwareScissor(segment.ScissorRect, target) });
+                boundScissorRect = segment.ScissorRect;
+            }
+
+            pass->Draw(cmd, segment.Range);
+        }
+    }
+
+    Rect2D Renderer::GetHardwareScissor(const SRect& scissorRect, const SRect& target)
+    {
+        const SRect clipped = target.Intersect(scissorRect);
+
+        const auto min = glm::floor(clipped.Position - target.Position);
+        const auto max = glm::ceil(clipped.Position + clipped.Size - target.Position);
+
+        Rect2D scissor = {};
+        scissor.Offset = { (int32_t)min.x, (int32_t)min.y };
+        scissor.Extent = { (uint32_t)(max.x - min.x), (uint32_t)(max.y - min.y) };
+        return scissor;
+    }
+
     void Renderer::CalculateProjectionMatrix()
     {
         // Orthographic projection
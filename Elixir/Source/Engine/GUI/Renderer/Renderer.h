@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Engine/GUI/Renderer/DrawList.h>
+#include <Engine/GUI/Renderer/LayerRenderPass.h>
 #include <Engine/GUI/Renderer/RenderBatch.h>
 #include <Engine/GUI/Renderer/RenderPass.h>
 #include <Engine/Graphics/Shader/ShaderLoader.h>
@@ -23,17 +25,25 @@ namespace Elixir::GUI
         void Resize(const Extent2D& extent);
 
         /**
-         * Regenerate each pass's GPU geometry from the batch (CPU build + vertex upload).
-         * Only needs to run when the batch changed; the passes retain their buffers otherwise.
-         * @param batch the assembled frame batch.
+         * Regenerate each pass's GPU geometry from the batch (CPU build + vertex upload) and
+         * the draw list ordering it. Only needs to run when the batch changed; the passes
+         * retain their buffers otherwise.
+         *
+         * Layer commands are built as a single composite quad; their contents are only built
+         * (into the layer's own draw list) when the layer version changed, and are then
+         * rendered into the layer texture by the next Draw.
+         *
+         * @param batch the assembled frame batch, sorted by z-order.
          */
-        void Rebuild(const RenderBatch& batch) const;
+        void Rebuild(const RenderBatch& batch);
 
         /**
-         * Record and submit the draw calls using each pass's current (cached) geometry.
-         * Runs every frame — the GUI is re-composited over the scene each frame.
+         * Record and submit the draw calls using each pass's current (cached) geometry: one
+         * instanced draw per draw list segment, switching pipelines and hardware scissor
+         * rects only between segments. Runs every frame — the GUI is re-composited over the
+         * scene each frame. Layers changed since the last Draw are rendered offscreen first.
          */
-        void Draw() const;
+        void Draw();
 
         void RegisterRenderPass(const Ref<RenderPass>& pass);
 
@@ -41,15 +51,79 @@ namespace Elixir::GUI
         void InitPerFrameData();
         void InitRenderPasses(const ShaderLoader* shaderLoader);
 
+        /**
+         * Offscreen render target of a layer, covering the pixels its contents touch.
+         */
+        struct SLayer
+        {
+            Ref<Texture2D> Texture;
+            SResourceHandle Handle;
+
+            // Version of the contents in the draw list, and their area in pixels
+            uint64_t Version = 0;
+            SRect Rect{};
+            DrawList Contents;
+
+            // Layers nested in this one, kept alive while this one is reused
+            std::vector<uint64_t> Children;
+
+            // Whether the contents were built but not yet rendered into the texture
+            bool Pending = false;
+            bool Used = false;
+        };
+
         void BeginRendering(const Ref<CommandBuffer>& cmd) const;
         void EndRendering(const Ref<CommandBuffer>& cmd) const;
 
+        /**
+         * Build a batch's commands into the passes, recording the draws in a draw list.
+         */
+        void BuildCommands(const RenderBatch& batch, DrawList& drawList);
+
+        /**
+         * Bring a layer up to date with its command, rebuilding its contents if they changed.
+         * @return the layer, or nullptr if it has nothing to draw.
+         */
+        SLayer* UpdateLayer(const SDrawCommand& command);
+        void MarkLayerUsed(uint64_t id);
+        void ReleaseLayerTexture(SLayer& layer);
+        void ReleaseRetiredTextures();
+
+        /**
+         * Render the contents of the pending layers into their textures, inner layers first.
+         */
+        void RenderLayers(const Ref<CommandBuffer>& cmd);
+        void DrawSegments(const Ref<CommandBuffer>& cmd, const DrawList& drawList, const SRect& target) const;
+
         void CalculateProjectionMatrix();
 
+        /**
+         * Find the pass drawing a command type.
+         * @return the pass index, or -1 if no pass draws it.
+         */
+        int32_t FindRenderPass(SDrawCommand::EType type) const;
+
+        /**
+         * Convert a scissor rect in pixels to a hardware scissor within a render target.
+         * @param scissorRect the scissor rect, invalid for the whole target.
+         * @param target area of the render target, in pixels.
+         */
+        static Rect2D GetHardwareScissor(const SRect& scissorRect, const SRect& target);
+
         SPerFrameData m_PerFrameData{};
         Ref<UniformBuffer> m_PerFrameConstantBuffer;
 
         std::vector<Ref<RenderPass>> m_RenderPasses;
+        DrawList m_DrawList;
+
+        Ref<LayerRenderPass> m_LayerPass;
+        std::unordered_map<uint64_t, SLayer> m_Layers;
+
+        // Layers to render in the next Draw, in dependency order
+        std::vector<uint64_t> m_PendingLayers;
+
+        // Released layer textures, with the frame they were last used in
+        std::vector<std::tuple<Ref<Texture2D>, SResourceHandle, uint32_t>> m_RetiredTextures;
 
         float m_DPIScale = 1.0f;
         Extent2D m_RenderExtent{};
@@ -9,43 +9,58 @@ namespace Elixir::GUI
 {
     TextRenderPass::TextRenderPass(
         const GraphicsContext* context,
-        const ShaderLoader* shaderLoader,
+        PipelineBatch& batch,
         const float dpiScale,
         const Ref<UniformBuffer>& perFrameCB
     ) : m_DPIScale(dpiScale), m_PerFrameConstantBuffer(perFrameCB), m_GraphicsContext(context)
     {
         EE_CORE_TRACE("Initializing GUI: TextRenderPass.")
-        InitRenderPass(shaderLoader);
-        BindShaderParameters();
+        InitRenderPass(batch);
     }
 
-    void TextRenderPass::GenerateDrawCommands(const RenderBatch& batch)
+    bool TextRenderPass::Accepts(const SDrawCommand::EType type) const
     {
-        m_Quads.clear();
+        return type == SDrawCommand::EType::Text;
+    }
 
-        for (const auto& drawCmd : batch.GetCommands())
+    SDrawRange TextRenderPass::Build(const SDrawCommand& command)
+    {
+        const auto first = (uint32_t)m_Quads.size();
+        BuildTextGeometry(command);
+
+        SDrawRange range = { first, (uint32_t)m_Quads.size() - first };
+        if (range.Count == 0)
+            return range;
+
+        glm::vec2 min = m_Quads[first].Position;
+        glm::vec2 max = min;
+        for (size_t i = first; i < m_Quads.size(); i++)
         {
-            switch (drawCmd.Type)
-            {
-                case SDrawCommand::EType::Text:
-                    BuildTextGeometry(drawCmd);
-                    break;
-                default:
-                    break;
-            }
+            min = glm::min(min, m_Quads[i].Position);
+            max = glm::max(max, m_Quads[i].Position + m_Quads[i].Size);
         }
 
+        range.Bounds = { min, max - min };
+        return range;
+    }
+
+    void TextRenderPass::Upload()
+    {
         if (!m_Quads.empty())
         {
             m_QuadBuffer->UpdateData(m_Quads.data(),  m_Quads.size() * sizeof(SQuad));
         }
     }
 
-    void TextRenderPass::Render(const Ref<CommandBuffer>& cmd)
+    void TextRenderPass::Bind(const Ref<CommandBuffer>& cmd)
     {
         m_Pipeline->Bind(cmd);
         m_QuadBuffer->Bind(cmd);
-        cmd->Draw(6, m_Quads.size());
+    }
+
+    void TextRenderPass::Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range)
+    {
+        cmd->Draw(6, range.Count, 0, range.First);
     }
 
     bool TextRenderPass::HasData() const
@@ -58,7 +73,14 @@ namespace Elixir::GUI
         m_Quads.clear();
     }
 
-    void TextRenderPass::InitRenderPass(const ShaderLoader* shaderLoader)
+    void TextRenderPass::OnPipelinesReady()
+    {
+        m_Pipeline = m_PendingPipeline.Get();
+        m_Shader = m_Pipeline->GetShader();
+        BindShaderParameters();
+    }
+
+    void TextRenderPass::InitRenderPass(PipelineBatch& batch)
     {
         const BufferLayout bufferLayout({
             {
@@ -69,16 +91,14 @@ namespace Elixir::GUI
                     { EDataType::Vec4, "Color"       },
                     { EDataType::UInt, "AtlasIndex"  },
                     { EDataType::Vec2, "UnitRange"   },
-                    { EDataType::Vec4, "ScissorRect" },
                 },
                 EInputRate::Instance
             }
         });
 
-        m_Shader = shaderLoader->LoadShader("./Shaders/", "Text");
+        const auto shader = batch.LoadShader("./Shaders/", "Text");
 
         PipelineBuilder builder;
-        builder.SetShader(m_Shader);
         builder.SetInputTopology(EPrimitiveTopology::TriangleList);
         builder.SetPolygonMode(EPolygonMode::Fill);
         builder.SetCullMode(ECullMode::Back, EFrontFace::CounterClockwise);
@@ -86,7 +106,7 @@ namespace Elixir::GUI
         builder.DisableDepthTest();
         builder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
         builder.SetBufferLayout(bufferLayout);
-        m_Pipeline = builder.Build(m_GraphicsContext);
+        m_PendingPipeline = batch.Build(builder, shader);
 
         m_Quads.reserve(MAX_CHARACTERS);
         m_QuadBuffer = DynamicVertexBuffer::Create(m_GraphicsContext, MAX_CHARACTERS * sizeof(SQuad));
@@ -130,9 +150,15 @@ namespace Elixir::GUI
                 continue;
             }
 
-            auto glyph = font->GetGlyph(codepoint);
+            const auto glyph = font->GetGlyph(codepoint);
+            if (!glyph.has_value())
+            {
+                i += charLen;
+                continue;
+            }
 
-            if (glyph.has_value() && glyph.value().PlaneBounds.has_value())
+            // Whitespace and glyphs still being generated only advance the pen
+            if (glyph->PlaneBounds.has_value() && glyph->AtlasBounds.has_value())
             {
                 SDrawCommand charCmd = cmd;
 
@@ -154,9 +180,9 @@ namespace Elixir::GUI
                 glm::vec2 texCoordMin = atlasBounds.Position;
                 glm::vec2 texCoordMax = atlasBounds.Size;
 
-                const auto atlas = font->GetAtlas();
-                const float texelWidth = 1.0f / atlas.Info.Width;
-                const float texelHeight = 1.0f / atlas.Info.Height;
+                const auto& atlas = font->GetAtlasInfo();
+                const float texelWidth = 1.0f / atlas.Width;
+                const float texelHeight = 1.0f / atlas.Height;
                 texCoordMin *= glm::vec2(texelWidth, texelHeight);
                 texCoordMax *= glm::vec2(texelWidth, texelHeight);
 
@@ -166,25 +192,29 @@ namespace Elixir::GUI
                 charCmd.TexCoords.Position.y = 1.0f - charCmd.TexCoords.Position.y;
                 charCmd.TexCoords.Size.y = 1.0f - charCmd.TexCoords.Size.y;
 
-                BuildTextureGeometry(charCmd);
-                cursorX += scale * glyph->Advance * cmd.FontSize;
+                BuildTextureGeometry(charCmd, glyph->AtlasIndex);
             }
+
+            cursorX += scale * glyph->Advance * cmd.FontSize;
             i += charLen;
         }
     }
 
-    void TextRenderPass::BuildTextureGeometry(const SDrawCommand& cmd)
+    void TextRenderPass::BuildTextureGeometry(const SDrawCommand& cmd, const uint32_t atlasIndex)
     {
+        if (m_Quads.size() >= MAX_CHARACTERS)
+        {
+            EE_CORE_WARN("GUI: TextRenderPass is full, dropping glyphs.")
+            return;
+        }
+
         const SQuad quad = {
             .Position = cmd.Geometry.Position * m_DPIScale,
             .Size = cmd.Geometry.Size * m_DPIScale,
             .TexCoords = cmd.TexCoords,
             .Color = cmd.Color,
-            .AtlasIndex = cmd.Font->GetAtlasHandle().Index,
-            .UnitRange = cmd.Font->GetUnitRange(),
-            .ScissorRect = cmd.ScissorRect.IsValid()
-                ? cmd.ScissorRect * m_DPIScale
-                : cmd.ScissorRect
+            .AtlasIndex = atlasIndex,
+            .UnitRange = cmd.Font->GetUnitRange()
         };
 
         m_Quads.push_back(quad);
@@ -2,7 +2,7 @@
 
 #include <Engine/GUI/Renderer/RenderBatch.h>
 #include <Engine/GUI/Renderer/RenderPass.h>
-#include <Engine/Graphics/Shader/ShaderLoader.h>
+#include <Engine/Graphics/Pipeline/PipelineBatch.h>
 
 namespace Elixir::GUI
 {
@@ -13,22 +13,26 @@ namespace Elixir::GUI
 
         TextRenderPass(
             const GraphicsContext* context,
-            const ShaderLoader* shaderLoader,
+            PipelineBatch& batch,
             float dpiScale,
             const Ref<UniformBuffer>& perFrameCB
         );
 
-        void GenerateDrawCommands(const RenderBatch& batch) override;
-        void Render(const Ref<CommandBuffer>& cmd) override;
+        bool Accepts(SDrawCommand::EType type) const override;
+        SDrawRange Build(const SDrawCommand& command) override;
+        void Upload() override;
+        void Bind(const Ref<CommandBuffer>& cmd) override;
+        void Draw(const Ref<CommandBuffer>& cmd, const SDrawRange& range) override;
         bool HasData() const override;
         void Clear() override;
+        void OnPipelinesReady() override;
 
       private:
-        void InitRenderPass(const ShaderLoader* shaderLoader);
+        void InitRenderPass(PipelineBatch& batch);
         void BindShaderParameters() const;
 
         void BuildTextGeometry(const SDrawCommand& cmd);
-        void BuildTextureGeometry(const SDrawCommand& cmd);
+        void BuildTextureGeometry(const SDrawCommand& cmd, uint32_t atlasIndex);
 
         struct SQuad
         {
@@ -38,13 +42,13 @@ namespace Elixir::GUI
             SColor Color;
             uint32_t AtlasIndex = 0;
             glm::vec2 UnitRange;
-            SRect ScissorRect;
         };
 
-        std::vector<SQuad> m_Quads;
+        TaggedVector<EMemoryTag::GUI, SQuad> m_Quads;
 
         Ref<Shader> m_Shader;
         Ref<GraphicsPipeline> m_Pipeline;
+        GraphicsPipelineFuture m_PendingPipeline;
         Ref<DynamicVertexBuffer> m_QuadBuffer;
 
         float m_DPIScale;
@@ -12,6 +12,20 @@ namespace Elixir::GUI
         UpdateTextSize();
     }
 
+    void TextBlock::Update(const Timestep frameTime)
+    {
+        Widget::Update(frameTime);
+
+        // Glyphs generated since the last measure need drawing and may change the width
+        if (m_GlyphVersion != m_Font->GetGlyphVersion())
+        {
+            const auto desiredSize = m_DesiredSize;
+            UpdateTextSize();
+            if (m_DesiredSize != desiredSize) MarkLayoutDirty();
+            MarkRenderDirty();
+        }
+    }
+
     glm::vec2 TextBlock::ComputeDesiredSize()
     {
         return m_DesiredSize;
@@ -57,7 +71,7 @@ namespace Elixir::GUI
         if (!m_Text.empty())
         {
             const float availableWidth = m_Geometry.Size.x;
-            const auto displayText = ProcessText(m_Text, availableWidth);
+            const auto displayText = ProcessText(availableWidth);
 
             batch.AddText(
                 displayText,
@@ -72,33 +86,27 @@ namespace Elixir::GUI
 
     void TextBlock::UpdateTextSize()
     {
-        m_DesiredSize = FontManager::MeasureText(m_Text, m_Font, m_FontSize);
+        m_GlyphVersion = m_Font->GetGlyphVersion();
+        m_TextAdvances = FontManager::MeasureAdvances(m_Text, m_Font, m_FontSize);
+        m_DesiredSize = {
+            m_TextAdvances.GetWidth(),
+            FontManager::GetLineHeight(m_Font, m_FontSize)
+        };
     }
 
-    std::string TextBlock::ProcessText(
-        const std::string& text,
-        const float availableWidth
-    ) const
+    std::string TextBlock::ProcessText(const float availableWidth) const
     {
-        auto size = FontManager::MeasureText(text, m_Font, m_FontSize);
-        if (size.x <= availableWidth)
-            return text;
+        if (m_TextAdvances.GetWidth() <= availableWidth)
+            return m_Text;
 
-        std::string ellipsis = "...";
+        const std::string ellipsis = "...";
         const float ellipsisWidth = FontManager::MeasureText(ellipsis, m_Font, m_FontSize).x;
 
         if (ellipsisWidth >= availableWidth)
             return ellipsis;
 
-        std::string truncated = text;
-        while (!truncated.empty())
-        {
-            UTF8::UTF8RemoveLastChar(truncated);
-            size = FontManager::MeasureText(truncated, m_Font, m_FontSize);
-            if (size.x + ellipsisWidth <= availableWidth)
-                return truncated + ellipsis;
-        }
-
-        return ellipsis;
+        // Longest prefix that still leaves room for the ellipsis
+        const auto length = m_TextAdvances.GetFittingLength(availableWidth - ellipsisWidth);
+        return m_Text.substr(0, length) + ellipsis;
     }
 }
\ No newline at end of file
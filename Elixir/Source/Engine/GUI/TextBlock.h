@@ -12,6 +12,8 @@ namespace Elixir::GUI
       public:
         explicit TextBlock(const std::string& text);
 
+        void Update(Timestep frameTime) override;
+
         glm::vec2 ComputeDesiredSize() override;
 
         const std::string& GetText() const { return m_Text; }
@@ -31,10 +33,16 @@ namespace Elixir::GUI
 
         void UpdateTextSize();
 
-        std::string ProcessText(const std::string& text, float availableWidth) const;
+        std::string ProcessText(float availableWidth) const;
 
       private:
         std::string m_Text;
+
+        // Pen position at each character boundary of m_Text; refreshed by UpdateTextSize
+        // so truncation is a binary search rather than repeated re-measuring.
+        STextAdvances m_TextAdvances;
+        // Font glyph version m_TextAdvances was measured against
+        uint32_t m_GlyphVersion = 0;
         SColor m_Color{ 1.0, 1.0, 1.0, 1.0 };
         Ref<Font> m_Font;
         float m_FontSize = 16.0f;
@@ -14,12 +14,21 @@ namespace Elixir::GUI
         m_Font = FontManager::GetDefaultFont();
         m_DesiredSize = { 120.0f, 30.0f };
         m_CursorPosition = m_Text.size();
+        UpdateTextAdvances();
     }
 
     void TextField::Update(const Timestep frameTime)
     {
         Widget::Update(frameTime);
         UpdateCursorState(frameTime);
+
+        // Glyphs generated since the last measure need drawing and may move the caret
+        if (m_GlyphVersion != m_Font->GetGlyphVersion())
+        {
+            UpdateTextAdvances();
+            UpdateScrollOffset();
+            MarkRenderDirty();
+        }
     }
 
     glm::vec2 TextField::ComputeDesiredSize()
@@ -33,6 +42,7 @@ namespace Elixir::GUI
         if (!font || m_Font == font) return;
 
         m_Font = font;
+        UpdateTextAdvances();
         UpdateScrollOffset();
         MarkRenderDirty();
     }
@@ -40,6 +50,8 @@ namespace Elixir::GUI
     void TextField::SetFontSize(const float size)
     {
         m_FontSize = size;
+        UpdateTextAdvances();
+        UpdateScrollOffset();
         MarkRenderDirty();
     }
 
@@ -49,6 +61,7 @@ namespace Elixir::GUI
         m_Text = text;
         m_CursorPosition = m_Text.size();
         ClearSelection();
+        UpdateTextAdvances();
         UpdateScrollOffset();
         MarkRenderDirty();
     }
@@ -148,13 +161,13 @@ namespace Elixir::GUI
         const auto textPos = CalculateTextPosition(textSize);
 
         // Selection
-        if (m_SelectionStart != -1 && m_SelectionStart != m_SelectionEnd)
+        if (m_SelectionStart != NO_SELECTION && m_SelectionStart != m_SelectionEnd)
         {
-            const int start = std::min(m_SelectionStart, m_SelectionEnd);
-            const int end = std::max(m_SelectionStart, m_SelectionEnd);
+            const size_t start = std::min(m_SelectionStart, m_SelectionEnd);
+            const size_t end = std::max(m_SelectionStart, m_SelectionEnd);
 
-            const float selx1 = textPos.x + GetTextWidth(m_Text, 0, start);
-            const float selx2 = textPos.x + GetTextWidth(m_Text, 0, end);
+            const float selx1 = textPos.x + GetTextWidth(0, start);
+            const float selx2 = textPos.x + GetTextWidth(0, end);
             const float selectionHeight = std::min(textSize.y + 4.0f, m_Geometry.Size.y - m_Padding.GetTotalVertical());
 
             const auto selectionPos = glm::vec2(selx1, textPos.y - 2.0f);
@@ -200,7 +213,7 @@ namespace Elixir::GUI
 
         // Cursor
         if (m_CursorVisible) {
-            const float textWidth = GetTextWidth(m_Text, 0, m_CursorPosition);
+            const float textWidth = GetTextWidth(0, m_CursorPosition);
             const float cursorX = textPos.x + textWidth + 0.5f;
             const float cursorHeight = textSize.y + 1.0f;
             const auto cursorPos = glm::vec2(cursorX, textPos.y - 0.5f);
@@ -235,7 +248,7 @@ namespace Elixir::GUI
         Widget::HandleMouseDown(event);
 
         const auto x = event.GetX() - m_Geometry.Position.x - m_Padding.Left + m_ScrollOffset;
-        m_CursorPosition = GetCharIndexAtX(m_Text, x);
+        m_CursorPosition = GetCharIndexAtX(x);
         m_SelectionStart = m_CursorPosition;
         m_SelectionEnd = m_CursorPosition;
 
@@ -251,7 +264,7 @@ namespace Elixir::GUI
         if (!IsPressed()) return;
 
         const auto x = event.GetX() - m_Geometry.Position.x - m_Padding.Left + m_ScrollOffset;
-        m_CursorPosition = GetCharIndexAtX(m_Text, x);
+        m_CursorPosition = GetCharIndexAtX(x);
         m_SelectionEnd = m_CursorPosition;
 
         UpdateScrollOffset();
@@ -269,7 +282,7 @@ namespace Elixir::GUI
             case EE_KEY_LEFT:
                 if (event.IsShiftPressed())
                 {
-                    if (m_SelectionStart == -1) m_SelectionStart = m_CursorPosition;
+                    if (m_SelectionStart == NO_SELECTION) m_SelectionStart = m_CursorPosition;
                     MoveCursorLeft();
                     SelectText(m_SelectionStart, m_CursorPosition);
                 }
@@ -282,7 +295,7 @@ namespace Elixir::GUI
             case EE_KEY_RIGHT:
                 if (event.IsShiftPressed())
                 {
-                    if (m_SelectionStart == -1) m_SelectionStart = m_CursorPosition;
+                    if (m_SelectionStart == NO_SELECTION) m_SelectionStart = m_CursorPosition;
                     MoveCursorRight();
                     SelectText(m_SelectionStart, m_CursorPosition);
                 }
@@ -370,38 +383,21 @@ namespace Elixir::GUI
         return textPos;
     }
 
-    float TextField::GetTextWidth(
-        const std::string& text,
-        const int startIndex,
-        const int endIndex
-    ) const
+    void TextField::UpdateTextAdvances()
     {
-        const auto str = text.substr(startIndex, endIndex - startIndex);
-        return FontManager::MeasureText(str, m_Font, m_FontSize).x;
+        m_GlyphVersion = m_Font->GetGlyphVersion();
+        m_TextAdvances = FontManager::MeasureAdvances(m_Text, m_Font, m_FontSize);
     }
 
-    int TextField::GetCharIndexAtX(const std::string& text, const float x) const
+    float TextField::GetTextWidth(const size_t startIndex, const size_t endIndex) const
     {
-        if (text.empty() || x <= 0) return 0;
-
-        int index = 0;
-        float accumX = 0.0f;
-
-        while (index < text.size())
-        {
-            // Get byte length of current UTF-8 character
-            const int charLen = UTF8::UTF8CharLength(text[index]);
-            const float charWidth = GetTextWidth(text, index, index + charLen);
-
-            // Check if click is within this character
-            if (x < accumX + charWidth * 0.5f)
-                return index;
-
-            accumX += charWidth;
-            index += charLen;
-        }
+        return m_TextAdvances.GetPositionAt(endIndex) - m_TextAdvances.GetPositionAt(startIndex);
+    }
 
-        return (int)text.size(); // click past end
+    size_t TextField::GetCharIndexAtX(const float x) const
+    {
+        if (m_Text.empty() || x <= 0) return 0;
+        return m_TextAdvances.GetIndexAtX(x);
     }
 
     void TextField::UpdateCursorState(const Timestep frameTime)
@@ -428,7 +424,7 @@ namespace Elixir::GUI
         const float innerWidth = m_Geometry.Size.x - m_Padding.GetTotalHorizontal();
         if (innerWidth <= 0.0f) return;
 
-        const float cursorX = GetTextWidth(m_Text, 0, m_CursorPosition);
+        const float cursorX = GetTextWidth(0, m_CursorPosition);
 
         // Cursor went past the right edge -> scroll right
         if (cursorX - m_ScrollOffset > innerWidth)
@@ -439,7 +435,7 @@ namespace Elixir::GUI
             m_ScrollOffset = cursorX;
 
         // Clamp: never scroll past the end of the text
-        const float textWidth = GetTextWidth(m_Text, 0, m_Text.size());
+        const float textWidth = m_TextAdvances.GetWidth();
         const float maxScroll = std::max(0.0f, textWidth - innerWidth);
         m_ScrollOffset = std::clamp(m_ScrollOffset, 0.0f, maxScroll);
     }
@@ -458,7 +454,7 @@ namespace Elixir::GUI
 
     void TextField::ClearSelection()
     {
-        m_SelectionStart = m_SelectionEnd = -1;
+        m_SelectionStart = m_SelectionEnd = NO_SELECTION;
     }
 
     void TextField::MoveCursorLeft()
@@ -497,6 +493,7 @@ namespace Elixir::GUI
 
         m_Text.insert(m_CursorPosition, text);
         m_CursorPosition += text.size();
+        UpdateTextAdvances();
         UpdateScrollOffset();
 
         // Fire input changed callback
@@ -510,6 +507,7 @@ namespace Elixir::GUI
         m_Text.erase(start, end - start);
         m_CursorPosition = start;
         ClearSelection();
+        UpdateTextAdvances();
     }
 
     void TextField::ClearNextCharacter()
@@ -524,6 +522,7 @@ namespace Elixir::GUI
         {
             const auto len = UTF8::UTF8CharLength(m_Text[m_CursorPosition]);
             m_Text.erase(m_CursorPosition, len);
+            UpdateTextAdvances();
         }
 
         UpdateScrollOffset();
@@ -545,6 +544,7 @@ namespace Elixir::GUI
             const auto len = UTF8::UTF8PrevCharLength(m_Text, m_CursorPosition);
             m_Text.erase(m_CursorPosition - len, len);
             m_CursorPosition -= len;
+            UpdateTextAdvances();
         }
 
         UpdateScrollOffset();
@@ -94,8 +94,10 @@ namespace Elixir::GUI
         virtual glm::vec2 MeasureTextSize(const std::string& text);
         virtual glm::vec2 CalculateTextPosition(glm::vec2 textSize);
 
-        float GetTextWidth(const std::string& text, int startIndex, int endIndex) const;
-        int GetCharIndexAtX(const std::string& text, float x) const;
+        void UpdateTextAdvances();
+
+        float GetTextWidth(size_t startIndex, size_t endIndex) const;
+        size_t GetCharIndexAtX(float x) const;
 
         void UpdateCursorState(Timestep frameTime);
         void ResetCursorState();
@@ -126,6 +128,12 @@ namespace Elixir::GUI
         std::string m_Text;
         SColor m_TextColor{0.0f, 0.0f, 0.0f, 1.0f};
 
+        // Pen position at each character boundary of m_Text, rebuilt on every text/font
+        // change so caret placement and hit-testing never re-measure substrings.
+        STextAdvances m_TextAdvances;
+        // Font glyph version m_TextAdvances was measured against
+        uint32_t m_GlyphVersion = 0;
+
         std::string m_Placeholder;
         SColor m_PlaceholderColor{0.3f, 0.3f, 0.3f, 1.0f};
 
@@ -154,9 +162,10 @@ namespace Elixir::GUI
         // Horizontal scroll offset for text that exceeds the field width
         float m_ScrollOffset = 0.0f;
 
-        // Selection
-        size_t m_SelectionStart = -1;
-        size_t m_SelectionEnd = -1;
+        // Selection, byte indices like the cursor
+        static constexpr size_t NO_SELECTION = (size_t)-1;
+        size_t m_SelectionStart = NO_SELECTION;
+        size_t m_SelectionEnd = NO_SELECTION;
         SColor m_SelectionColor = { 0.3f, 0.5f, 1.0f, 0.4f };
 
         // Callbacks
@@ -13,7 +13,10 @@ namespace Elixir::GUI
             return;
 
         if (m_Geometry != allocatedSpace)
+        {
             MarkRenderDirty();
+            ++s_LayoutEpoch;
+        }
 
         m_Geometry = allocatedSpace;
         m_LastArrangedSpace = allocatedSpace;
@@ -22,6 +25,16 @@ namespace Elixir::GUI
         m_LayoutDirty = false;
     }
 
+    glm::vec2 Widget::Measure()
+    {
+        if (!m_DesiredSizeDirty)
+            return m_DesiredSize;
+
+        m_DesiredSize = ComputeDesiredSize();
+        m_DesiredSizeDirty = false;
+        return m_DesiredSize;
+    }
+
     void Widget::SetOpacity(const float opacity)
     {
         if (m_Opacity == opacity) return;
@@ -132,10 +145,47 @@ namespace Elixir::GUI
         }
     }
 
-    void Widget::CollectDrawCommands(RenderBatch& batch, int& zCursor, bool& rebuilt)
+    void Widget::CollectDrawCommands(
+        RenderBatch& batch,
+        int& zCursor,
+        bool& rebuilt,
+        const SRect& clipRect
+    )
     {
         if (!IsVisible()) return;
 
+        if (!m_CacheAsLayer)
+        {
+            CollectSubtreeCommands(batch, zCursor, rebuilt, clipRect);
+            return;
+        }
+
+        // Layer contents are collected in their own space: z from 0 and unclipped, the clip
+        // rect applies when the layer is composited.
+        if (m_LayerDirty || !m_LayerBatch)
+        {
+            const auto layer = CreateRef<RenderBatch>();
+            int layerCursor = 0;
+            CollectSubtreeCommands(*layer, layerCursor, rebuilt, {{ -1, -1 }, { -1, -1 }});
+            layer->Sort();
+
+            m_LayerBatch = layer;
+            m_LayerVersion++;
+            m_LayerDirty = false;
+            rebuilt = true;
+        }
+
+        batch.AddLayer(m_LayerBatch, m_Geometry, m_LayerId, m_LayerVersion, zCursor, clipRect);
+        zCursor += 1;
+    }
+
+    void Widget::CollectSubtreeCommands(
+        RenderBatch& batch,
+        int& zCursor,
+        bool& rebuilt,
+        const SRect& clipRect
+    )
+    {
         // Regenerate this widget's own commands only when its visuals/geometry changed.
         if (m_RenderDirty)
         {
@@ -147,25 +197,50 @@ namespace Elixir::GUI
 
         // Own commands occupy [zCursor, zCursor + span); advance so children stack above,
         // and the next sibling starts above this whole subtree.
-        batch.Append(m_CachedCommands, zCursor);
+        batch.Append(m_CachedCommands, zCursor, clipRect);
         zCursor += m_CachedCommands.LayerSpan();
 
+        const SRect childClipRect = GetChildClipRect(clipRect);
         ForEachChild([&](const Ref<Widget>& child)
         {
-            child->CollectDrawCommands(batch, zCursor, rebuilt);
+            child->CollectDrawCommands(batch, zCursor, rebuilt, childClipRect);
         });
     }
 
+    void Widget::SetCacheAsLayer(const bool cache)
+    {
+        if (m_CacheAsLayer == cache) return;
+        m_CacheAsLayer = cache;
+        m_LayerBatch.reset();
+        MarkRenderDirty();
+    }
+
+    SRect Widget::GetChildClipRect(const SRect& clipRect) const
+    {
+        return IsClippingChildren() ? clipRect.Intersect(m_Geometry) : clipRect;
+    }
+
     void Widget::MarkLayoutDirty()
     {
         // Bump before the short-circuit: a change while already dirty must still be seen by
         // the Manager's frame gate (layout changes may move geometry -> the batch is stale).
         ++s_DirtyEpoch;
+        ++s_LayoutEpoch;
 
-        if (m_LayoutDirty)
+        // Ancestors are already dirty unless one of them was measured since; in that case
+        // its memoized desired size is stale and must be invalidated too.
+        if (m_CacheAsLayer)
+            m_LayerDirty = true;
+
+        if (m_LayoutDirty && m_DesiredSizeDirty)
+        {
+            if (const auto parent = m_Parent.lock())
+                parent->InvalidateLayers();
             return;
+        }
 
         m_LayoutDirty = true;
+        m_DesiredSizeDirty = true;
 
         if (const auto parent = m_Parent.lock())
             parent->MarkLayoutDirty();
@@ -175,6 +250,18 @@ namespace Elixir::GUI
     {
         m_RenderDirty = true;
         ++s_DirtyEpoch;
+        InvalidateLayers();
+    }
+
+    void Widget::InvalidateLayers()
+    {
+        // No early out on an already dirty layer: an invisible layer keeps its flag while
+        // its ancestors are collected (and cleaned) without it.
+        if (m_CacheAsLayer)
+            m_LayerDirty = true;
+
+        if (const auto parent = m_Parent.lock())
+            parent->InvalidateLayers();
     }
 
     void Widget::HandleMouseEnter()
@@ -29,10 +29,21 @@ namespace Elixir::GUI
 
         /**
          * Compute how much space this widget wants.
+         * Containers must measure their children through Measure, not this method, so
+         * each widget is computed at most once per layout change.
          * @return a 2d vector representing width and height.
          */
         virtual glm::vec2 ComputeDesiredSize() = 0;
 
+        /**
+         * Get how much space this widget wants, memoized: ComputeDesiredSize only runs when
+         * the layout of this widget (or of a descendant) was invalidated since the last
+         * measure. This is the template method counterpart of ArrangeChildren for the
+         * measure pass, so a full layout costs one measure and one arrange per widget.
+         * @return a 2d vector representing width and height.
+         */
+        glm::vec2 Measure();
+
         /**
          * Arrange this widget in the given space. Short-circuits when the layout is clean and
          * the allocated space is unchanged; otherwise updates geometry and delegates the actual
@@ -57,6 +68,7 @@ namespace Elixir::GUI
         glm::vec2 GetDesiredSize() const { return m_DesiredSize; }
 
         bool IsLayoutDirty() const { return m_LayoutDirty; }
+        bool IsDesiredSizeDirty() const { return m_DesiredSizeDirty; }
         bool IsRenderDirty() const { return m_RenderDirty; }
 
         /**
@@ -67,6 +79,14 @@ namespace Elixir::GUI
          */
         static uint64_t CurrentDirtyEpoch() { return s_DirtyEpoch; }
 
+        /**
+         * Monotonic counter bumped whenever a widget's geometry may have changed (layout
+         * invalidation, tree changes, re-arrangement to a different rectangle). Unlike
+         * CurrentDirtyEpoch it ignores purely visual changes, so the Manager only rebuilds
+         * its hit-test grid when widgets actually moved.
+         */
+        static uint64_t CurrentLayoutEpoch() { return s_LayoutEpoch; }
+
         /* Callbacks */
 
         void OnFocus(const std::function<void()>& callback) { m_OnFocusCallback = callback; }
@@ -110,6 +130,15 @@ namespace Elixir::GUI
         void SetOutlineColor(const SColor& color);
         void SetOutlineThickness(float thickness);
 
+        /**
+         * Render this subtree into an offscreen layer that is only redrawn when something in
+         * it changes, and otherwise composited as a single textured quad. Meant for static
+         * panels that are expensive to fill (shadows, rounded corners, lots of text).
+         * @param cache true to cache this subtree as a layer.
+         */
+        void SetCacheAsLayer(bool cache);
+        bool IsCachedAsLayer() const { return m_CacheAsLayer; }
+
         bool IsHovered() const { return m_Hovered; }
         bool IsPressed() const { return m_Pressed; }
         bool IsFocused() const { return m_Focused; }
@@ -155,13 +184,44 @@ namespace Elixir::GUI
          * Threads a monotonic layer cursor in pre-order: a widget's own commands occupy
          * [zCursor, zCursor + LayerSpan()), children stack above, and the next sibling
          * starts above this widget's whole subtree — so sibling subtrees never overlap
-         * in z.
+         * in z. A subtree cached as a layer is appended as a single layer command.
          *
          * @param batch destination batch.
          * @param zCursor running layer index; advanced past everything this subtree.
          * @param rebuilt set to true if any widget's command cache was regenerated.
+         * @param clipRect rect this subtree is clipped to, or an invalid rect for none.
+         */
+        void CollectDrawCommands(
+            RenderBatch& batch,
+            int& zCursor,
+            bool& rebuilt,
+            const SRect& clipRect = {{ -1, -1 }, { -1, -1 }}
+        );
+
+        /**
+         * Append this widget's own commands and its children's, the uncached path of
+         * CollectDrawCommands.
          */
-        void CollectDrawCommands(RenderBatch& batch, int& zCursor, bool& rebuilt);
+        void CollectSubtreeCommands(
+            RenderBatch& batch,
+            int& zCursor,
+            bool& rebuilt,
+            const SRect& clipRect
+        );
+
+        /**
+         * Whether this widget's children are clipped to its geometry (e.g. scrolling
+         * containers). Clipping applies to both drawing and hit-testing.
+         * @return true to clip children, false otherwise (the default).
+         */
+        virtual bool IsClippingChildren() const { return false; }
+
+        /**
+         * Get the clip rect this widget's children inherit.
+         * @param clipRect the clip rect of this widget.
+         * @return clipRect, narrowed to this widget's geometry if it clips its children.
+         */
+        SRect GetChildClipRect(const SRect& clipRect) const;
 
         /**
          * Build the draw commands for THIS widget only (no children). Containers emit their
@@ -174,23 +234,39 @@ namespace Elixir::GUI
 
         /**
          * Mark this widget's layout as dirty and propagate the mark to ancestors.
-         * A dirty widget (and any ancestor whose layout depends on it) is re-arranged
-         * on the next frame; clean subtrees are skipped by ArrangeChildren.
+         * A dirty widget (and any ancestor whose layout depends on it) is re-measured and
+         * re-arranged on the next frame; clean subtrees are skipped by Measure and
+         * ArrangeChildren.
          */
         void MarkLayoutDirty();
 
         /**
          * Mark this widget's visual output as dirty (color, opacity, shadows, outline, ...).
          * Purely visual changes do not affect layout, so this does NOT touch the layout flag
-         * nor propagate to ancestors — each widget owns its own draw commands.
+         * nor propagate to ancestors — each widget owns its own draw commands. Only the
+         * layers containing this widget are invalidated (see SetCacheAsLayer).
          */
         void MarkRenderDirty();
 
+        /**
+         * Flag the layer of this widget and of every ancestor cached as a layer as stale,
+         * since each of them contains this widget's output.
+         */
+        void InvalidateLayers();
+
         virtual void HandleMouseEnter();
         virtual void HandleMouseLeave();
         virtual void HandleMouseDown(const MouseButtonPressedEvent& event);
         virtual void HandleMouseUp(const MouseButtonReleasedEvent& event);
         virtual void HandleMouseMove(const MouseMovedEvent&  event) {}
+
+        /**
+         * Handle a mouse wheel event while the cursor is over this widget. The Manager offers
+         * it to the widgets under the cursor from the topmost down until one consumes it.
+         * @param event the scroll event.
+         * @return true if the event was consumed.
+         */
+        virtual bool HandleMouseScroll(const MouseScrolledEvent& event) { return false; }
         virtual void HandleKeyPressed(const KeyPressedEvent& event) {}
         virtual void HandleKeyTyped(const KeyTypedEvent& event) {}
         virtual void HandleFocus();
@@ -268,14 +344,32 @@ namespace Elixir::GUI
         bool m_LayoutDirty = true;
         SRect m_LastArrangedSpace{};
 
+        // Desired size memoization; see Measure. Set together with m_LayoutDirty, but
+        // cleared by the measure pass instead of the arrange pass.
+        bool m_DesiredSizeDirty = true;
+
         // Visual dirty flag (color/opacity/shadow/...).
         // Starts dirty so the first frame generates commands.
         bool m_RenderDirty = true;
 
+        // Retained layer; see SetCacheAsLayer. The layer batch is rebuilt (and its version
+        // bumped) when the layer is dirty, so the Renderer only redraws the layer then.
+        bool m_CacheAsLayer = false;
+        bool m_LayerDirty = true;
+        uint64_t m_LayerId = s_NextLayerId++;
+        uint64_t m_LayerVersion = 0;
+        Ref<const RenderBatch> m_LayerBatch;
+
+        inline static uint64_t s_NextLayerId = 1;
+
         // Monotonic "something changed" counter shared by all widgets; see CurrentDirtyEpoch.
         // Bumped by MarkLayoutDirty / MarkRenderDirty.
         inline static uint64_t s_DirtyEpoch = 1;
 
+        // Geometry counterpart of s_DirtyEpoch; see CurrentLayoutEpoch.
+        // Bumped by MarkLayoutDirty and by ArrangeChildren when the geometry changes.
+        inline static uint64_t s_LayoutEpoch = 1;
+
         SRect m_Geometry{};
         glm::vec2 m_DesiredSize{};
 
@@ -173,8 +173,28 @@ namespace Elixir
         //     uint32_t indexCount = 0
         // ) = 0;
 
+        /**
+         * Submit the recorded commands and block until they have executed.
+         */
         virtual void Flush() = 0;
 
+        /**
+         * Submit the recorded commands without waiting for them. The command buffer must
+         * be kept alive until @ref IsComplete returns true.
+         */
+        virtual void SubmitAsync() = 0;
+
+        /**
+         * Check whether the commands submitted by @ref SubmitAsync have executed.
+         * @return true if they have, or if nothing was submitted.
+         */
+        virtual bool IsComplete() const = 0;
+
+        /**
+         * Block until the commands submitted by @ref SubmitAsync have executed.
+         */
+        virtual void Wait() const = 0;
+
         [[nodiscard]] ECommandBufferLevel GetLevel() const { return m_Level; }
         [[nodiscard]] bool IsPrimary() const { return m_Level == ECommandBufferLevel::Primary; }
         [[nodiscard]] bool IsSecondary() const { return m_Level == ECommandBufferLevel::Secondary; }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <Engine/Core/FrameArena.h>
 #include <Engine/Graphics/Shader/ShaderBackend.h>
+#include <Engine/Graphics/Pipeline/PipelineLibrary.h>
 
 #include <glm/glm.hpp>
 
@@ -12,6 +14,8 @@ namespace Elixir
     class Texture2D;
     class CommandBuffer;
     class Pipeline;
+    enum class EImageFormat;
+    enum class EImageUsage;
 
     enum class EGraphicsAPI
     {
@@ -56,12 +60,27 @@ namespace Elixir
         virtual Ref<CommandBuffer> GetUploadCommandBuffer() const = 0;
         virtual void EnqueueSecondaryCommandBuffer(const Ref<CommandBuffer>& cmd) const = 0;
 
+        /**
+         * Check whether the GPU supports images of a format for the given usage, e.g.
+         * before uploading block compressed textures.
+         * @return true if optimally tiled images of the format support the usage.
+         */
+        virtual bool IsFormatSupported(EImageFormat format, EImageUsage usage) const = 0;
+
         [[nodiscard]] EGraphicsAPI GetAPI() const { return m_API; }
 
         const Window* GetWindow() const { return m_Window; }
         float GetDPIScale() const;
 
         const Scope<ShaderBackend>& GetShaderBackend() const { return m_ShaderBackend; }
+        PipelineLibrary* GetPipelineLibrary() const { return m_PipelineLibrary.get(); }
+
+        /**
+         * Arena of the transient data of the frame being rendered, reset at the start of
+         * the frame with the same index, see @ref FrameArena. Only for allocations made
+         * by the render thread, or tasks it waits on, during a frame.
+         */
+        FrameArena* GetFrameArena() const { return m_FrameArena.get(); }
 
         /**
          * The number of frames being processed at a concurrent time. Double buffering.
@@ -93,7 +112,8 @@ namespace Elixir
 
       protected:
         explicit GraphicsContext(const EGraphicsAPI api, const Window* window)
-            : m_API(api), m_Window(window)
+            : m_API(api), m_Window(window), m_PipelineLibrary(CreateScope<PipelineLibrary>(this)),
+              m_FrameArena(CreateScope<FrameArena>(FRAMES))
         {
             EE_PROFILE_ZONE_SCOPED()
         }
@@ -110,6 +130,8 @@ namespace Elixir
         Ref<Texture2D> m_RenderTarget;
         Ref<DepthStencilImage> m_DepthStencilRenderTarget;
         Scope<ShaderBackend> m_ShaderBackend = nullptr;
+        Scope<PipelineLibrary> m_PipelineLibrary;
+        Scope<FrameArena> m_FrameArena;
 
         bool m_VSyncEnabled = false;
     };
@@ -238,6 +238,9 @@ namespace Elixir
         Ref<DepthStencilImage> DepthStencilAttachment = nullptr;
         float DepthClearValue = 1.0f;
         Extent2D RenderArea;
+
+        // Color the attachment is cleared to, or none to keep its contents
+        std::optional<glm::vec4> ClearColor;
     };
 }
 
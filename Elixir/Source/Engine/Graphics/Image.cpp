@@ -31,6 +31,29 @@ namespace Elixir
 
     /* Image */
 
+    size_t Image::GetMemorySize() const
+    {
+        const auto blockBytes = Utils::GetFormatBlockSizeBits(this) / CHAR_BIT;
+        const auto blockExtent = Utils::GetFormatBlockExtent(this);
+
+        size_t size = 0;
+        for (uint32_t level = 0; level < m_MipLevels; level++)
+        {
+            const size_t width = std::max(m_Extent.Width >> level, 1u);
+            const size_t height = std::max(m_Extent.Height >> level, 1u);
+            const size_t depth = std::max(m_Extent.Depth >> level, 1u);
+
+            const size_t blocks =
+                (width + blockExtent.x - 1) / blockExtent.x *
+                ((height + blockExtent.y - 1) / blockExtent.y) *
+                ((depth + blockExtent.z - 1) / blockExtent.z);
+
+            size += blocks * blockBytes;
+        }
+
+        return size * m_ArrayLayers;
+    }
+
     void Image::Transition(const Ref<CommandBuffer>& cmd, const EImageLayout layout)
     {
         Transition(cmd.get(), layout);
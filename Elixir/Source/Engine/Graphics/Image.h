@@ -264,6 +264,13 @@ namespace Elixir
             std::span<SBufferImageCopy> regions = {}
         ) = 0;
 
+        /**
+         * Restrict sampling to the mips from the given level down to the smallest one, e.g.
+         * while the larger mips of a streamed texture are not uploaded yet.
+         * @param level The most detailed mip that can be sampled.
+         */
+        virtual void SetBaseMipLevel(uint32_t level) = 0;
+
         [[nodiscard]] virtual bool IsValid() const = 0;
 
         [[nodiscard]] const UUID& GetUUID() const { return m_UUID; }
@@ -278,6 +285,7 @@ namespace Elixir
         [[nodiscard]] uint32_t GetWidth() const { return m_Extent.Width; }
 
         [[nodiscard]] uint32_t GetMipLevels() const { return m_MipLevels; }
+        [[nodiscard]] uint32_t GetBaseMipLevel() const { return m_BaseMipLevel; }
         [[nodiscard]] uint32_t GetArrayLayers() const { return m_ArrayLayers; }
 
         [[nodiscard]] uint32_t GetBitsPerPixel() const { return m_BitsPerPixel; }
@@ -291,6 +299,13 @@ namespace Elixir
          */
         [[nodiscard]] size_t GetSize() const { return m_Size; }
 
+        /**
+         * Returns the memory used by the image in bytes: all its mips and array layers,
+         * counted in whole blocks for block compressed formats.
+         * @return The image/texture memory size in bytes.
+         */
+        [[nodiscard]] size_t GetMemorySize() const;
+
         [[nodiscard]] bool IsHDR() const { return m_HDR; }
 
         [[nodiscard]] const Ref<Sampler>& GetSampler() const { return m_Sampler; }
@@ -343,6 +358,7 @@ namespace Elixir
         Extent3D m_Extent;
 
         uint32_t m_MipLevels;
+        uint32_t m_BaseMipLevel = 0;
         uint32_t m_ArrayLayers;
 
         uint32_t m_BitsPerPixel;
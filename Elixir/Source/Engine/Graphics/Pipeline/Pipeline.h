@@ -4,6 +4,7 @@
 #include <Engine/Graphics/GraphicsTypes.h>
 #include <Engine/Graphics/Buffer.h>
 #include <Engine/Graphics/Shader/Shader.h>
+#include <Engine/Graphics/Shader/ShaderPermutation.h>
 
 namespace Elixir
 {
@@ -11,6 +12,8 @@ namespace Elixir
     {
         EPrimitiveTopology Topology;
         bool PrimitiveRestartEnable;
+
+        bool operator==(const SPipelineInputAssemblyInfo&) const = default;
     };
 
     struct SPipelineViewportInfo
@@ -31,6 +34,8 @@ namespace Elixir
         float DepthBiasClamp;
         float DepthBiasSlopeFactor;
         float LineWidth;
+
+        bool operator==(const SPipelineRasterizationInfo&) const = default;
     };
 
     struct SPipelineMultisampleInfo
@@ -41,6 +46,8 @@ namespace Elixir
         const SampleMask* SampleMask;
         bool AlphaToCoverageEnable;
         bool AlphaToOneEnable;
+
+        bool operator==(const SPipelineMultisampleInfo&) const = default;
     };
 
     struct SColorBlendAttachment
@@ -54,6 +61,8 @@ namespace Elixir
         EBlendOp AlphaBlendOp;
         EColorComponent ColorWriteMask = EColorComponent::R |
             EColorComponent::G | EColorComponent::B | EColorComponent::A;;
+
+        bool operator==(const SColorBlendAttachment&) const = default;
     };
 
     struct SPipelineColorBlendInfo
@@ -73,6 +82,8 @@ namespace Elixir
         uint32_t CompareMask;
         uint32_t WriteMask;
         uint32_t Reference;
+
+        bool operator==(const SStencilOpState&) const = default;
     };
 
     struct SPipelineDepthStencilInfo
@@ -86,6 +97,8 @@ namespace Elixir
         SStencilOpState Back;
         float MinDepthBounds;
         float MaxDepthBounds;
+
+        bool operator==(const SPipelineDepthStencilInfo&) const = default;
     };
 
     struct SPipelineCreateInfo
@@ -99,6 +112,7 @@ namespace Elixir
         EImageFormat ColorAttachmentFormat;
         EDepthStencilImageFormat DepthAttachmentFormat = EDepthStencilImageFormat::Undefined;
         Ref<Shader> Shader;
+        ShaderPermutation Permutation;
         BufferLayout VertexBufferLayout;
     };
 
@@ -110,14 +124,17 @@ namespace Elixir
         virtual void Bind(const Ref<CommandBuffer>& cmd) = 0;
 
         const Ref<Shader>& GetShader() const { return m_Shader; }
+        const ShaderPermutation& GetPermutation() const { return m_Permutation; }
 
         virtual bool IsGraphics() const = 0;
         virtual bool IsCompute() const = 0;
 
       protected:
-        explicit Pipeline(const SPipelineCreateInfo& info) : m_Shader(info.Shader) {}
+        explicit Pipeline(const SPipelineCreateInfo& info)
+            : m_Shader(info.Shader), m_Permutation(info.Permutation) {}
 
         const Ref<Shader> m_Shader;
+        const ShaderPermutation m_Permutation;
     };
 
     class ELIXIR_API GraphicsPipeline : public Pipeline
@@ -0,0 +1,142 @@
+#include "epch.h"
+#include "PipelineBatch.h"
+
+#include <Engine/Core/Executor/Executor.h>
+#include <Engine/Graphics/GraphicsContext.h>
+
+namespace Elixir
+{
+    PipelineBatch::PipelineBatch(const GraphicsContext* context, const ShaderLoader* shaderLoader)
+        : m_GraphicsContext(context), m_ShaderLoader(shaderLoader)
+    {
+        EE_CORE_ASSERT(context, "Invalid context!")
+        EE_CORE_ASSERT(shaderLoader, "Invalid shader loader!")
+    }
+
+    PipelineBatch::~PipelineBatch()
+    {
+        Wait();
+    }
+
+    template <typename T, typename F>
+    BatchFuture<T> PipelineBatch::Enqueue(F&& create, const Ref<Detail::SBatchRequest>& after)
+    {
+        std::promise<Ref<T>> promise;
+        auto future = promise.get_future().share();
+        auto request = CreateRef<Detail::SBatchRequest>();
+
+        Task task = [promise = std::move(promise), create = std::forward<F>(create), request, wg = &m_WaitGroup]() mutable
+        {
+            try
+            {
+                promise.set_value(create());
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+            }
+
+            std::vector<Task> continuations;
+            {
+                std::lock_guard lock(request->Mutex);
+                request->Finished = true;
+                continuations.swap(request->Continuations);
+            }
+
+            // Counted by the group before this task is done, so waiting never misses them
+            for (auto& continuation : continuations)
+                Executor::Get().Enqueue(std::move(continuation), wg);
+        };
+
+        if (after)
+        {
+            std::lock_guard lock(after->Mutex);
+            if (!after->Finished)
+            {
+                after->Continuations.push_back(std::move(task));
+                return BatchFuture<T>(std::move(future), std::move(request));
+            }
+        }
+
+        Executor::Get().Enqueue(std::move(task), &m_WaitGroup);
+        return BatchFuture<T>(std::move(future), std::move(request));
+    }
+
+    ShaderFuture PipelineBatch::LoadShader(
+        const std::filesystem::path& directory,
+        const std::string& name,
+        const EShaderStage stages
+    )
+    {
+        return LoadShader(directory, { name }, name, stages);
+    }
+
+    ShaderFuture PipelineBatch::LoadShader(
+        const std::filesystem::path& directory,
+        std::vector<std::string> filenames,
+        const std::string& name,
+        const EShaderStage stages
+    )
+    {
+        return Enqueue<Shader>([loader = m_ShaderLoader, directory, filenames = std::move(filenames), name, stages]()
+        {
+            EE_PROFILE_ZONE_SCOPED()
+            const std::vector<std::string_view> views(filenames.begin(), filenames.end());
+            return loader->LoadShader(directory, views, name, stages);
+        });
+    }
+
+    GraphicsPipelineFuture PipelineBatch::Build(PipelineBuilder builder, const ShaderFuture& shader)
+    {
+        EE_CORE_ASSERT(shader.IsValid(), "Invalid shader future!")
+
+        return Enqueue<GraphicsPipeline>([context = m_GraphicsContext, builder = std::move(builder), shader]() mutable
+        {
+            EE_PROFILE_ZONE_SCOPED()
+
+            const auto loaded = shader.Get();
+            if (!loaded) return Ref<GraphicsPipeline>();
+
+            builder.SetShader(loaded);
+            return builder.Build(context);
+        }, shader.m_Request);
+    }
+
+    ComputePipelineFuture PipelineBatch::BuildCompute(
+        const ShaderFuture& shader,
+        const ShaderPermutation& permutation
+    )
+    {
+        EE_CORE_ASSERT(shader.IsValid(), "Invalid shader future!")
+
+        return Enqueue<ComputePipeline>([context = m_GraphicsContext, shader, permutation]()
+        {
+            EE_PROFILE_ZONE_SCOPED()
+
+            const auto loaded = shader.Get();
+            if (!loaded) return Ref<ComputePipeline>();
+
+            return context->GetPipelineLibrary()->GetOrCreate(loaded, permutation);
+        }, shader.m_Request);
+    }
+
+    ComputePipelineFuture PipelineBatch::BuildCompute(
+        const Ref<Shader>& shader,
+        const ShaderPermutation& permutation
+    )
+    {
+        EE_CORE_ASSERT(shader, "Invalid shader!")
+
+        return Enqueue<ComputePipeline>([context = m_GraphicsContext, shader, permutation]()
+        {
+            EE_PROFILE_ZONE_SCOPED()
+            return context->GetPipelineLibrary()->GetOrCreate(shader, permutation);
+        });
+    }
+
+    void PipelineBatch::Wait()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        m_WaitGroup.Wait();
+    }
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <Engine/Core/Executor/Task.h>
+#include <Engine/Core/Executor/WaitGroup.h>
+#include <Engine/Graphics/Pipeline/PipelineBuilder.h>
+#include <Engine/Graphics/Shader/ShaderLoader.h>
+
+#include <future>
+
+namespace Elixir
+{
+    namespace Detail
+    {
+        /**
+         * Completion of a batch request, and the requests depending on it: those are
+         * enqueued once it finishes, so no worker ever blocks waiting for it.
+         */
+        struct SBatchRequest
+        {
+            std::mutex Mutex;
+            bool Finished = false;
+            std::vector<Task> Continuations;
+        };
+    }
+
+    /**
+     * Handle to a shader or pipeline created in the background by a @ref PipelineBatch.
+     */
+    template <typename T>
+    class BatchFuture
+    {
+        friend class PipelineBatch;
+      public:
+        BatchFuture() = default;
+
+        bool IsValid() const { return m_Future.valid(); }
+
+        /**
+         * Check whether the creation has finished, successfully or not.
+         * @return true if the creation has finished.
+         */
+        bool IsReady() const
+        {
+            return m_Future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        /**
+         * Block until the creation has finished. Errors thrown while creating are rethrown.
+         * @return The created object, or nullptr if it cannot be created.
+         */
+        Ref<T> Get() const { return m_Future.get(); }
+
+      private:
+        BatchFuture(std::shared_future<Ref<T>> future, Ref<Detail::SBatchRequest> request)
+            : m_Future(std::move(future)), m_Request(std::move(request)) {}
+
+        std::shared_future<Ref<T>> m_Future;
+        Ref<Detail::SBatchRequest> m_Request;
+    };
+
+    using ShaderFuture = BatchFuture<Shader>;
+    using GraphicsPipelineFuture = BatchFuture<GraphicsPipeline>;
+    using ComputePipelineFuture = BatchFuture<ComputePipeline>;
+
+    /**
+     * Loads shaders and builds pipelines concurrently on the worker threads, so startup
+     * scales with the number of cores instead of reflecting and compiling one shader after
+     * the other. Requests return right away; a pipeline is built as soon as its shader is
+     * loaded. Must be used from a single thread, and waits for its requests on destruction.
+     */
+    class ELIXIR_API PipelineBatch final
+    {
+      public:
+        PipelineBatch(const GraphicsContext* context, const ShaderLoader* shaderLoader);
+        ~PipelineBatch();
+
+        PipelineBatch(const PipelineBatch&) = delete;
+        PipelineBatch& operator=(const PipelineBatch&) = delete;
+
+        /**
+         * Load a shader, see @ref ShaderLoader::LoadShader.
+         * @return A handle to the shader being loaded.
+         */
+        ShaderFuture LoadShader(
+            const std::filesystem::path& directory,
+            const std::string& name,
+            EShaderStage stages = EShaderStage::Graphics
+        );
+
+        ShaderFuture LoadShader(
+            const std::filesystem::path& directory,
+            std::vector<std::string> filenames,
+            const std::string& name,
+            EShaderStage stages = EShaderStage::Graphics
+        );
+
+        /**
+         * Build a graphics pipeline once its shader is loaded. The shader set on the builder
+         * is replaced.
+         * @param builder The pipeline description.
+         * @param shader The shader requested from this batch.
+         * @return A handle to the pipeline being built, resolving to nullptr if the shader
+         * cannot be loaded.
+         */
+        GraphicsPipelineFuture Build(PipelineBuilder builder, const ShaderFuture& shader);
+
+        /**
+         * Build a compute pipeline once its shader is loaded.
+         * @param shader The shader requested from this batch.
+         * @param permutation The variant of the shader to build.
+         * @return A handle to the pipeline being built, resolving to nullptr if the shader
+         * cannot be loaded.
+         */
+        ComputePipelineFuture BuildCompute(
+            const ShaderFuture& shader,
+            const ShaderPermutation& permutation = {}
+        );
+
+        /**
+         * Build a compute pipeline for a shader already loaded, such as another variant of
+         * a shader loaded by an earlier batch.
+         * @param shader The compute shader.
+         * @param permutation The variant of the shader to build.
+         * @return A handle to the pipeline being built.
+         */
+        ComputePipelineFuture BuildCompute(
+            const Ref<Shader>& shader,
+            const ShaderPermutation& permutation = {}
+        );
+
+        /**
+         * Block until every request made so far has finished.
+         */
+        void Wait();
+
+      private:
+        /**
+         * Run a request on a worker.
+         * @param create Creates the requested object.
+         * @param after Request to finish first, so create never waits on it.
+         */
+        template <typename T, typename F>
+        BatchFuture<T> Enqueue(F&& create, const Ref<Detail::SBatchRequest>& after = nullptr);
+
+        const GraphicsContext* m_GraphicsContext;
+        const ShaderLoader* m_ShaderLoader;
+
+        WaitGroup m_WaitGroup;
+    };
+}
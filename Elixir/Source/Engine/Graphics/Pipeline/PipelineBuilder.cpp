@@ -1,6 +1,9 @@
 #include "epch.h"
 #include "PipelineBuilder.h"
 
+#include <Engine/Graphics/GraphicsContext.h>
+#include <Engine/Graphics/Pipeline/PipelineLibrary.h>
+
 namespace Elixir
 {
     PipelineBuilder::PipelineBuilder()
@@ -66,6 +69,21 @@ namespace Elixir
         m_Multisample.RasterizationSamples = ESampleCount::_1;
     }
 
+    void PipelineBuilder::EnablePremultipliedAlphaBlending()
+    {
+        m_ColorBlendAttachment.BlendEnable = true;
+        m_ColorBlendAttachment.SrcColorBlendFactor = EBlendFactor::One;
+        m_ColorBlendAttachment.DstColorBlendFactor = EBlendFactor::OneMinusSrcAlpha;
+        m_ColorBlendAttachment.ColorBlendOp = EBlendOp::Add;
+        m_ColorBlendAttachment.SrcAlphaBlendFactor = EBlendFactor::One;
+        m_ColorBlendAttachment.DstAlphaBlendFactor = EBlendFactor::OneMinusSrcAlpha;
+        m_ColorBlendAttachment.AlphaBlendOp = EBlendOp::Add;
+        m_ColorBlendAttachment.ColorWriteMask = EColorComponent::R |
+            EColorComponent::G | EColorComponent::B | EColorComponent::A;
+
+        m_Multisample.RasterizationSamples = ESampleCount::_1;
+    }
+
     void PipelineBuilder::DisableBlending()
     {
         m_ColorBlendAttachment.BlendEnable = false;
@@ -86,6 +104,19 @@ namespace Elixir
         m_DepthStencil.MaxDepthBounds = 1.0f;
     }
 
+    void PipelineBuilder::EnableDepthTest(const bool depthWrite, const ECompareOp op)
+    {
+        m_DepthStencil.DepthTestEnable = true;
+        m_DepthStencil.DepthWriteEnable = depthWrite;
+        m_DepthStencil.DepthCompareOp = op;
+        m_DepthStencil.DepthBoundsTestEnable = false;
+        m_DepthStencil.StencilTestEnable = false;
+        m_DepthStencil.Front = {};
+        m_DepthStencil.Back = {};
+        m_DepthStencil.MinDepthBounds = 0.0f;
+        m_DepthStencil.MaxDepthBounds = 1.0f;
+    }
+
     void PipelineBuilder::SetColorAttachmentFormat(const EImageFormat format)
     {
         m_ColorAttachmentFormat = format;
@@ -101,6 +132,11 @@ namespace Elixir
         m_Shader = shader;
     }
 
+    void PipelineBuilder::SetPermutation(const ShaderPermutation& permutation)
+    {
+        m_Permutation = permutation;
+    }
+
     void PipelineBuilder::SetBufferLayout(const BufferLayout& layout)
     {
         m_VertexBufferLayout = layout;
@@ -114,7 +150,9 @@ namespace Elixir
         m_DepthStencil = {};
         m_ColorBlendAttachment = {};
         m_Shader = nullptr;
+        m_Permutation = {};
         m_VertexBufferLayout = {};
+        m_ColorAttachmentFormat = EImageFormat::Undefined;
         m_DepthAttachmentFormat = EDepthStencilImageFormat::Undefined;
     }
 
@@ -134,13 +172,121 @@ namespace Elixir
         info.ColorAttachmentFormat = m_ColorAttachmentFormat;
         info.DepthAttachmentFormat = m_DepthAttachmentFormat;
         info.Shader = m_Shader;
+        info.Permutation = m_Permutation;
         info.VertexBufferLayout = m_VertexBufferLayout;
 
         return info;
     }
 
+    size_t PipelineBuilder::GetHash() const
+    {
+        using namespace Hash;
+
+        const auto& ia = m_InputAssembly;
+        const auto& rs = m_Rasterization;
+        const auto& ms = m_Multisample;
+        const auto& cb = m_ColorBlendAttachment;
+        const auto& ds = m_DepthStencil;
+
+        auto seed = HashValues(ia.Topology, ia.PrimitiveRestartEnable);
+
+        HashCombine(seed, HashValues(
+            rs.DepthClampEnable, rs.RasterizerDiscardEnable, rs.PolygonMode, rs.CullMode,
+            rs.FrontFace, rs.DepthBiasEnable, rs.DepthBiasConstantFactor, rs.DepthBiasClamp,
+            rs.DepthBiasSlopeFactor, rs.LineWidth
+        ));
+
+        HashCombine(seed, HashValues(
+            ms.SampleShadingEnable, ms.RasterizationSamples, ms.MinSampleShading, ms.SampleMask,
+            ms.AlphaToCoverageEnable, ms.AlphaToOneEnable
+        ));
+
+        HashCombine(seed, HashValues(
+            cb.BlendEnable, cb.SrcColorBlendFactor, cb.DstColorBlendFactor, cb.ColorBlendOp,
+            cb.SrcAlphaBlendFactor, cb.DstAlphaBlendFactor, cb.AlphaBlendOp, cb.ColorWriteMask
+        ));
+
+        HashCombine(seed, HashValues(
+            ds.DepthTestEnable, ds.DepthWriteEnable, ds.DepthCompareOp, ds.DepthBoundsTestEnable,
+            ds.StencilTestEnable, ds.MinDepthBounds, ds.MaxDepthBounds
+        ));
+
+        for (const auto& op : { ds.Front, ds.Back })
+        {
+            HashCombine(seed, HashValues(
+                op.FailOp, op.PassOp, op.DepthFailOp, op.CompareOp, op.CompareMask, op.WriteMask,
+                op.Reference
+            ));
+        }
+
+        HashCombine(seed, HashValues(m_ColorAttachmentFormat, m_DepthAttachmentFormat, m_Shader.get()));
+        HashCombine(seed, HashValue(m_Permutation.GetKey()));
+
+        for (const auto& binding : m_VertexBufferLayout)
+        {
+            HashCombine(seed, HashValues(binding.GetBinding(), binding.GetStride(), binding.GetInputRate()));
+
+            for (const auto& attribute : binding)
+            {
+                HashCombine(seed, HashValues(attribute.GetType(), attribute.GetOffset(), attribute.IsNormalized()));
+            }
+        }
+
+        return seed;
+    }
+
+    bool PipelineBuilder::operator==(const PipelineBuilder& other) const
+    {
+        if (m_InputAssembly != other.m_InputAssembly ||
+            m_Rasterization != other.m_Rasterization ||
+            m_Multisample != other.m_Multisample ||
+            m_ColorBlendAttachment != other.m_ColorBlendAttachment ||
+            m_DepthStencil != other.m_DepthStencil ||
+            m_ColorAttachmentFormat != other.m_ColorAttachmentFormat ||
+            m_DepthAttachmentFormat != other.m_DepthAttachmentFormat ||
+            m_Shader != other.m_Shader ||
+            m_Permutation != other.m_Permutation)
+        {
+            return false;
+        }
+
+        const auto& bindings = m_VertexBufferLayout.GetBindings();
+        const auto& otherBindings = other.m_VertexBufferLayout.GetBindings();
+        if (bindings.size() != otherBindings.size())
+            return false;
+
+        for (size_t i = 0; i < bindings.size(); i++)
+        {
+            const auto& binding = bindings[i];
+            const auto& otherBinding = otherBindings[i];
+
+            if (binding.GetBinding() != otherBinding.GetBinding() ||
+                binding.GetStride() != otherBinding.GetStride() ||
+                binding.GetInputRate() != otherBinding.GetInputRate() ||
+                binding.GetAttributes().size() != otherBinding.GetAttributes().size())
+            {
+                return false;
+            }
+
+            for (size_t j = 0; j < binding.GetAttributes().size(); j++)
+            {
+                const auto& attribute = binding.GetAttributes()[j];
+                const auto& otherAttribute = otherBinding.GetAttributes()[j];
+
+                if (attribute.GetType() != otherAttribute.GetType() ||
+                    attribute.GetOffset() != otherAttribute.GetOffset() ||
+                    attribute.IsNormalized() != otherAttribute.IsNormalized())
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
     Ref<GraphicsPipeline> PipelineBuilder::Build(const GraphicsContext* context) const
     {
-        return GraphicsPipeline::Create(context, GetCreateInfo());
+        return context->GetPipelineLibrary()->GetOrCreate(*this);
     }
 }
\ No newline at end of file
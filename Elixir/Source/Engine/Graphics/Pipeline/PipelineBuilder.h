@@ -15,16 +15,51 @@ namespace Elixir
         void SetMultisamplingNone();
         void EnableAlphaBlending();
         void EnableAlphaBlendingMax();
+
+        /**
+         * Blend sources whose color is already multiplied by their alpha, such as render
+         * targets drawn with alpha blending over a transparent clear.
+         */
+        void EnablePremultipliedAlphaBlending();
         void DisableBlending();
         void DisableDepthTest();
+
+        /**
+         * Enable depth testing against the depth attachment.
+         * @param depthWrite whether passing fragments write their depth.
+         * @param op the comparison a fragment must pass.
+         */
+        void EnableDepthTest(bool depthWrite, ECompareOp op);
         void SetColorAttachmentFormat(EImageFormat format);
         void SetDepthAttachmentFormat(EDepthStencilImageFormat format);
         void SetShader(const Ref<Shader>& shader);
+
+        /**
+         * Select the shader variant to build, see @ref ShaderPermutation.
+         */
+        void SetPermutation(const ShaderPermutation& permutation);
         void SetBufferLayout(const BufferLayout& layout);
 
         void Clear();
 
         SPipelineCreateInfo GetCreateInfo() const;
+
+        /**
+         * Hash of the whole builder state. Builders with equal state produce equal hashes,
+         * the shader is identified by its instance and permutation key.
+         */
+        size_t GetHash() const;
+
+        /**
+         * Whether two builders describe the same pipeline, comparing the state hashed by
+         * @ref GetHash.
+         */
+        bool operator==(const PipelineBuilder& other) const;
+
+        /**
+         * Returns the pipeline for the current state, shared with every builder of equal
+         * state through the context's PipelineLibrary.
+         */
         Ref<GraphicsPipeline> Build(const GraphicsContext* context) const;
 
       protected:
@@ -38,6 +73,7 @@ namespace Elixir
         EDepthStencilImageFormat m_DepthAttachmentFormat;
 
         Ref<Shader> m_Shader;
+        ShaderPermutation m_Permutation;
         BufferLayout m_VertexBufferLayout;
     };
 }
@@ -0,0 +1,113 @@
+#include "epch.h"
+#include "PipelineLibrary.h"
+
+#include <Engine/Graphics/Pipeline/PipelineBuilder.h>
+
+namespace Elixir
+{
+    // The full key of every pipeline, as different states may share a hash
+    struct PipelineLibrary::SGraphicsEntry
+    {
+        PipelineBuilder Builder;
+        Ref<GraphicsPipeline> Pipeline;
+    };
+
+    struct PipelineLibrary::SComputeEntry
+    {
+        const Shader* ComputeShader;
+        ShaderPermutation Permutation;
+        Ref<ComputePipeline> Pipeline;
+    };
+
+    namespace
+    {
+        template <typename Map, typename Predicate>
+        auto Find(const Map& map, const size_t hash, const Predicate& matches) -> decltype(map.begin()->second->Pipeline)
+        {
+            const auto [begin, end] = map.equal_range(hash);
+            for (auto it = begin; it != end; ++it)
+            {
+                if (matches(*it->second))
+                    return it->second->Pipeline;
+            }
+
+            return nullptr;
+        }
+    }
+
+    PipelineLibrary::PipelineLibrary(const GraphicsContext* context) : m_Context(context)
+    {
+        EE_CORE_ASSERT(context, "Invalid context!")
+    }
+
+    PipelineLibrary::~PipelineLibrary() = default;
+
+    Ref<GraphicsPipeline> PipelineLibrary::GetOrCreate(const PipelineBuilder& builder)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        const auto hash = builder.GetHash();
+        const auto matches = [&](const SGraphicsEntry& entry) { return entry.Builder == builder; };
+
+        {
+            std::lock_guard lock(m_Mutex);
+            if (auto pipeline = Find(m_Pipelines, hash, matches))
+                return pipeline;
+        }
+
+        auto pipeline = GraphicsPipeline::Create(m_Context, builder.GetCreateInfo());
+
+        // Another thread may have built the same pipeline meanwhile, keep the first one
+        std::lock_guard lock(m_Mutex);
+        if (auto existing = Find(m_Pipelines, hash, matches))
+            return existing;
+
+        m_Pipelines.emplace(hash, CreateScope<SGraphicsEntry>(SGraphicsEntry{ builder, pipeline }));
+        return pipeline;
+    }
+
+    Ref<ComputePipeline> PipelineLibrary::GetOrCreate(
+        const Ref<Shader>& shader,
+        const ShaderPermutation& permutation
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        const auto hash = Hash::HashValues(shader.get(), permutation.GetKey());
+        const auto matches = [&](const SComputeEntry& entry)
+        {
+            return entry.ComputeShader == shader.get() && entry.Permutation == permutation;
+        };
+
+        {
+            std::lock_guard lock(m_Mutex);
+            if (auto pipeline = Find(m_ComputePipelines, hash, matches))
+                return pipeline;
+        }
+
+        SPipelineCreateInfo info{};
+        info.Shader = shader;
+        info.Permutation = permutation;
+        auto pipeline = ComputePipeline::Create(m_Context, info);
+
+        std::lock_guard lock(m_Mutex);
+        if (auto existing = Find(m_ComputePipelines, hash, matches))
+            return existing;
+
+        m_ComputePipelines.emplace(hash, CreateScope<SComputeEntry>(SComputeEntry{ shader.get(), permutation, pipeline }));
+        return pipeline;
+    }
+
+    void PipelineLibrary::Clear()
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Pipelines.clear();
+        m_ComputePipelines.clear();
+    }
+
+    size_t PipelineLibrary::GetSize() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Pipelines.size() + m_ComputePipelines.size();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Engine/Core/Core.h>
+
+#include <mutex>
+
+namespace Elixir
+{
+    class GraphicsContext;
+    class GraphicsPipeline;
+    class ComputePipeline;
+    class PipelineBuilder;
+    class Shader;
+    class ShaderPermutation;
+
+    /**
+     * Pipelines of a context, keyed by the PipelineBuilder state that describes them, so
+     * identical pipelines requested by different systems are only built once. Lookups go
+     * through the state hash, and compare the full state on a hit.
+     * Thread-safe; pipelines are built outside the lock, so concurrent requests for different
+     * pipelines do not serialize.
+     */
+    class ELIXIR_API PipelineLibrary final
+    {
+      public:
+        explicit PipelineLibrary(const GraphicsContext* context);
+        ~PipelineLibrary();
+
+        /**
+         * Returns the pipeline for the builder state, building it on first request.
+         * @param builder the pipeline description.
+         * @return the shared pipeline.
+         */
+        Ref<GraphicsPipeline> GetOrCreate(const PipelineBuilder& builder);
+
+        /**
+         * Returns the compute pipeline for a shader variant, building it on first request.
+         * @param shader the compute shader.
+         * @param permutation the variant of the shader.
+         * @return the shared pipeline.
+         */
+        Ref<ComputePipeline> GetOrCreate(const Ref<Shader>& shader, const ShaderPermutation& permutation);
+
+        /**
+         * Release the library's references. Pipelines still held elsewhere stay alive.
+         */
+        void Clear();
+
+        size_t GetSize() const;
+
+      private:
+        struct SGraphicsEntry;
+        struct SComputeEntry;
+
+        const GraphicsContext* m_Context;
+
+        mutable std::mutex m_Mutex;
+        std::unordered_multimap<size_t, Scope<SGraphicsEntry>> m_Pipelines;
+        std::unordered_multimap<size_t, Scope<SComputeEntry>> m_ComputePipelines;
+    };
+}
@@ -2,6 +2,7 @@
 #include "ShaderLoader.h"
 
 #include "ShaderBackend.h"
+#include "ShaderReflectionCache.h"
 
 namespace Elixir
 {
@@ -72,7 +73,8 @@ namespace Elixir
             const auto path = entry.path();
             const auto filename = RemoveFileExtension(path);
             const auto isIncluded = std::ranges::find(filenames, filename) != filenames.end();
-            if (entry.is_regular_file() && path.has_extension() && isIncluded)
+            const auto isReflection = path.extension() == ShaderReflectionCache::EXTENSION;
+            if (entry.is_regular_file() && path.has_extension() && isIncluded && !isReflection)
             {
                 if (const auto stage = GetShaderStage(path))
                     files.push_back({ stage.value(), path });
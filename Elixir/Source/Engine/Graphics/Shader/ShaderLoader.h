@@ -6,10 +6,11 @@
 
 namespace Elixir
 {
-    class ELIXIR_API ShaderLoader final
+    class ELIXIR_API ShaderLoader
     {
       public:
         explicit ShaderLoader(const GraphicsContext* context);
+        virtual ~ShaderLoader() = default;
 
         Ref<Shader> LoadShader(
             const std::filesystem::path& directory,
@@ -17,7 +18,12 @@ namespace Elixir
             EShaderStage stages = EShaderStage::Graphics
         ) const;
 
-        Ref<Shader> LoadShader(
+        /**
+         * Load the shader stages found in a directory. Virtual so the loading can be faked
+         * in tests.
+         * @return The shader, or nullptr if it cannot be loaded.
+         */
+        virtual Ref<Shader> LoadShader(
             const std::filesystem::path& directory,
             std::span<const std::string_view> filenames,
             const std::string& name,
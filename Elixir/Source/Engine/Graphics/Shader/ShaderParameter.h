@@ -16,7 +16,7 @@ namespace Elixir
         None = 0, _1D, _2D, _3D
     };
 
-    class ShaderResource final
+    class ELIXIR_API ShaderResource final
     {
         friend class Shader;
       public:
@@ -68,7 +68,7 @@ namespace Elixir
 
     class ShaderConstantStruct;
 
-    class ShaderConstant final
+    class ELIXIR_API ShaderConstant final
     {
         friend class ShaderConstantStruct;
         friend class ShaderStorageBuffer;
@@ -100,6 +100,7 @@ namespace Elixir
         bool IsArray() const { return m_Count > 1; }
         uint32_t GetSize() const { return m_Size; }
         uint32_t GetOffset() const { return m_Offset; }
+        const Ref<ShaderConstantStruct>& GetStruct() const { return m_Struct; }
 
         ShaderConstant& operator=(const ShaderConstant&) = default;
         ShaderConstant& operator=(ShaderConstant&&) noexcept = default;
@@ -118,7 +119,7 @@ namespace Elixir
         uint32_t m_Offset = 0;
     };
 
-    class ShaderConstantStruct final
+    class ELIXIR_API ShaderConstantStruct final
     {
         friend class ShaderConstant;
 
@@ -0,0 +1,44 @@
+#include "epch.h"
+#include "ShaderPermutation.h"
+
+#include <bit>
+
+namespace Elixir
+{
+    ShaderPermutation& ShaderPermutation::Set(const uint32_t id, const uint32_t value)
+    {
+        const auto it = std::ranges::lower_bound(m_Constants, id, {}, &SSpecializationConstant::Id);
+        if (it != m_Constants.end() && it->Id == id)
+        {
+            it->Value = value;
+            return *this;
+        }
+
+        m_Constants.insert(it, { id, value });
+        return *this;
+    }
+
+    ShaderPermutation& ShaderPermutation::Set(const uint32_t id, const int32_t value)
+    {
+        return Set(id, std::bit_cast<uint32_t>(value));
+    }
+
+    ShaderPermutation& ShaderPermutation::Set(const uint32_t id, const float value)
+    {
+        return Set(id, std::bit_cast<uint32_t>(value));
+    }
+
+    ShaderPermutation& ShaderPermutation::Set(const uint32_t id, const bool value)
+    {
+        return Set(id, value ? 1u : 0u);
+    }
+
+    uint64_t ShaderPermutation::GetKey() const
+    {
+        if (m_Constants.empty())
+            return 0;
+
+        static_assert(std::has_unique_object_representations_v<SSpecializationConstant>);
+        return Hash::HashBytes(m_Constants.data(), m_Constants.size() * sizeof(SSpecializationConstant));
+    }
+}
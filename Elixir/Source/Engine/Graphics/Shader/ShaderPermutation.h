@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Engine/Core/Core.h>
+
+namespace Elixir
+{
+    /**
+     * Value of a specialization constant, declared in HLSL as
+     * `[[vk::constant_id(Id)]] const uint Name = Default;`.
+     */
+    struct SSpecializationConstant
+    {
+        uint32_t Id = 0;
+
+        // Raw 32-bit value: bools are 0/1, floats and signed ints are stored bitwise
+        uint32_t Value = 0;
+
+        bool operator==(const SSpecializationConstant&) const = default;
+    };
+
+    /**
+     * A variant of a shader, selected by the values of its specialization constants. The
+     * values are baked when the pipeline is built, so the driver folds branches on them
+     * away instead of evaluating them per invocation. Constants left unset keep the default
+     * declared in the shader.
+     */
+    class ELIXIR_API ShaderPermutation final
+    {
+      public:
+        ShaderPermutation() = default;
+
+        ShaderPermutation& Set(uint32_t id, uint32_t value);
+        ShaderPermutation& Set(uint32_t id, int32_t value);
+        ShaderPermutation& Set(uint32_t id, float value);
+        ShaderPermutation& Set(uint32_t id, bool value);
+
+        /**
+         * Constants set on this permutation, sorted by id.
+         */
+        const std::vector<SSpecializationConstant>& GetConstants() const { return m_Constants; }
+
+        bool IsEmpty() const { return m_Constants.empty(); }
+
+        /**
+         * Key identifying the permutation, stable across runs. Equal permutations have equal
+         * keys, the default permutation has key 0.
+         */
+        uint64_t GetKey() const;
+
+        bool operator==(const ShaderPermutation&) const = default;
+
+      private:
+        std::vector<SSpecializationConstant> m_Constants;
+    };
+}
@@ -0,0 +1,318 @@
+#include "epch.h"
+#include "ShaderReflectionCache.h"
+
+#include <Engine/Core/File.h>
+#include <Engine/Core/MappedFile.h>
+
+namespace Elixir
+{
+    namespace
+    {
+        // File layout: header, then the module as a stream of little records. Strings and
+        // arrays are prefixed by their length; struct constants are followed by their fields.
+        // Member offsets are not stored, they are recomputed as the members are pushed back.
+        struct SReflectionHeader
+        {
+            uint32_t Magic;
+            uint32_t Version;
+            uint64_t Key;
+        };
+
+        class ReflectionWriter
+        {
+          public:
+            void Write(const void* data, const size_t size)
+            {
+                const auto bytes = (const Byte*)data;
+                m_Data.insert(m_Data.end(), bytes, bytes + size);
+            }
+
+            template <typename T>
+            void Write(const T& value)
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                Write(&value, sizeof(T));
+            }
+
+            void Write(const std::string& value)
+            {
+                Write((uint32_t)value.size());
+                Write(value.data(), value.size());
+            }
+
+            void Write(const std::vector<ShaderConstant>& constants)
+            {
+                Write((uint32_t)constants.size());
+                for (const auto& constant : constants)
+                {
+                    Write(constant.GetName());
+                    Write(constant.GetType());
+                    Write(constant.GetCount());
+                    Write((uint8_t)constant.IsPointer());
+
+                    if (constant.GetType() == EConstantType::Struct)
+                    {
+                        const auto& structure = constant.GetStruct();
+                        Write(structure->GetName());
+                        Write(structure->GetFields());
+                    }
+                }
+            }
+
+            const std::vector<Byte>& GetData() const { return m_Data; }
+
+          private:
+            std::vector<Byte> m_Data;
+        };
+
+        class ReflectionReader
+        {
+          public:
+            explicit ReflectionReader(const std::span<const Byte> data) : m_Data(data) {}
+
+            bool Read(void* data, const size_t size)
+            {
+                if (m_Failed || m_Data.size() - m_Offset < size)
+                {
+                    m_Failed = true;
+                    return false;
+                }
+
+                std::memcpy(data, m_Data.data() + m_Offset, size);
+                m_Offset += size;
+                return true;
+            }
+
+            template <typename T>
+            T Read()
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                T value = {};
+                Read(&value, sizeof(T));
+                return value;
+            }
+
+            std::string ReadString()
+            {
+                const auto size = Read<uint32_t>();
+                if (m_Failed || m_Data.size() - m_Offset < size)
+                {
+                    m_Failed = true;
+                    return {};
+                }
+
+                std::string value((const char*)m_Data.data() + m_Offset, size);
+                m_Offset += size;
+                return value;
+            }
+
+            /**
+             * Read a list of constants, handing each one to the given callback.
+             */
+            template <typename F>
+            void ReadConstants(F&& push)
+            {
+                const auto count = Read<uint32_t>();
+                for (uint32_t i = 0; i < count && !m_Failed; i++)
+                {
+                    auto name = ReadString();
+                    const auto type = Read<EConstantType>();
+                    const auto arraySize = Read<uint32_t>();
+                    const auto pointer = Read<uint8_t>() != 0;
+
+                    if (m_Failed || type > EConstantType::Mat4)
+                    {
+                        m_Failed = true;
+                        return;
+                    }
+
+                    if (type != EConstantType::Struct)
+                    {
+                        push(ShaderConstant(name, type, arraySize, pointer));
+                        continue;
+                    }
+
+                    auto structure = CreateRef<ShaderConstantStruct>(ReadString());
+                    ReadConstants([&](ShaderConstant&& field) { structure->AddField(std::move(field)); });
+                    if (m_Failed) return;
+
+                    push(ShaderConstant(name, std::move(structure), arraySize, pointer));
+                }
+            }
+
+            void Fail() { m_Failed = true; }
+
+            bool IsValid() const { return !m_Failed; }
+            bool IsAtEnd() const { return m_Offset == m_Data.size(); }
+
+          private:
+            std::span<const Byte> m_Data;
+            size_t m_Offset = 0;
+            bool m_Failed = false;
+        };
+    }
+
+    static uint64_t ComputeKey(const std::span<const Byte> bytecode)
+    {
+        return Hash::HashBytes(bytecode.data(), bytecode.size());
+    }
+
+    std::filesystem::path ShaderReflectionCache::GetPath(const std::filesystem::path& filepath)
+    {
+        auto path = filepath;
+        return path.replace_extension(EXTENSION);
+    }
+
+    bool ShaderReflectionCache::Write(
+        const std::filesystem::path& filepath,
+        const std::span<const Byte> bytecode,
+        const SShaderModuleCreateInfo& module
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        ReflectionWriter writer;
+        writer.Write(SReflectionHeader{ MAGIC, VERSION, ComputeKey(bytecode) });
+        writer.Write(module.Entrypoint);
+
+        writer.Write((uint32_t)module.Resources.size());
+        for (const auto& resource : module.Resources)
+        {
+            writer.Write(resource.GetName());
+            writer.Write(resource.GetSet());
+            writer.Write(resource.GetBinding());
+            writer.Write(resource.GetType());
+            writer.Write(resource.GetDimension());
+            writer.Write(resource.GetCount());
+            writer.Write((uint8_t)resource.IsBindless());
+        }
+
+        writer.Write((uint32_t)module.StorageBuffers.size());
+        for (const auto& buffer : module.StorageBuffers)
+        {
+            writer.Write(buffer.GetName());
+            writer.Write(buffer.GetSet());
+            writer.Write(buffer.GetBinding());
+            writer.Write(buffer.GetConstants());
+        }
+
+        writer.Write((uint32_t)module.ConstantBuffers.size());
+        for (const auto& buffer : module.ConstantBuffers)
+        {
+            writer.Write(buffer.GetName());
+            writer.Write(buffer.GetSet());
+            writer.Write(buffer.GetBinding());
+            writer.Write(buffer.GetConstants());
+        }
+
+        writer.Write((uint32_t)module.PushConstants.size());
+        for (const auto& constant : module.PushConstants)
+        {
+            writer.Write(constant.GetName());
+            writer.Write(constant.GetSet());
+            writer.Write(constant.GetBinding());
+            writer.Write(constant.GetOffset());
+            writer.Write(constant.GetConstants());
+        }
+
+        if (!WriteFileAtomic(filepath, writer.GetData()))
+        {
+            EE_CORE_WARN("Cannot write shader reflection! [Path={0}]", filepath.string())
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<SShaderModuleCreateInfo> ShaderReflectionCache::Read(
+        const std::filesystem::path& filepath,
+        const std::span<const Byte> bytecode
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        const auto file = MappedFile::Open(filepath);
+        if (!file)
+            return std::nullopt;
+
+        ReflectionReader reader({ file->GetData(), file->GetSize() });
+
+        const auto header = reader.Read<SReflectionHeader>();
+        if (!reader.IsValid() || header.Magic != MAGIC || header.Version != VERSION)
+        {
+            EE_CORE_WARN("Ignoring invalid shader reflection! [Path={0}]", filepath.string())
+            return std::nullopt;
+        }
+
+        if (header.Key != ComputeKey(bytecode))
+        {
+            EE_CORE_WARN("Ignoring stale shader reflection! [Path={0}]", filepath.string())
+            return std::nullopt;
+        }
+
+        SShaderModuleCreateInfo module = {};
+        module.Entrypoint = reader.ReadString();
+
+        const auto resourceCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < resourceCount && reader.IsValid(); i++)
+        {
+            auto name = reader.ReadString();
+            const auto set = reader.Read<uint32_t>();
+            const auto binding = reader.Read<uint32_t>();
+            const auto type = reader.Read<EResourceType>();
+            const auto dimension = reader.Read<EResourceDimension>();
+            const auto count = reader.Read<uint32_t>();
+            const auto bindless = reader.Read<uint8_t>() != 0;
+
+            if (type > EResourceType::Sampler || dimension > EResourceDimension::_3D)
+            {
+                reader.Fail();
+                break;
+            }
+
+            module.Resources.emplace_back(name, set, binding, type, dimension, count, bindless);
+        }
+
+        const auto storageBufferCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < storageBufferCount && reader.IsValid(); i++)
+        {
+            auto name = reader.ReadString();
+            const auto set = reader.Read<uint32_t>();
+            const auto binding = reader.Read<uint32_t>();
+
+            auto& buffer = module.StorageBuffers.emplace_back(name, set, binding);
+            reader.ReadConstants([&](ShaderConstant&& constant) { buffer.PushConstant(std::move(constant)); });
+        }
+
+        const auto constantBufferCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < constantBufferCount && reader.IsValid(); i++)
+        {
+            auto name = reader.ReadString();
+            const auto set = reader.Read<uint32_t>();
+            const auto binding = reader.Read<uint32_t>();
+
+            auto& buffer = module.ConstantBuffers.emplace_back(name, set, binding);
+            reader.ReadConstants([&](ShaderConstant&& constant) { buffer.PushConstant(std::move(constant)); });
+        }
+
+        const auto pushConstantCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < pushConstantCount && reader.IsValid(); i++)
+        {
+            auto name = reader.ReadString();
+            const auto set = reader.Read<uint32_t>();
+            const auto binding = reader.Read<uint32_t>();
+            const auto offset = reader.Read<uint32_t>();
+
+            auto& pushConstant = module.PushConstants.emplace_back(name, set, binding, offset);
+            reader.ReadConstants([&](ShaderConstant&& constant) { pushConstant.PushConstant(std::move(constant)); });
+        }
+
+        if (!reader.IsValid() || !reader.IsAtEnd())
+        {
+            EE_CORE_WARN("Ignoring corrupted shader reflection! [Path={0}]", filepath.string())
+            return std::nullopt;
+        }
+
+        return module;
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Engine/Graphics/Shader/Shader.h>
+
+namespace Elixir
+{
+    /**
+     * Reflected layout of a shader module (entrypoint, resource bindings, buffer and push
+     * constant members) serialized next to its bytecode at build time, so loading a shader
+     * does not need to run reflection. The file is keyed by the bytecode it was generated
+     * from: recompiling the shader without regenerating the file makes it stale, and the
+     * backend then falls back to reflecting the bytecode.
+     */
+    class ELIXIR_API ShaderReflectionCache
+    {
+      public:
+        static constexpr uint32_t MAGIC = 0x46524545; // "EERF"
+        static constexpr uint32_t VERSION = 1;
+        static inline const std::string EXTENSION = ".reflect";
+
+        /**
+         * Get the reflection file path of a shader module: X.vs.spirv -> X.vs.reflect.
+         * @param filepath The shader module file path.
+         */
+        static std::filesystem::path GetPath(const std::filesystem::path& filepath);
+
+        /**
+         * Write a reflection file, replacing the existing one atomically.
+         * @param filepath The reflection file path.
+         * @param bytecode The bytecode the module was reflected from.
+         * @param module The reflected module. Path and bytecode are not stored.
+         * @return true if the file was written.
+         */
+        static bool Write(
+            const std::filesystem::path& filepath,
+            std::span<const Byte> bytecode,
+            const SShaderModuleCreateInfo& module
+        );
+
+        /**
+         * Read a reflection file.
+         * @param filepath The reflection file path.
+         * @param bytecode The bytecode of the module being loaded.
+         * @return The reflected module, without path and bytecode, or std::nullopt if the
+         * file is missing, stale or corrupted.
+         */
+        static std::optional<SShaderModuleCreateInfo> Read(
+            const std::filesystem::path& filepath,
+            std::span<const Byte> bytecode
+        );
+    };
+}
@@ -59,6 +59,16 @@ namespace Elixir
             const std::string& path = ""
         );
 
+        /**
+         * Create a texture from a full image description, e.g. to render into it
+         * (EImageUsage::ColorAttachment).
+         */
+        static Ref<Texture2D> Create(
+            const GraphicsContext* context,
+            const SImageCreateInfo& info,
+            const std::string& path = ""
+        );
+
         static SImageCreateInfo CreateImageInfo(
             EImageFormat format,
             uint32_t width,
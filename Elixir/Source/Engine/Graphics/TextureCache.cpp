@@ -0,0 +1,199 @@
+#include "epch.h"
+#include "TextureCache.h"
+
+namespace Elixir
+{
+    TextureCache::TextureCache(Ref<TextureSet> textureSet, const size_t budget)
+        : m_TextureSet(std::move(textureSet))
+    {
+        m_Stats.Budget = budget;
+    }
+
+    TextureCache::~TextureCache()
+    {
+        // Textures still in use are kept alive by their references
+        if (m_TextureSet)
+        {
+            for (const auto& entry : m_Entries | std::views::values)
+                m_TextureSet->RemoveTexture(entry.Handle);
+        }
+    }
+
+    Ref<Texture> TextureCache::GetOrLoad(const std::string& key, const Loader& load)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        {
+            std::lock_guard lock(m_Mutex);
+            const auto it = m_Entries.find(key);
+            if (it != m_Entries.end())
+            {
+                m_Stats.Hits++;
+                return Acquire(key, it->second);
+            }
+
+            m_Stats.Misses++;
+        }
+
+        auto texture = load();
+        if (!texture) return nullptr;
+
+        std::lock_guard lock(m_Mutex);
+
+        // Loaded concurrently under the same key, keep the first one
+        const auto [it, inserted] = m_Entries.try_emplace(key);
+        auto& entry = it->second;
+        if (inserted)
+        {
+            entry.Texture = std::move(texture);
+            entry.Size = entry.Texture->GetMemorySize();
+            if (m_TextureSet)
+            {
+                entry.Handle = m_TextureSet->AddTexture(entry.Texture);
+                m_Handles[entry.Texture.get()] = entry.Handle;
+            }
+
+            m_Stats.ResidentBytes += entry.Size;
+            m_Stats.TextureCount++;
+        }
+
+        return Acquire(key, entry);
+    }
+
+    Ref<Texture> TextureCache::Find(const std::string& key)
+    {
+        std::lock_guard lock(m_Mutex);
+
+        const auto it = m_Entries.find(key);
+        if (it == m_Entries.end()) return nullptr;
+
+        m_Stats.Hits++;
+        return Acquire(key, it->second);
+    }
+
+    SResourceHandle TextureCache::GetHandle(const std::string& key) const
+    {
+        std::lock_guard lock(m_Mutex);
+
+        const auto it = m_Entries.find(key);
+        return it != m_Entries.end() ? it->second.Handle : SResourceHandle{};
+    }
+
+    SResourceHandle TextureCache::GetHandle(const Texture* texture) const
+    {
+        std::lock_guard lock(m_Mutex);
+
+        const auto it = m_Handles.find(texture);
+        return it != m_Handles.end() ? it->second : SResourceHandle{};
+    }
+
+    void TextureCache::Update()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        std::lock_guard lock(m_Mutex);
+        m_Frame++;
+
+        while (m_Stats.ResidentBytes > m_Stats.Budget && !m_Unused.empty())
+        {
+            const auto it = m_Entries.find(m_Unused.front());
+
+            // Released later than the first one, the others are recent too
+            if (it->second.ReleasedFrame + EVICTION_DELAY > m_Frame)
+                break;
+
+            Evict(it);
+        }
+    }
+
+    void TextureCache::Clear()
+    {
+        std::lock_guard lock(m_Mutex);
+
+        while (!m_Unused.empty())
+            Evict(m_Entries.find(m_Unused.front()));
+    }
+
+    void TextureCache::SetBudget(const size_t budget)
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Stats.Budget = budget;
+    }
+
+    size_t TextureCache::GetBudget() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Stats.Budget;
+    }
+
+    STextureCacheStats TextureCache::GetStats() const
+    {
+        std::lock_guard lock(m_Mutex);
+        return m_Stats;
+    }
+
+    Ref<Texture> TextureCache::Acquire(const std::string& key, SEntry& entry)
+    {
+        if (auto user = entry.User.lock())
+            return user;
+
+        if (entry.Users++ == 0)
+        {
+            if (entry.Unused)
+                m_Unused.erase(*entry.Unused);
+
+            entry.Unused.reset();
+            m_Stats.ReferencedBytes += entry.Size;
+            m_Stats.ReferencedCount++;
+        }
+
+        // A new control block over the cached texture. It keeps the texture alive on its
+        // own, in case the cache is destroyed first, and reports its release.
+        Ref<Texture> user(
+            entry.Texture.get(),
+            [texture = entry.Texture, cache = weak_from_this(), key](Texture*)
+            {
+                if (const auto self = cache.lock())
+                    self->Release(key);
+            }
+        );
+
+        entry.User = user;
+        return user;
+    }
+
+    void TextureCache::Release(const std::string& key)
+    {
+        std::lock_guard lock(m_Mutex);
+
+        const auto it = m_Entries.find(key);
+        if (it == m_Entries.end()) return;
+
+        auto& entry = it->second;
+        if (--entry.Users > 0) return;
+
+        entry.ReleasedFrame = m_Frame;
+        entry.Unused = m_Unused.insert(m_Unused.end(), key);
+        m_Stats.ReferencedBytes -= entry.Size;
+        m_Stats.ReferencedCount--;
+    }
+
+    void TextureCache::Evict(const std::unordered_map<std::string, SEntry>::iterator it)
+    {
+        auto& entry = it->second;
+        EE_CORE_ASSERT(entry.Users == 0, "Evicting a texture in use!")
+
+        if (m_TextureSet)
+        {
+            m_TextureSet->RemoveTexture(entry.Handle);
+            m_Handles.erase(entry.Texture.get());
+        }
+
+        m_Unused.erase(*entry.Unused);
+        m_Stats.ResidentBytes -= entry.Size;
+        m_Stats.TextureCount--;
+        m_Stats.Evictions++;
+
+        m_Entries.erase(it);
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <Engine/Graphics/GraphicsContext.h>
+#include <Engine/Graphics/Texture.h>
+#include <Engine/Graphics/TextureSet.h>
+
+#include <list>
+
+namespace Elixir
+{
+    struct STextureCacheStats
+    {
+        // Memory of all the cached textures, in use or not
+        size_t ResidentBytes = 0;
+
+        // Memory of the textures in use outside the cache, which cannot be evicted
+        size_t ReferencedBytes = 0;
+
+        size_t Budget = 0;
+        uint32_t TextureCount = 0;
+        uint32_t ReferencedCount = 0;
+
+        uint64_t Hits = 0;
+        uint64_t Misses = 0;
+        uint64_t Evictions = 0;
+    };
+
+    /**
+     * Keeps one texture per key (e.g. path and format), registered once in the bindless
+     * texture set, so loading the same image twice shares the GPU image and its slot.
+     *
+     * The references handed out are counted: when the last one is released the texture
+     * stays cached, and textures unused for the longest time are evicted by @ref Update
+     * while the resident memory exceeds the budget.
+     *
+     * Must be held by a Ref, released references notify the cache through a weak reference.
+     */
+    class ELIXIR_API TextureCache : public std::enable_shared_from_this<TextureCache>
+    {
+      public:
+        static constexpr size_t DEFAULT_BUDGET = 256 * 1024 * 1024;
+
+        // Unused textures are kept this many updates, frames in flight may still sample them
+        static constexpr uint32_t EVICTION_DELAY = GraphicsContext::FRAMES + 1;
+
+        using Loader = std::function<Ref<Texture>()>;
+
+        /**
+         * @param textureSet The set cached textures are registered in, or nullptr to not
+         * register them.
+         * @param budget The resident memory budget in bytes.
+         */
+        explicit TextureCache(Ref<TextureSet> textureSet, size_t budget = DEFAULT_BUDGET);
+        ~TextureCache();
+
+        TextureCache(const TextureCache&) = delete;
+        TextureCache& operator=(const TextureCache&) = delete;
+
+        /**
+         * Get the texture cached under a key, or load and cache it.
+         * @param key The texture key.
+         * @param load Creates the texture on a miss. Called without the cache locked.
+         * @return A reference to the texture, or nullptr if it cannot be loaded.
+         */
+        Ref<Texture> GetOrLoad(const std::string& key, const Loader& load);
+
+        /**
+         * Get the texture cached under a key.
+         * @return A reference to the texture, or nullptr if it is not cached.
+         */
+        Ref<Texture> Find(const std::string& key);
+
+        /**
+         * Get the bindless handle of a cached texture.
+         * @return The handle, or an invalid handle if the texture is not cached or the cache
+         * has no texture set.
+         */
+        SResourceHandle GetHandle(const std::string& key) const;
+
+        /**
+         * Get the bindless handle of a texture handed out by the cache. Renderers use it
+         * instead of registering the texture in their own set, which would take another
+         * slot and keep the texture alive past its eviction.
+         * @return The handle, or an invalid handle if the texture is not cached or the cache
+         * has no texture set.
+         */
+        SResourceHandle GetHandle(const Texture* texture) const;
+
+        /**
+         * Evict unused textures, least recently used first, until the resident memory fits
+         * the budget. Must be called once per frame.
+         */
+        void Update();
+
+        /**
+         * Evict all the unused textures, regardless of the budget and of the frames in
+         * flight. The caller must make sure the GPU is idle.
+         */
+        void Clear();
+
+        void SetBudget(size_t budget);
+        size_t GetBudget() const;
+
+        STextureCacheStats GetStats() const;
+
+      private:
+        struct SEntry
+        {
+            Ref<Texture> Texture;
+            SResourceHandle Handle;
+            size_t Size = 0;
+
+            // The references handed out share a single control block, its number of
+            // instances alive is counted to know when the texture is unused
+            std::weak_ptr<Elixir::Texture> User;
+            uint32_t Users = 0;
+
+            // Position in the unused list, while there are no users
+            uint64_t ReleasedFrame = 0;
+            std::optional<std::list<std::string>::iterator> Unused;
+        };
+
+        Ref<Texture> Acquire(const std::string& key, SEntry& entry);
+        void Release(const std::string& key);
+        void Evict(std::unordered_map<std::string, SEntry>::iterator it);
+
+        Ref<TextureSet> m_TextureSet;
+        std::unordered_map<std::string, SEntry> m_Entries;
+
+        // Handles of the registered textures, by texture
+        std::unordered_map<const Texture*, SResourceHandle> m_Handles;
+
+        // Keys of the unused textures, least recently released first
+        std::list<std::string> m_Unused;
+
+        uint64_t m_Frame = 0;
+        STextureCacheStats m_Stats;
+        mutable std::mutex m_Mutex;
+    };
+}
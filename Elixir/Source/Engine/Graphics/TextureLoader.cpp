@@ -3,6 +3,9 @@
 
 #include "Utils.h"
 
+#include <Engine/Core/Executor/Executor.h>
+#include <Engine/Graphics/TextureMips.h>
+
 #include <stb_image.h>
 
 namespace Elixir
@@ -22,15 +25,335 @@ namespace Elixir
         )
     }
 
+    /**
+     * State of a texture loaded by TextureLoader::LoadAsync. The worker thread fills Mips and
+     * Format, then publishes them by setting State to Decoded. The main thread publishes
+     * Texture by setting Ready. Everything else is only touched by the main thread, except
+     * the awaiting coroutines.
+     */
+    struct STextureStream
+    {
+        enum class EState : uint8_t
+        {
+            Decoding, Decoded, Failed, Streaming, Streamed
+        };
+
+        std::filesystem::path Path;
+        std::string Key;
+        STextureLoadOptions Options;
+        EImageFormat BlockFormat = EImageFormat::Undefined;
+        std::atomic<EState> State = EState::Decoding;
+
+        EImageFormat Format = EImageFormat::Undefined;
+        bool HDR = false;
+        std::vector<STextureMip> Mips;
+
+        Ref<Texture2D> Texture;
+        uint32_t ResidentMip = 0;
+        std::atomic<bool> Ready = false;
+
+        // Mips submitted to the GPU and not exposed yet, no other mip is recorded meanwhile
+        bool Uploading = false;
+
+        // Coroutines awaiting the texture, until it is ready or the load failed
+        std::mutex WaitersMutex;
+        std::vector<std::coroutine_handle<>> Waiters;
+        bool Settled = false;
+    };
+
+    namespace
+    {
+        std::string GetCacheKey(
+            const std::filesystem::path& path,
+            const EImageFormat format,
+            const STextureLoadOptions* options = nullptr
+        )
+        {
+            auto key = std::format("{0}|{1}", path.lexically_normal().generic_string(), (int)format);
+            if (options)
+                key += std::format("|{0}{1}", options->GenerateMips ? "M" : "", options->Compress ? "C" : "");
+
+            return key;
+        }
+
+        struct SDecodedImage
+        {
+            void* Data = nullptr;
+            int Width = 0;
+            int Height = 0;
+            int Channels = 0;
+            bool HDR = false;
+        };
+
+        SDecodedImage DecodeImage(const std::string& path)
+        {
+            SDecodedImage image;
+
+            if (stbi_is_hdr(path.c_str()))
+            {
+                image.HDR = true;
+                image.Data = stbi_loadf(
+                    path.c_str(),
+                    &image.Width,
+                    &image.Height,
+                    &image.Channels,
+                    STBI_rgb_alpha
+                );
+            }
+            else
+            {
+                image.Data = stbi_load(
+                    path.c_str(),
+                    &image.Width,
+                    &image.Height,
+                    &image.Channels,
+                    STBI_rgb_alpha
+                );
+            }
+
+            return image;
+        }
+
+        void DecodeStream(STextureStream& stream)
+        {
+            EE_PROFILE_ZONE_SCOPED()
+
+            const auto image = DecodeImage(stream.Path.string());
+            if (!image.Data)
+            {
+                stream.State = STextureStream::EState::Failed;
+                return;
+            }
+
+            const auto format = image.HDR
+                ? EImageFormat::R32G32B32A32_SFLOAT
+                : stream.Options.Format == EImageFormat::R8G8B8A8_SRGB
+                    ? EImageFormat::R8G8B8A8_SRGB
+                    : EImageFormat::R8G8B8A8_UNORM;
+
+            if (stream.Options.GenerateMips)
+            {
+                stream.Mips = TextureMips::Generate(image.Data, image.Width, image.Height, format);
+            }
+            else
+            {
+                const auto size = (size_t)image.Width * image.Height * (image.HDR ? 16 : 4);
+                STextureMip mip = { (uint32_t)image.Width, (uint32_t)image.Height };
+                mip.Data.assign((const Byte*)image.Data, (const Byte*)image.Data + size);
+                stream.Mips.push_back(std::move(mip));
+            }
+
+            stbi_image_free(image.Data);
+
+            stream.Format = format;
+            stream.HDR = image.HDR;
+            TraceTextureInfo(stream.Path.string(), image.HDR, stream.Format, image.Channels);
+
+            if (!image.HDR && stream.BlockFormat != EImageFormat::Undefined)
+            {
+                for (auto& mip : stream.Mips)
+                    mip = TextureMips::CompressBC1(mip);
+
+                stream.Format = stream.BlockFormat;
+            }
+
+            stream.State = STextureStream::EState::Decoded;
+        }
+
+        /**
+         * Resume the coroutines awaiting the stream on the workers, once it is ready or failed.
+         */
+        void SettleStream(STextureStream& stream)
+        {
+            std::vector<std::coroutine_handle<>> waiters;
+            {
+                std::lock_guard lock(stream.WaitersMutex);
+                stream.Settled = true;
+                waiters.swap(stream.Waiters);
+            }
+
+            for (const auto handle : waiters)
+                Executor::Get().Enqueue(ETaskPriority::Background, [handle] { handle.resume(); });
+        }
+
+        /**
+         * Mip uploads of one texture, recorded in the update's staging buffer.
+         */
+        struct SMipUpload
+        {
+            STextureStream* Stream;
+            uint32_t ResidentMip;
+            std::vector<SBufferImageCopy> Regions;
+        };
+
+        /**
+         * Pick the next mips of a stream to upload and append them to the staging data. The
+         * first upload brings all the small mips, so the texture is usable right away.
+         * @param budget The bytes left to upload this frame, updated.
+         * @param force Upload a mip even if it exceeds the budget.
+         */
+        void RecordMipUploads(
+            STextureStream& stream,
+            std::vector<Byte>& staging,
+            std::vector<SMipUpload>& uploads,
+            size_t& budget,
+            const bool force
+        )
+        {
+            SMipUpload upload = { &stream, stream.ResidentMip, {} };
+            while (upload.ResidentMip > 0)
+            {
+                const auto level = upload.ResidentMip - 1;
+                const auto& mip = stream.Mips[level];
+
+                const bool initial = !stream.Ready &&
+                    std::max(mip.Width, mip.Height) <= TextureLoader::INITIAL_MIP_SIZE;
+                const bool forced = force && upload.Regions.empty();
+
+                if (!initial && !forced && mip.Data.size() > budget)
+                    break;
+
+                // Offsets are aligned to the largest texel/block size
+                const auto offset = (staging.size() + 15) & ~(size_t)15;
+                staging.resize(offset + mip.Data.size());
+                std::memcpy(staging.data() + offset, mip.Data.data(), mip.Data.size());
+
+                auto region = SBufferImageCopy::Default({ mip.Width, mip.Height, 1 });
+                region.BufferOffset = offset;
+                region.ImageSubresource.MipLevel = level;
+                upload.Regions.push_back(region);
+
+                budget -= std::min(budget, mip.Data.size());
+                upload.ResidentMip = level;
+            }
+
+            if (!upload.Regions.empty())
+            {
+                stream.Uploading = true;
+                uploads.push_back(std::move(upload));
+            }
+        }
+
+        /**
+         * Expose the mips of an upload the GPU has executed, and release their pixels.
+         */
+        void CompleteMipUpload(const SMipUpload& upload)
+        {
+            auto& stream = *upload.Stream;
+            stream.Texture->SetBaseMipLevel(upload.ResidentMip);
+
+            for (auto level = upload.ResidentMip; level < stream.ResidentMip; level++)
+                stream.Mips[level].Data = {};
+
+            stream.ResidentMip = upload.ResidentMip;
+            stream.Uploading = false;
+            if (!stream.Ready)
+            {
+                stream.Ready = true;
+                SettleStream(stream);
+            }
+
+            if (stream.ResidentMip == 0)
+            {
+                EE_CORE_TRACE("Loaded texture: {0} [{1}].", stream.Path.string(), stream.Texture->GetUUID())
+                stream.Mips.clear();
+                stream.State = STextureStream::EState::Streamed;
+            }
+        }
+    }
+
+    /**
+     * Mip uploads submitted by one update, exposed once the GPU signals their completion.
+     */
+    struct STextureUpload
+    {
+        Ref<CommandBuffer> Cmd;
+        Ref<StagingBuffer> Staging;
+        std::vector<SMipUpload> Mips;
+    };
+
+    /* TextureFuture */
+
+    bool TextureFuture::IsReady() const
+    {
+        return m_Stream && m_Stream->Ready;
+    }
+
+    bool TextureFuture::IsStreamed() const
+    {
+        return m_Stream && m_Stream->State == STextureStream::EState::Streamed;
+    }
+
+    bool TextureFuture::HasFailed() const
+    {
+        return m_Stream && m_Stream->State == STextureStream::EState::Failed;
+    }
+
+    Ref<Texture2D> TextureFuture::Get() const
+    {
+        return IsReady() ? m_Stream->Texture : nullptr;
+    }
+
+    bool TextureFuture::SAwaiter::await_ready() const
+    {
+        return !Stream || Stream->Ready || Stream->State == STextureStream::EState::Failed;
+    }
+
+    bool TextureFuture::SAwaiter::await_suspend(const std::coroutine_handle<> handle) const
+    {
+        std::lock_guard lock(Stream->WaitersMutex);
+        if (Stream->Settled)
+            return false;
+
+        Stream->Waiters.push_back(handle);
+        return true;
+    }
+
+    Ref<Texture2D> TextureFuture::SAwaiter::await_resume() const
+    {
+        return Stream && Stream->Ready ? Stream->Texture : nullptr;
+    }
+
+    /* TextureLoader */
+
     const GraphicsContext* TextureLoader::s_Context = nullptr;
     bool TextureLoader::s_Initialized = false;
+    Ref<TextureCache> TextureLoader::s_Cache = nullptr;
+    std::vector<Ref<STextureStream>> TextureLoader::s_Streams;
+    std::vector<STextureUpload> TextureLoader::s_Uploads;
+    WaitGroup TextureLoader::s_DecodeWaitGroup;
 
     void TextureLoader::Initialize(const GraphicsContext* context)
     {
         s_Context = context;
+        s_Cache = CreateRef<TextureCache>(TextureSet::Create(context));
         s_Initialized = true;
     }
 
+    void TextureLoader::Shutdown()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        // Don't leave decode tasks or uploads running past the graphics context
+        s_DecodeWaitGroup.Wait();
+
+        for (const auto& upload : s_Uploads)
+        {
+            upload.Cmd->Wait();
+            upload.Staging->Destroy();
+        }
+
+        s_Uploads.clear();
+
+        // Textures still streaming are never ready
+        for (const auto& stream : s_Streams)
+            SettleStream(*stream);
+
+        s_Streams.clear();
+        s_Cache.reset();
+        s_Initialized = false;
+    }
+
     Ref<Texture> TextureLoader::Load(
         const std::filesystem::path& path,
         const EImageFormat format
@@ -38,53 +361,183 @@ namespace Elixir
     {
         EE_CORE_ASSERT(s_Initialized, "TextureLoader is not initialized!")
 
-        void* data;
-        bool isHdr = false;
-        int width, height, channels;
+        return s_Cache->GetOrLoad(GetCacheKey(path, format), [&]() -> Ref<Texture>
+        {
+            const auto pathStr = path.string();
 
-        const auto pathStr = path.string();
+            EE_CORE_TRACE("Loading texture data: {0}.", pathStr)
 
-        EE_CORE_TRACE("Loading texture data: {0}.", pathStr)
+            const auto image = DecodeImage(pathStr);
 
-        if (stbi_is_hdr(pathStr.c_str()))
-        {
-            isHdr = true;
-            data = stbi_loadf(
-                pathStr.c_str(),
-                &width,
-                &height,
-                &channels,
-                STBI_rgb_alpha
+            EE_CORE_ASSERT(image.Data, "Could not read texture data!")
+
+            TraceTextureInfo(pathStr, image.HDR, format, image.Channels);
+
+            auto texture = Texture2D::Create(
+                s_Context,
+                format,
+                image.Width,
+                image.Height,
+                image.Data,
+                pathStr
             );
+            texture->m_HDR = image.HDR;
+            EE_CORE_TRACE("Loaded texture: {0} [{1}].", pathStr, texture->GetUUID())
+
+            stbi_image_free(image.Data);
+
+            return texture;
+        });
+    }
+
+    TextureFuture TextureLoader::LoadAsync(
+        const std::filesystem::path& path,
+        const STextureLoadOptions& options
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        EE_CORE_ASSERT(s_Initialized, "TextureLoader is not initialized!")
+
+        const auto stream = CreateRef<STextureStream>();
+        stream->Path = path;
+        stream->Key = GetCacheKey(path, options.Format, &options);
+        stream->Options = options;
+
+        if (const auto texture = s_Cache->Find(stream->Key))
+        {
+            stream->Texture = std::static_pointer_cast<Texture2D>(texture);
+            stream->Ready = true;
+            stream->Settled = true;
+            stream->State = STextureStream::EState::Streamed;
+            return TextureFuture(stream);
         }
-        else
-        {
-            data = stbi_load(
-                pathStr.c_str(),
-                &width,
-                &height,
-                &channels,
-                STBI_rgb_alpha
-            );
+
+        // Images are decoded to RGBA8, or to R32G32B32A32_SFLOAT for HDR ones
+        if (options.Format != EImageFormat::R8G8B8A8_SRGB && options.Format != EImageFormat::R8G8B8A8_UNORM)
+        {
+            EE_CORE_ERROR("Unsupported texture format! [Path={0}, Format={1}]", path.string(), options.Format)
+            stream->State = STextureStream::EState::Failed;
+            stream->Settled = true;
+            return TextureFuture(stream);
+        }
+
+        const auto pending = std::ranges::find(s_Streams, stream->Key, [](const auto& other) { return other->Key; });
+        if (pending != s_Streams.end())
+            return TextureFuture(*pending);
+
+        EE_CORE_TRACE("Loading texture in background: {0}.", path.string())
+
+        if (options.Compress)
+        {
+            const auto blockFormat = TextureMips::GetBC1Format(options.Format);
+            if (blockFormat != EImageFormat::Undefined &&
+                s_Context->IsFormatSupported(blockFormat, EImageUsage::Sampled | EImageUsage::TransferDst))
+            {
+                stream->BlockFormat = blockFormat;
+            }
+            else
+            {
+                EE_CORE_WARN("Cannot compress texture, loading it uncompressed: {0}.", path.string())
+            }
+        }
+
+        // Streaming must never delay the work of the frame
+        Executor::Get().Enqueue(ETaskPriority::Background, [stream]()
+        {
+            DecodeStream(*stream);
+        }, &s_DecodeWaitGroup);
+
+        s_Streams.push_back(stream);
+        return TextureFuture(stream);
+    }
+
+    void TextureLoader::Update()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        s_Cache->Update();
+        CompleteUploads();
+
+        std::vector<Byte> staging;
+        std::vector<SMipUpload> uploads;
+        size_t budget = UPLOAD_BUDGET;
+
+        for (auto it = s_Streams.begin(); it != s_Streams.end();)
+        {
+            auto& stream = **it;
+            const auto state = stream.State.load();
+
+            if (state == STextureStream::EState::Failed)
+            {
+                EE_CORE_ERROR("Could not read texture data: {0}.", stream.Path.string())
+                SettleStream(stream);
+                it = s_Streams.erase(it);
+                continue;
+            }
+
+            if (state == STextureStream::EState::Decoded)
+            {
+                const auto pathStr = stream.Path.string();
+
+                auto info = Texture2D::CreateImageInfo(stream.Format, stream.Mips[0].Width, stream.Mips[0].Height);
+                info.MipLevels = (uint32_t)stream.Mips.size();
+
+                const auto texture = s_Cache->GetOrLoad(stream.Key, [&]() -> Ref<Texture>
+                {
+                    return Texture2D::Create(s_Context, info, pathStr);
+                });
+
+                stream.Texture = std::static_pointer_cast<Texture2D>(texture);
+                stream.Texture->m_HDR = stream.HDR;
+                stream.ResidentMip = info.MipLevels;
+                stream.State = STextureStream::EState::Streaming;
+            }
+
+            if (stream.State == STextureStream::EState::Streaming && !stream.Uploading)
+                RecordMipUploads(stream, staging, uploads, budget, uploads.empty());
+
+            ++it;
+        }
+
+        if (uploads.empty()) return;
+
+        const auto stagingBuffer = StagingBuffer::Create(s_Context, staging.size(), staging.data());
+
+        const auto cmd = s_Context->GetUploadCommandBuffer();
+        cmd->Begin();
+
+        for (auto& upload : uploads)
+        {
+            const auto& texture = upload.Stream->Texture;
+            texture->Transition(cmd, EImageLayout::TransferDst);
+            texture->CopyFrom(cmd, stagingBuffer, upload.Regions);
+            texture->Transition(cmd, EImageLayout::ShaderReadOnly);
         }
 
-        EE_CORE_ASSERT(data, "Could not read texture data!")
+        // Completed by a later update, so the frame never waits on the copies
+        cmd->SubmitAsync();
+        s_Uploads.push_back({ cmd, stagingBuffer, std::move(uploads) });
+    }
 
-        TraceTextureInfo(pathStr, isHdr, format, channels);
+    void TextureLoader::CompleteUploads()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        std::erase_if(s_Uploads, [](const STextureUpload& upload)
+        {
+            if (!upload.Cmd->IsComplete())
+                return false;
 
-        auto texture = Texture2D::Create(
-            s_Context,
-            format,
-            width,
-            height,
-            data,
-            pathStr
-        );
-        texture->m_HDR = isHdr;
-        EE_CORE_TRACE("Loaded texture: {0} [{1}].", pathStr, texture->GetUUID())
+            upload.Staging->Destroy();
+            for (const auto& mips : upload.Mips)
+                CompleteMipUpload(mips);
 
-        stbi_image_free(data);
+            return true;
+        });
 
-        return std::move(texture);
+        std::erase_if(s_Streams, [](const Ref<STextureStream>& stream)
+        {
+            return stream->State == STextureStream::EState::Streamed;
+        });
     }
-}
\ No newline at end of file
+}
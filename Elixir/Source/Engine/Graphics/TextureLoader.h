@@ -1,21 +1,149 @@
 #pragma once
 
+#include <Engine/Core/Executor/WaitGroup.h>
 #include <Engine/Graphics/Texture.h>
+#include <Engine/Graphics/TextureCache.h>
+
+#include <coroutine>
 
 namespace Elixir
 {
+    struct STextureLoadOptions
+    {
+        /**
+         * Format of LDR textures: R8G8B8A8_SRGB or R8G8B8A8_UNORM. HDR textures are always
+         * R32G32B32A32_SFLOAT.
+         */
+        EImageFormat Format = EImageFormat::R8G8B8A8_SRGB;
+
+        // Generate the full mip chain, streamed in from the smallest mip
+        bool GenerateMips = true;
+
+        // Compress LDR textures to BC1 when the GPU samples it. Alpha is reduced to 1 bit
+        bool Compress = false;
+    };
+
+    struct STextureStream;
+    struct STextureUpload;
+
+    /**
+     * Handle to a texture loaded in the background by @ref TextureLoader::LoadAsync. The
+     * texture is available once its smallest mips are uploaded, the larger ones are then
+     * streamed in over the next frames. Must only be used from the main thread, except to
+     * be awaited.
+     */
+    class ELIXIR_API TextureFuture
+    {
+        friend class TextureLoader;
+      public:
+        TextureFuture() = default;
+
+        bool IsValid() const { return m_Stream != nullptr; }
+
+        /**
+         * Check whether the texture can be used, possibly at a lower resolution.
+         */
+        bool IsReady() const;
+
+        /**
+         * Check whether all the mips of the texture are uploaded.
+         */
+        bool IsStreamed() const;
+
+        /**
+         * Check whether the texture cannot be loaded.
+         */
+        bool HasFailed() const;
+
+        /**
+         * Get the texture without blocking.
+         * @return The texture, or nullptr while loading or if the load failed.
+         */
+        Ref<Texture2D> Get() const;
+
+        /**
+         * Awaitable suspending a coroutine until the texture is ready or the load failed,
+         * without blocking a thread. The coroutine continues on a worker thread with the
+         * texture, or nullptr if the load failed.
+         */
+        struct ELIXIR_API SAwaiter
+        {
+            bool await_ready() const;
+            bool await_suspend(std::coroutine_handle<> handle) const;
+            Ref<Texture2D> await_resume() const;
+
+            Ref<STextureStream> Stream;
+        };
+
+        SAwaiter operator co_await() const { return { m_Stream }; }
+
+      private:
+        explicit TextureFuture(Ref<STextureStream> stream) : m_Stream(std::move(stream)) {}
+
+        Ref<STextureStream> m_Stream;
+    };
+
     class ELIXIR_API TextureLoader
     {
       public:
+        // Mips up to this size are uploaded at once, so the texture shows up right away
+        static constexpr uint32_t INITIAL_MIP_SIZE = 64;
+
+        // Bytes of mips uploaded per frame, at least one mip is uploaded per frame
+        static constexpr size_t UPLOAD_BUDGET = 4 * 1024 * 1024;
+
         static void Initialize(const GraphicsContext* context);
+        static void Shutdown();
 
+        /**
+         * Load a texture, or get it from the cache if the same file was already loaded with
+         * the same format.
+         * @param path The image file path.
+         * @param format The texture format.
+         * @return The texture.
+         */
         static Ref<Texture> Load(
             const std::filesystem::path& path,
             EImageFormat format = EImageFormat::R8G8B8A8_SRGB
         );
 
+        /**
+         * Load a texture on a worker thread: the image is decoded, its mips generated and
+         * optionally compressed in the background. The mips are uploaded by @ref Update.
+         * Loading the same file with the same options shares the texture.
+         * @param path The image file path.
+         * @param options How the texture is created.
+         * @return A handle to the texture being loaded.
+         */
+        static TextureFuture LoadAsync(
+            const std::filesystem::path& path,
+            const STextureLoadOptions& options = {}
+        );
+
+        /**
+         * Create the textures decoded since the last update and upload their next mips,
+         * smallest first, within @ref UPLOAD_BUDGET. The uploads are not waited for, their
+         * mips are exposed by the first update after the GPU executed them. Must be called
+         * once per frame from the main thread.
+         */
+        static void Update();
+
+        /**
+         * Get the cache holding the loaded textures, e.g. to set its budget or query stats.
+         */
+        static const Ref<TextureCache>& GetCache() { return s_Cache; }
+
     private:
+        /**
+         * Expose the mips of the uploads the GPU has executed and free their staging buffers.
+         */
+        static void CompleteUploads();
+
         static const GraphicsContext* s_Context;
         static bool s_Initialized;
+        static Ref<TextureCache> s_Cache;
+        static std::vector<Ref<STextureStream>> s_Streams;
+        static std::vector<STextureUpload> s_Uploads;
+        static WaitGroup s_DecodeWaitGroup;
     };
 }
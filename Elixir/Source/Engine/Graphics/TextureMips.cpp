@@ -0,0 +1,309 @@
+#include "epch.h"
+#include "TextureMips.h"
+
+#include <Engine/Core/Executor/Parallel.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_precision.hpp>
+
+#include <bit>
+
+namespace Elixir
+{
+    namespace
+    {
+        constexpr uint32_t CHANNELS = 4;
+
+        // Rows of 4x4 blocks compressed per task, a 1024 px wide mip has 256 blocks per row
+        constexpr size_t BLOCK_ROWS_PER_TASK = 16;
+
+        float SRGBToLinear(const float value)
+        {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSRGB(const float value)
+        {
+            return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        }
+
+        const std::array<float, 256>& GetSRGBToLinearTable()
+        {
+            static const auto s_Table = []
+            {
+                std::array<float, 256> table = {};
+                for (uint32_t i = 0; i < table.size(); i++)
+                    table[i] = SRGBToLinear((float)i / 255.0f);
+                return table;
+            }();
+
+            return s_Table;
+        }
+
+        uint8_t ToUnorm8(const float value)
+        {
+            return (uint8_t)std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+        }
+
+        /**
+         * Downsample a mip with a box filter. Each destination texel averages the source
+         * texels it covers, so odd sizes fold their last row/column into the last texel.
+         * @param read Returns channel c of a source texel, as a float.
+         * @param write Stores the averaged channel c of a destination texel.
+         */
+        template <typename FRead, typename FWrite>
+        void Downsample(
+            const uint32_t width,
+            const uint32_t height,
+            const uint32_t mipWidth,
+            const uint32_t mipHeight,
+            FRead&& read,
+            FWrite&& write
+        )
+        {
+            for (uint32_t y = 0; y < mipHeight; y++)
+            {
+                const uint32_t y0 = y * height / mipHeight;
+                const uint32_t y1 = (y + 1) * height / mipHeight;
+
+                for (uint32_t x = 0; x < mipWidth; x++)
+                {
+                    const uint32_t x0 = x * width / mipWidth;
+                    const uint32_t x1 = (x + 1) * width / mipWidth;
+
+                    std::array<float, CHANNELS> sum = {};
+                    for (uint32_t sy = y0; sy < y1; sy++)
+                    {
+                        for (uint32_t sx = x0; sx < x1; sx++)
+                        {
+                            const size_t texel = (size_t)sy * width + sx;
+                            for (uint32_t c = 0; c < CHANNELS; c++)
+                                sum[c] += read(texel, c);
+                        }
+                    }
+
+                    const float count = (float)((x1 - x0) * (y1 - y0));
+                    const size_t texel = (size_t)y * mipWidth + x;
+                    for (uint32_t c = 0; c < CHANNELS; c++)
+                        write(texel, c, sum[c] / count);
+                }
+            }
+        }
+
+        /* BC1 */
+
+        struct SColor565
+        {
+            uint16_t Packed;
+            glm::vec3 Color;
+        };
+
+        SColor565 Quantize565(const glm::vec3& color)
+        {
+            const auto r = (uint16_t)std::lround(std::clamp(color.r, 0.0f, 255.0f) * 31.0f / 255.0f);
+            const auto g = (uint16_t)std::lround(std::clamp(color.g, 0.0f, 255.0f) * 63.0f / 255.0f);
+            const auto b = (uint16_t)std::lround(std::clamp(color.b, 0.0f, 255.0f) * 31.0f / 255.0f);
+
+            // Expand back the way the hardware does, so indices are picked against the
+            // colors that are actually decoded
+            return {
+                (uint16_t)(r << 11 | g << 5 | b),
+                { (float)(r << 3 | r >> 2), (float)(g << 2 | g >> 4), (float)(b << 3 | b >> 2) }
+            };
+        }
+
+        void CompressBlock(const std::array<glm::u8vec4, 16>& texels, Byte* block)
+        {
+            glm::vec3 min(255.0f);
+            glm::vec3 max(0.0f);
+            bool transparent = false;
+            bool opaque = false;
+
+            for (const auto& texel : texels)
+            {
+                if (texel.a < 128)
+                {
+                    transparent = true;
+                    continue;
+                }
+
+                opaque = true;
+                min = glm::min(min, glm::vec3(texel));
+                max = glm::max(max, glm::vec3(texel));
+            }
+
+            if (!opaque)
+                min = max = glm::vec3(0.0f);
+
+            // Pull the endpoints slightly inward, the interpolated colors then cover the
+            // range better than the extremes
+            const auto inset = (max - min) / 16.0f;
+            auto c0 = Quantize565(max - inset);
+            auto c1 = Quantize565(min + inset);
+
+            // The endpoint order selects the mode: c0 > c1 is 4 colors, c0 <= c1 is 3
+            // colors + transparent
+            if (transparent ? c0.Packed > c1.Packed : c0.Packed < c1.Packed)
+                std::swap(c0, c1);
+
+            std::array<glm::vec3, 4> palette;
+            palette[0] = c0.Color;
+            palette[1] = c1.Color;
+            uint32_t colors = 4;
+
+            if (c0.Packed > c1.Packed)
+            {
+                palette[2] = (2.0f * c0.Color + c1.Color) / 3.0f;
+                palette[3] = (c0.Color + 2.0f * c1.Color) / 3.0f;
+            }
+            else
+            {
+                palette[2] = (c0.Color + c1.Color) / 2.0f;
+                colors = 3;
+            }
+
+            uint32_t indices = 0;
+            for (uint32_t i = 0; i < texels.size(); i++)
+            {
+                uint32_t index = 3;
+                if (!transparent || texels[i].a >= 128)
+                {
+                    float best = std::numeric_limits<float>::max();
+                    for (uint32_t p = 0; p < colors; p++)
+                    {
+                        const auto delta = glm::vec3(texels[i]) - palette[p];
+                        const float distance = glm::dot(delta, delta);
+                        if (distance < best)
+                        {
+                            best = distance;
+                            index = p;
+                        }
+                    }
+                }
+
+                indices |= index << (i * 2);
+            }
+
+            std::memcpy(block, &c0.Packed, sizeof(uint16_t));
+            std::memcpy(block + 2, &c1.Packed, sizeof(uint16_t));
+            std::memcpy(block + 4, &indices, sizeof(uint32_t));
+        }
+    }
+
+    uint32_t TextureMips::GetMipCount(const uint32_t width, const uint32_t height)
+    {
+        return (uint32_t)std::bit_width(std::max({ width, height, 1u }));
+    }
+
+    std::vector<STextureMip> TextureMips::Generate(
+        const void* pixels,
+        const uint32_t width,
+        const uint32_t height,
+        const EImageFormat format
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        const bool isFloat = format == EImageFormat::R32G32B32A32_SFLOAT;
+        const bool isSRGB = format == EImageFormat::R8G8B8A8_SRGB;
+        EE_CORE_ASSERT(
+            isFloat || isSRGB || format == EImageFormat::R8G8B8A8_UNORM,
+            "Unsupported mip generation format: {0}!", format
+        )
+
+        const size_t texelSize = isFloat ? CHANNELS * sizeof(float) : CHANNELS;
+        const auto& toLinear = GetSRGBToLinearTable();
+
+        std::vector<STextureMip> mips(GetMipCount(width, height));
+        mips[0].Width = width;
+        mips[0].Height = height;
+        mips[0].Data.resize((size_t)width * height * texelSize);
+        std::memcpy(mips[0].Data.data(), pixels, mips[0].Data.size());
+
+        for (size_t level = 1; level < mips.size(); level++)
+        {
+            const auto& src = mips[level - 1];
+            auto& dst = mips[level];
+            dst.Width = std::max(src.Width / 2, 1u);
+            dst.Height = std::max(src.Height / 2, 1u);
+            dst.Data.resize((size_t)dst.Width * dst.Height * texelSize);
+
+            if (isFloat)
+            {
+                const auto srcData = (const float*)src.Data.data();
+                const auto dstData = (float*)dst.Data.data();
+
+                Downsample(
+                    src.Width, src.Height, dst.Width, dst.Height,
+                    [&](const size_t texel, const uint32_t c) { return srcData[texel * CHANNELS + c]; },
+                    [&](const size_t texel, const uint32_t c, const float value) { dstData[texel * CHANNELS + c] = value; }
+                );
+                continue;
+            }
+
+            const auto srcData = src.Data.data();
+            const auto dstData = dst.Data.data();
+
+            Downsample(
+                src.Width, src.Height, dst.Width, dst.Height,
+                [&](const size_t texel, const uint32_t c)
+                {
+                    const auto value = (uint8_t)srcData[texel * CHANNELS + c];
+                    return isSRGB && c < 3 ? toLinear[value] : (float)value / 255.0f;
+                },
+                [&](const size_t texel, const uint32_t c, const float value)
+                {
+                    dstData[texel * CHANNELS + c] = (Byte)ToUnorm8(isSRGB && c < 3 ? LinearToSRGB(value) : value);
+                }
+            );
+        }
+
+        return mips;
+    }
+
+    STextureMip TextureMips::CompressBC1(const STextureMip& mip)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        constexpr uint32_t BLOCK_SIZE = 8;
+
+        const uint32_t blocksX = (mip.Width + 3) / 4;
+        const uint32_t blocksY = (mip.Height + 3) / 4;
+
+        STextureMip compressed;
+        compressed.Width = mip.Width;
+        compressed.Height = mip.Height;
+        compressed.Data.resize((size_t)blocksX * blocksY * BLOCK_SIZE);
+
+        const auto texels = (const glm::u8vec4*)mip.Data.data();
+
+        // Rows of blocks are independent, large mips are compressed on the worker pool
+        ParallelFor(0, blocksY, BLOCK_ROWS_PER_TASK, [&](const size_t by)
+        {
+            std::array<glm::u8vec4, 16> block;
+            for (uint32_t bx = 0; bx < blocksX; bx++)
+            {
+                for (uint32_t i = 0; i < block.size(); i++)
+                {
+                    const uint32_t x = std::min(bx * 4 + i % 4, mip.Width - 1);
+                    const uint32_t y = std::min((uint32_t)by * 4 + i / 4, mip.Height - 1);
+                    block[i] = texels[(size_t)y * mip.Width + x];
+                }
+
+                const size_t offset = (by * blocksX + bx) * BLOCK_SIZE;
+                CompressBlock(block, compressed.Data.data() + offset);
+            }
+        });
+
+        return compressed;
+    }
+
+    EImageFormat TextureMips::GetBC1Format(const EImageFormat format)
+    {
+        switch (format)
+        {
+            case EImageFormat::R8G8B8A8_UNORM: return EImageFormat::BC1_RGBA_UNORM_BLOCK;
+            case EImageFormat::R8G8B8A8_SRGB: return EImageFormat::BC1_RGBA_SRGB_BLOCK;
+            default: return EImageFormat::Undefined;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Engine/Graphics/Image.h>
+
+namespace Elixir
+{
+    /**
+     * Pixels of one mip level, tightly packed: texels for uncompressed formats, 4x4 blocks
+     * for block compressed ones.
+     */
+    struct STextureMip
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<Byte> Data;
+    };
+
+    /**
+     * CPU side mip chain generation and block compression, run on worker threads by the
+     * texture loader before the mips are uploaded.
+     */
+    class ELIXIR_API TextureMips
+    {
+      public:
+        /**
+         * Get the number of mips of a full chain, down to 1x1.
+         */
+        static uint32_t GetMipCount(uint32_t width, uint32_t height);
+
+        /**
+         * Generate a full mip chain with a 2x2 box filter. Odd sizes are rounded down, the
+         * last row or column is folded into the previous texels. sRGB pixels are averaged in
+         * linear space, alpha is averaged as is.
+         * @param pixels The pixels of the first mip.
+         * @param width The width of the first mip.
+         * @param height The height of the first mip.
+         * @param format The pixel format: R8G8B8A8_UNORM, R8G8B8A8_SRGB or R32G32B32A32_SFLOAT.
+         * @return The mips, from the largest (a copy of pixels) to 1x1.
+         */
+        static std::vector<STextureMip> Generate(
+            const void* pixels,
+            uint32_t width,
+            uint32_t height,
+            EImageFormat format
+        );
+
+        /**
+         * Compress an R8G8B8A8 mip to BC1. Blocks with a texel whose alpha is below 128 use
+         * the 3 colors + transparent mode. Partial blocks at the edges repeat their last
+         * texels.
+         * @param mip The mip to compress.
+         * @return The compressed mip, 8 bytes per 4x4 block.
+         */
+        static STextureMip CompressBC1(const STextureMip& mip);
+
+        /**
+         * Get the BC1 format matching an uncompressed R8G8B8A8 format.
+         * @return The BC1 format, or EImageFormat::Undefined if the format cannot be
+         * compressed to BC1.
+         */
+        static EImageFormat GetBC1Format(EImageFormat format);
+    };
+}
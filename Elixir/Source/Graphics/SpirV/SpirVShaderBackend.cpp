@@ -2,6 +2,7 @@
 #include "SpirVShaderBackend.h"
 
 #include <Engine/Graphics/Shader/Shader.h>
+#include <Engine/Graphics/Shader/ShaderReflectionCache.h>
 
 #include <fstream>
 #include <spirv_cross.hpp>
@@ -43,9 +44,24 @@ namespace Elixir::SpirV
     ) const
     {
         const auto spirv = LoadSpirVFile(filepath);
+
+        // Use the layout reflected at build time, if it matches the bytecode
+        const auto reflection = ShaderReflectionCache::GetPath(filepath);
+        if (auto module = ShaderReflectionCache::Read(reflection, std::as_bytes(std::span{spirv})))
+        {
+            module->Path = filepath;
+            module->Bytecode = ConvertBytecode(spirv);
+            return std::move(module.value());
+        }
+
         return Load(spirv, filepath);
     }
 
+    SShaderModuleCreateInfo SpirVShaderBackend::ReflectModule(const std::filesystem::path& filepath)
+    {
+        return Load(LoadSpirVFile(filepath), filepath);
+    }
+
     SShaderModuleCreateInfo SpirVShaderBackend::Load(
         const std::vector<uint32_t>& spirv,
         const std::filesystem::path& filepath
@@ -28,6 +28,12 @@ namespace Elixir::SpirV
             EShaderStage stage
         ) const override;
 
+        /**
+         * Load a module and reflect its bytecode, ignoring any build-time reflection file.
+         * @param filepath The SPIR-V file path.
+         */
+        static SShaderModuleCreateInfo ReflectModule(const std::filesystem::path& filepath);
+
       private:
         static SShaderModuleCreateInfo Load(
             const std::vector<uint32_t>& spirv,
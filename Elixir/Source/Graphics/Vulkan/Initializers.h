@@ -100,6 +100,7 @@ namespace Elixir::Vulkan::Initializers
         info.image = vk_Image;
         info.format = Converters::GetFormat(image->GetFormat());
         info.subresourceRange = ImageSubresourceRange(image->GetAspect());
+        info.subresourceRange.baseMipLevel = image->GetBaseMipLevel();
 
         return info;
     }
@@ -31,6 +31,9 @@ namespace Elixir::Vulkan
             delete m_InheritanceInfo;
             m_InheritanceInfo = nullptr;
         }
+
+        if (m_SubmitFence != VK_NULL_HANDLE)
+            vkDestroyFence(m_GraphicsContext->GetDevice(), m_SubmitFence, nullptr);
     }
 
     void VulkanCommandBuffer::Begin(const SRenderingInfo& info)
@@ -111,7 +114,17 @@ namespace Elixir::Vulkan
         m_RenderingInfo = info;
         Begin(info);
 
-        const auto colorInfo = Initializers::AttachmentInfo(info.ColorAttachment);
+        VkClearValue clearValue = {};
+        if (info.ClearColor)
+        {
+            const auto& color = *info.ClearColor;
+            clearValue.color = {{ color.r, color.g, color.b, color.a }};
+        }
+
+        const auto colorInfo = Initializers::AttachmentInfo(
+            info.ColorAttachment,
+            info.ClearColor ? &clearValue : nullptr
+        );
 
         VkRenderingAttachmentInfo depthStencilInfo{};
         if (info.DepthStencilAttachment)
@@ -405,7 +418,9 @@ namespace Elixir::Vulkan
     {
         if (cmds.empty()) return;
 
-        std::vector<VkCommandBuffer> vkCmds;
+        // Secondaries are executed by the frame's primary, so their handles are frame data
+        const FrameAllocator<VkCommandBuffer> allocator(*m_GraphicsContext->GetFrameArena());
+        FrameVector<VkCommandBuffer> vkCmds(allocator);
         vkCmds.reserve(cmds.size());
 
         for (auto const& cmd : cmds)
@@ -425,6 +440,14 @@ namespace Elixir::Vulkan
     {
         EE_PROFILE_ZONE_SCOPED()
 
+        SubmitAsync();
+        Wait();
+    }
+
+    void VulkanCommandBuffer::SubmitAsync()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
         const auto device = m_GraphicsContext->GetDevice();
         const auto graphicsQueue = m_GraphicsContext->GetGraphicsQueue();
 
@@ -437,16 +460,32 @@ namespace Elixir::Vulkan
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = &m_CommandBuffer;
 
-        VkFenceCreateInfo fenceInfo = {};
-        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (m_SubmitFence == VK_NULL_HANDLE)
+        {
+            VkFenceCreateInfo fenceInfo = {};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            VK_CHECK_RESULT(vkCreateFence(device, &fenceInfo, nullptr, &m_SubmitFence));
+        }
+        else
+        {
+            VK_CHECK_RESULT(vkResetFences(device, 1, &m_SubmitFence));
+        }
+
+        VK_CHECK_RESULT(vkQueueSubmit(graphicsQueue, 1, &submitInfo, m_SubmitFence));
+    }
 
-        VkFence fence;
-        VK_CHECK_RESULT(vkCreateFence(device, &fenceInfo, nullptr, &fence));
+    bool VulkanCommandBuffer::IsComplete() const
+    {
+        if (m_SubmitFence == VK_NULL_HANDLE) return true;
+        return vkGetFenceStatus(m_GraphicsContext->GetDevice(), m_SubmitFence) == VK_SUCCESS;
+    }
 
-        VK_CHECK_RESULT(vkQueueSubmit(graphicsQueue, 1, &submitInfo, fence));
+    void VulkanCommandBuffer::Wait() const
+    {
+        EE_PROFILE_ZONE_SCOPED()
 
-        VK_CHECK_RESULT(vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX));
-        vkDestroyFence(device, fence, nullptr);
+        if (m_SubmitFence == VK_NULL_HANDLE) return;
+        VK_CHECK_RESULT(vkWaitForFences(m_GraphicsContext->GetDevice(), 1, &m_SubmitFence, VK_TRUE, UINT64_MAX));
     }
 
     void VulkanCommandBuffer::AllocateCommandBuffer()
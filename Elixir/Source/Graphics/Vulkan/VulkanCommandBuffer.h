@@ -104,6 +104,9 @@ namespace Elixir::Vulkan
         void ExecuteCommands(std::span<Ref<CommandBuffer>> cmds) override;
 
         void Flush() override;
+        void SubmitAsync() override;
+        bool IsComplete() const override;
+        void Wait() const override;
 
         /** Getters and Setters **/
 
@@ -121,6 +124,9 @@ namespace Elixir::Vulkan
         VkCommandPool m_CommandPool;
         VkCommandBuffer m_CommandBuffer;
 
+        // Signaled when the last submission has executed, created on the first one
+        VkFence m_SubmitFence = VK_NULL_HANDLE;
+
         VkCommandBufferInheritanceInfo* m_InheritanceInfo;
 
         const VulkanGraphicsContext* m_GraphicsContext;
@@ -175,7 +175,9 @@ namespace Elixir::Vulkan
     {
         std::lock_guard lock(m_CommandsMutex);
 
-        std::vector<Ref<CommandBuffer>> cmds;
+        // Rebuilt every frame, so bump allocated from the frame arena
+        const FrameAllocator<Ref<CommandBuffer>> allocator(*m_GraphicsContext->GetFrameArena());
+        FrameVector<Ref<CommandBuffer>> cmds(allocator);
         cmds.reserve(m_CommandsQueue.size());
 
         while (!m_CommandsQueue.empty())
@@ -86,6 +86,8 @@ namespace Elixir::Vulkan
         allocInfo.descriptorSetCount = 1;
         allocInfo.pSetLayouts = &layout;
 
+        std::lock_guard lock(m_Mutex);
+
         VkDescriptorSet set;
         VK_CHECK_RESULT(
             vkAllocateDescriptorSets(
@@ -100,6 +102,7 @@ namespace Elixir::Vulkan
 
     void VulkanDescriptorPool::FreeDescriptorSet(const VkDescriptorSet set) const
     {
+        std::lock_guard lock(m_Mutex);
         VK_CHECK_RESULT(
             vkFreeDescriptorSets(
                 m_GraphicsContext->GetDevice(),
@@ -114,6 +117,7 @@ namespace Elixir::Vulkan
         const std::vector<VkDescriptorSet>& sets
     ) const
     {
+        std::lock_guard lock(m_Mutex);
         VK_CHECK_RESULT(
             vkFreeDescriptorSets(
                 m_GraphicsContext->GetDevice(),
@@ -127,6 +131,7 @@ namespace Elixir::Vulkan
     void VulkanDescriptorPool::Reset() const
     {
         EE_PROFILE_ZONE_SCOPED()
+        std::lock_guard lock(m_Mutex);
         vkResetDescriptorPool(m_GraphicsContext->GetDevice(), m_Pool, 0);
     }
 
@@ -270,6 +275,17 @@ namespace Elixir::Vulkan
         m_DirtyTextures.push_back(texture);
     }
 
+    void VulkanBindlessDescriptorPool::RefreshTexture(Texture* texture)
+    {
+        std::lock_guard lock(m_TextureMutex);
+
+        const auto it = m_TextureLookup.find(texture);
+        if (it == m_TextureLookup.end()) return;
+
+        // Add to dirty texture list, to be updated
+        m_DirtyTextures.push_back(m_Textures[it->second.Index].Texture);
+    }
+
     void VulkanBindlessDescriptorPool::UnregisterTexture(SResourceHandle handle)
     {
         std::lock_guard lock(m_TextureMutex);
@@ -41,6 +41,10 @@ namespace Elixir::Vulkan
         const VulkanGraphicsContext* m_GraphicsContext;
     };
 
+    /**
+     * General purpose descriptor pool. Allocations and frees are synchronized, so shaders
+     * can be created from worker threads (see @ref PipelineBatch).
+     */
     class VulkanDescriptorPool final : public VulkanBaseDescriptorPool
     {
       public:
@@ -54,6 +58,9 @@ namespace Elixir::Vulkan
         void FreeDescriptorSet(VkDescriptorSet set) const;
         void FreeDescriptorSets(const std::vector<VkDescriptorSet>& sets) const;
         void Reset() const;
+
+      private:
+        mutable std::mutex m_Mutex;
     };
 
     class VulkanBindlessDescriptorPool final : public VulkanBaseDescriptorPool
@@ -96,6 +103,12 @@ namespace Elixir::Vulkan
          */
         void UpdateTexture(SResourceHandle handle, const Ref<Texture>& texture);
 
+        /**
+         * Rewrite the descriptor of a texture whose view changed, if it is registered.
+         * @param texture The texture to be refreshed.
+         */
+        void RefreshTexture(Texture* texture);
+
         /**
          * Unregister a texture by its handle.
          * This decrements the reference count and frees the slot if count reaches 0.
@@ -1,6 +1,7 @@
 #include "epch.h"
 #include "VulkanGraphicsContext.h"
 
+#include <Engine/Core/MemoryTracker.h>
 #include <Graphics/SpirV/SpirVShaderBackend.h>
 #include <Graphics/Vulkan/VulkanCommandBuffer.h>
 #include <Graphics/Vulkan/VulkanCommandPool.h>
@@ -76,6 +77,7 @@ namespace Elixir
         EE_PROFILE_ZONE_SCOPED()
 
         InitVulkan();
+        InitPipelineCache();
         InitAllocator();
         InitSwapchain();
         InitCommandPoolManager();
@@ -100,6 +102,7 @@ namespace Elixir
         if (m_IsInitialized)
         {
             DrainRenderQueue();
+            FlushDeferredDestructions(true);
 
             m_CommandPoolManager.reset();
 
@@ -114,6 +117,10 @@ namespace Elixir
             m_DescriptorPool.reset();
             m_BindlessDescriptorPool.reset();
 
+            m_PipelineLibrary->Clear();
+            m_PipelineCache->Save();
+            m_PipelineCache.reset();
+
             for (int i = 0; i < m_FramesInFlight; i++)
             {
                 vkDestroyFence(m_Device, m_Frames[i].RenderFence, nullptr);
@@ -150,6 +157,9 @@ namespace Elixir
 
         m_Executor->Enqueue(EThreadName::Rendering, [this, callback]()
         {
+            // Subsystems rendering in the callback tag their own allocations
+            MemoryTagScope tag(EMemoryTag::Graphics);
+
             if (!Prepare())
             {
                 m_FrameSemaphore.release();
@@ -231,6 +241,54 @@ namespace Elixir
         m_CommandPoolManager->EnqueueSecondaryCommandBuffer(cmd);
     }
 
+    bool VulkanGraphicsContext::IsFormatSupported(const EImageFormat format, const EImageUsage usage) const
+    {
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(m_GPU, GetFormat(format), &properties);
+
+        VkFormatFeatureFlags required = 0;
+        if (usage & EImageUsage::TransferSrc) required |= VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+        if (usage & EImageUsage::TransferDst) required |= VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+        if (usage & EImageUsage::Sampled) required |= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+        if (usage & EImageUsage::Storage) required |= VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT;
+        if (usage & EImageUsage::ColorAttachment) required |= VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
+        if (usage & EImageUsage::DepthStencilAttachment) required |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+
+        return (properties.optimalTilingFeatures & required) == required;
+    }
+
+    void VulkanGraphicsContext::DeferDestruction(std::function<void()>&& deleter) const
+    {
+        std::lock_guard lock(m_DeferredDestructionsMutex);
+        m_DeferredDestructions.push_back({ m_FrameNumber, std::move(deleter) });
+    }
+
+    void VulkanGraphicsContext::FlushDeferredDestructions(const bool all)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        std::vector<SDeferredDestruction> expired;
+        {
+            std::lock_guard lock(m_DeferredDestructionsMutex);
+
+            // Frames up to the one being recorded when the resource was released may still
+            // use it, and only the frame FramesInFlight ago is known to be finished
+            const auto [first, last] = std::ranges::partition(
+                m_DeferredDestructions,
+                [&](const SDeferredDestruction& entry)
+                {
+                    return !all && entry.FrameNumber + m_FramesInFlight + 1 > m_FrameNumber;
+                }
+            );
+
+            std::move(first, last, std::back_inserter(expired));
+            m_DeferredDestructions.erase(first, last);
+        }
+
+        for (const auto& entry : expired)
+            entry.Deleter();
+    }
+
     void VulkanGraphicsContext::InitVulkan()
     {
         EE_PROFILE_ZONE_SCOPED()
@@ -313,6 +371,12 @@ namespace Elixir
 		m_GraphicsQueueFamily = graphicsQueueFamily.value();
     }
 
+    void VulkanGraphicsContext::InitPipelineCache()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        m_PipelineCache = CreateScope<VulkanPipelineCache>(m_Device, m_GPUProperties);
+    }
+
     void VulkanGraphicsContext::InitAllocator()
     {
         EE_PROFILE_ZONE_SCOPED()
@@ -542,6 +606,11 @@ namespace Elixir
 
         VK_CHECK_RESULT(vkResetFences(m_Device, 1, &frame.RenderFence));
 
+        // The last frame with this index is done, so is its transient data
+        m_FrameArena->BeginFrame(GetFrameIndex());
+
+        FlushDeferredDestructions();
+
         frame.InUseByRenderThread = true;
 
         if (m_SwapchainRecreateRequested)
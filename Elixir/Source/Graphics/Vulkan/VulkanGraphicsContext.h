@@ -7,6 +7,7 @@
 #include <Engine/Graphics/GraphicsContext.h>
 #include <Graphics/Vulkan/Converters.h>
 #include <Graphics/Vulkan/VulkanDescriptorPool.h>
+#include <Graphics/Vulkan/VulkanPipelineCache.h>
 
 #include <vulkan/vulkan.h>
 #include <vk_mem_alloc.h>
@@ -70,6 +71,15 @@ namespace Elixir::Vulkan
         Ref<CommandBuffer> GetUploadCommandBuffer() const override;
         void EnqueueSecondaryCommandBuffer(const Ref<CommandBuffer>& cmd) const override;
 
+        bool IsFormatSupported(EImageFormat format, EImageUsage usage) const override;
+
+        /**
+         * Destroy a resource once the frames in flight that may still use it have finished
+         * rendering. Can be called from any thread.
+         * @param deleter Destroys the resource.
+         */
+        void DeferDestruction(std::function<void()>&& deleter) const;
+
         Extent3D GetSwapchainExtent() const override { return m_SwapchainExtent;}
 
         SFrameData& GetCurrentFrame() { return m_Frames[GetFrameIndex()]; }
@@ -82,6 +92,7 @@ namespace Elixir::Vulkan
         VkQueue GetTransferQueue() const { return m_TransferQueue; }
         uint32_t GetTransferQueueFamily() const { return m_TransferQueueFamily; }
         VmaAllocator GetAllocator() const { return m_Allocator; }
+        VkPipelineCache GetPipelineCache() const { return m_PipelineCache->GetVulkanPipelineCache(); }
         Ref<VulkanDescriptorPool> GetDescriptorPool() const { return m_DescriptorPool; }
         Ref<VulkanBindlessDescriptorPool> GetBindlessDescriptorPool() const { return m_BindlessDescriptorPool; }
 
@@ -91,6 +102,7 @@ namespace Elixir::Vulkan
 
       private:
         void InitVulkan();
+        void InitPipelineCache();
         void InitAllocator();
         void InitSwapchain();
         void InitCommandPoolManager();
@@ -105,6 +117,7 @@ namespace Elixir::Vulkan
 
         void WaitDeviceIdle() const;
         void WaitForAllFrames();
+        void FlushDeferredDestructions(bool all = false);
 
         bool Prepare();
         void Submit();
@@ -141,6 +154,7 @@ namespace Elixir::Vulkan
         uint32_t m_TransferQueueFamily;
 
         VmaAllocator m_Allocator;
+        Scope<VulkanPipelineCache> m_PipelineCache;
         Ref<VulkanDescriptorPool> m_DescriptorPool;
         Ref<VulkanBindlessDescriptorPool> m_BindlessDescriptorPool;
 
@@ -152,6 +166,15 @@ namespace Elixir::Vulkan
 
         SDeletionQueue m_DeletionQueue;
 
+        struct SDeferredDestruction
+        {
+            uint32_t FrameNumber;
+            std::function<void()> Deleter;
+        };
+
+        mutable std::vector<SDeferredDestruction> m_DeferredDestructions;
+        mutable std::mutex m_DeferredDestructionsMutex;
+
         Executor* m_Executor;
         std::atomic<bool> m_AcceptingFrames{true};
         std::counting_semaphore<2> m_FrameSemaphore{2};
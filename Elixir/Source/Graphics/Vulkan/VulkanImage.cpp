@@ -223,6 +223,29 @@ namespace Elixir::Vulkan
         );
     }
 
+    template <typename Base>
+    void VulkanBaseImage<Base>::SetBaseMipLevel(const uint32_t level)
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        EE_CORE_ASSERT(level < this->m_MipLevels, "Base mip level out of range!")
+
+        if (level == this->m_BaseMipLevel) return;
+        this->m_BaseMipLevel = level;
+
+        // Frames in flight may still sample through the old view
+        m_GraphicsContext->DeferDestruction([device = m_GraphicsContext->GetDevice(), view = m_ImageView]()
+        {
+            vkDestroyImageView(device, view, nullptr);
+        });
+
+        CreateImageView();
+        CreateDescriptorInfo();
+        if (this->GetSampler()) UpdateSampler();
+
+        if constexpr (std::is_base_of_v<Texture, Base>)
+            m_GraphicsContext->GetBindlessDescriptorPool()->RefreshTexture(static_cast<Texture*>(this));
+    }
+
     template <typename Base>
     VulkanBaseImage<Base>::VulkanBaseImage(
         const GraphicsContext* context,
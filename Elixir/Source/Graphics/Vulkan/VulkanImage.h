@@ -55,6 +55,8 @@ namespace Elixir::Vulkan
             std::span<SBufferImageCopy> regions = {}
         ) override;
 
+        void SetBaseMipLevel(uint32_t level) override;
+
         bool IsValid() const override { return m_Image != VK_NULL_HANDLE; }
 
         VkImage GetVulkanImage() const override { return m_Image; }
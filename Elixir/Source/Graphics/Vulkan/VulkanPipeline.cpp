@@ -8,12 +8,43 @@
 
 namespace Elixir::Vulkan
 {
+    /* VulkanSpecialization */
+
+    VulkanSpecialization::VulkanSpecialization(const ShaderPermutation& permutation)
+    {
+        const auto& constants = permutation.GetConstants();
+        m_Entries.reserve(constants.size());
+        m_Data.reserve(constants.size());
+
+        for (const auto& constant : constants)
+        {
+            VkSpecializationMapEntry entry = {};
+            entry.constantID = constant.Id;
+            entry.offset = (uint32_t)(m_Data.size() * sizeof(uint32_t));
+            entry.size = sizeof(uint32_t);
+
+            m_Entries.push_back(entry);
+            m_Data.push_back(constant.Value);
+        }
+
+        m_Info = {};
+        m_Info.mapEntryCount = (uint32_t)m_Entries.size();
+        m_Info.pMapEntries = m_Entries.data();
+        m_Info.dataSize = m_Data.size() * sizeof(uint32_t);
+        m_Info.pData = m_Data.data();
+    }
+
+    const VkSpecializationInfo* VulkanSpecialization::GetInfo() const
+    {
+        return m_Entries.empty() ? nullptr : &m_Info;
+    }
+
     /* VulkanGraphicsPipeline */
 
     VulkanGraphicsPipeline::VulkanGraphicsPipeline(
         const GraphicsContext* context,
         const SPipelineCreateInfo& info
-    ) : GraphicsPipeline(context, info), m_Pipeline(VK_NULL_HANDLE)
+    ) : GraphicsPipeline(context, info), m_Pipeline(VK_NULL_HANDLE), m_Specialization(info.Permutation)
     {
         EE_PROFILE_ZONE_SCOPED()
         m_GraphicsContext = static_cast<const VulkanGraphicsContext*>(context);
@@ -56,6 +87,7 @@ namespace Elixir::Vulkan
             stageInfo.stage = Converters::GetShaderStage(module->GetStage());
             stageInfo.module = vkModule->GetVulkanShaderModule();
             stageInfo.pName = module->GetEntrypoint().c_str();
+            stageInfo.pSpecializationInfo = m_Specialization.GetInfo();
 
             m_ShaderStages.push_back(stageInfo);
         }
@@ -107,7 +139,7 @@ namespace Elixir::Vulkan
         VK_CHECK_RESULT(
             vkCreateGraphicsPipelines(
                 m_GraphicsContext->GetDevice(),
-                VK_NULL_HANDLE,
+                m_GraphicsContext->GetPipelineCache(),
                 1,
                 &info,
                 nullptr,
@@ -276,7 +308,7 @@ namespace Elixir::Vulkan
     VulkanComputePipeline::VulkanComputePipeline(
         const GraphicsContext* context,
         const SPipelineCreateInfo& info
-    ): ComputePipeline(context, info), m_Pipeline(VK_NULL_HANDLE)
+    ): ComputePipeline(context, info), m_Pipeline(VK_NULL_HANDLE), m_Specialization(info.Permutation)
     {
         EE_PROFILE_ZONE_SCOPED()
         m_GraphicsContext = static_cast<const VulkanGraphicsContext*>(context);
@@ -319,6 +351,7 @@ namespace Elixir::Vulkan
         m_ShaderStage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
         m_ShaderStage.module = vkModule->GetVulkanShaderModule();
         m_ShaderStage.pName = computeModule->GetEntrypoint().c_str();
+        m_ShaderStage.pSpecializationInfo = m_Specialization.GetInfo();
     }
 
     void VulkanComputePipeline::CreatePipeline()
@@ -332,7 +365,7 @@ namespace Elixir::Vulkan
         VK_CHECK_RESULT(
             vkCreateComputePipelines(
                 m_GraphicsContext->GetDevice(),
-                VK_NULL_HANDLE,
+                m_GraphicsContext->GetPipelineCache(),
                 1,
                 &info,
                 nullptr,
@@ -9,6 +9,28 @@ namespace Elixir::Vulkan
 {
     using namespace Elixir;
 
+    /**
+     * Specialization info of a shader permutation, kept alive until the pipeline is built.
+     */
+    class VulkanSpecialization final
+    {
+      public:
+        explicit VulkanSpecialization(const ShaderPermutation& permutation);
+
+        VulkanSpecialization(const VulkanSpecialization&) = delete;
+        VulkanSpecialization& operator=(const VulkanSpecialization&) = delete;
+
+        /**
+         * @return The info to set on the shader stages, or nullptr for the default permutation.
+         */
+        const VkSpecializationInfo* GetInfo() const;
+
+      private:
+        std::vector<VkSpecializationMapEntry> m_Entries;
+        std::vector<uint32_t> m_Data;
+        VkSpecializationInfo m_Info;
+    };
+
     class ELIXIR_API VulkanGraphicsPipeline final : public GraphicsPipeline
     {
       public:
@@ -39,6 +61,7 @@ namespace Elixir::Vulkan
         std::vector<VkVertexInputAttributeDescription> m_Attributes;
 
         std::vector<VkPipelineShaderStageCreateInfo> m_ShaderStages;
+        VulkanSpecialization m_Specialization;
 
         std::vector<VkPipelineColorBlendAttachmentState> m_ColorBlendAttachments;
 
@@ -69,6 +92,7 @@ namespace Elixir::Vulkan
         VkPipelineLayout m_PipelineLayout;
 
         VkPipelineShaderStageCreateInfo m_ShaderStage;
+        VulkanSpecialization m_Specialization;
 
         const VulkanGraphicsContext* m_GraphicsContext;
     };
@@ -0,0 +1,92 @@
+#include "epch.h"
+#include "VulkanPipelineCache.h"
+
+#include "Utils.h"
+
+#include <Engine/Core/File.h>
+#include <Engine/Core/MappedFile.h>
+
+namespace Elixir::Vulkan
+{
+    VulkanPipelineCache::VulkanPipelineCache(
+        const VkDevice device,
+        const VkPhysicalDeviceProperties& properties
+    ) : m_Device(device), m_Path(GetPath(properties))
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        // The mapping only needs to outlive the creation, the driver copies the data
+        const auto file = MappedFile::Open(m_Path);
+
+        VkPipelineCacheCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        info.pNext = nullptr;
+
+        if (file && IsCompatible({ file->GetData(), file->GetSize() }, properties))
+        {
+            info.initialDataSize = file->GetSize();
+            info.pInitialData = file->GetData();
+            EE_CORE_INFO("Pipeline cache loaded [Path={0}, Size={1}].", m_Path.string(), file->GetSize())
+        }
+        else if (file)
+        {
+            EE_CORE_WARN("Ignoring incompatible pipeline cache! [Path={0}]", m_Path.string())
+        }
+
+        VK_CHECK_RESULT(vkCreatePipelineCache(m_Device, &info, nullptr, &m_PipelineCache));
+    }
+
+    VulkanPipelineCache::~VulkanPipelineCache()
+    {
+        EE_PROFILE_ZONE_SCOPED()
+        vkDestroyPipelineCache(m_Device, m_PipelineCache, nullptr);
+    }
+
+    bool VulkanPipelineCache::Save() const
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        size_t size = 0;
+        VK_CHECK_RESULT(vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, nullptr));
+
+        std::vector<Byte> data(size);
+        VK_CHECK_RESULT(vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, data.data()));
+        data.resize(size);
+
+        if (!WriteFileAtomic(m_Path, data))
+        {
+            EE_CORE_WARN("Cannot write pipeline cache! [Path={0}]", m_Path.string())
+            return false;
+        }
+
+        EE_CORE_TRACE("Pipeline cache written [Path={0}, Size={1}].", m_Path.string(), data.size())
+        return true;
+    }
+
+    std::filesystem::path VulkanPipelineCache::GetPath(const VkPhysicalDeviceProperties& properties)
+    {
+        std::string uuid;
+        for (const auto byte : properties.pipelineCacheUUID)
+            uuid += std::format("{:02x}", byte);
+
+        return DIRECTORY / std::format("{:04x}-{:04x}-{}.bin", properties.vendorID, properties.deviceID, uuid);
+    }
+
+    bool VulkanPipelineCache::IsCompatible(
+        const std::span<const Byte> data,
+        const VkPhysicalDeviceProperties& properties
+    )
+    {
+        VkPipelineCacheHeaderVersionOne header;
+        if (data.size() < sizeof(header))
+            return false;
+
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        return header.headerSize >= sizeof(header)
+            && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+            && header.vendorID == properties.vendorID
+            && header.deviceID == properties.deviceID
+            && std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+}
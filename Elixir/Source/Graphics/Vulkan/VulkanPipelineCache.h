@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Engine/Core/Core.h>
+
+#include <vulkan/vulkan.h>
+
+namespace Elixir::Vulkan
+{
+    /**
+     * Driver pipeline cache shared by every pipeline created on the device, persisted between
+     * runs so pipelines are not recompiled from SPIR-V at each launch. The file is keyed by
+     * the device's pipeline cache UUID, which changes with the driver version; data whose
+     * header does not match the device is discarded instead of handed to the driver.
+     */
+    class ELIXIR_API VulkanPipelineCache final
+    {
+      public:
+        static inline const std::filesystem::path DIRECTORY = "./Cache/Pipelines";
+
+        VulkanPipelineCache(VkDevice device, const VkPhysicalDeviceProperties& properties);
+        ~VulkanPipelineCache();
+
+        VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+        VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+        /**
+         * Write the cache contents to disk, replacing the existing file atomically.
+         * @return true if the file was written.
+         */
+        bool Save() const;
+
+        VkPipelineCache GetVulkanPipelineCache() const { return m_PipelineCache; }
+
+        static std::filesystem::path GetPath(const VkPhysicalDeviceProperties& properties);
+
+        /**
+         * Check that cache data was produced by the given device and driver.
+         * @param data The cache data, starting with its header.
+         * @param properties The device properties.
+         * @return true if the data can be used to create a cache on the device.
+         */
+        static bool IsCompatible(std::span<const Byte> data, const VkPhysicalDeviceProperties& properties);
+
+      private:
+        VkDevice m_Device;
+        VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
+        std::filesystem::path m_Path;
+    };
+}
@@ -341,22 +341,10 @@ namespace Elixir::Vulkan
 
         m_DescriptorSets.resize(m_DescriptorSetLayouts.size());
 
+        // The pool is shared with shaders created on other threads
+        const auto& pool = m_GraphicsContext->GetDescriptorPool();
         for (auto i = 0; i < m_DescriptorSetLayouts.size(); i++)
-        {
-            VkDescriptorSetAllocateInfo allocInfo = {};
-            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-            allocInfo.pSetLayouts = &m_DescriptorSetLayouts[i];
-            allocInfo.descriptorSetCount = 1;
-            allocInfo.descriptorPool = m_GraphicsContext->GetDescriptorPool()->GetVulkanDescriptorPool();
-
-            VK_CHECK_RESULT(
-                vkAllocateDescriptorSets(
-                    m_GraphicsContext->GetDevice(),
-                    &allocInfo,
-                    &m_DescriptorSets[i]
-                )
-            );
-        }
+            m_DescriptorSets[i] = pool->Allocate(m_DescriptorSetLayouts[i]);
 
         UpdateDescriptorSets();
     }
@@ -1,20 +1,39 @@
 #include "epch.h"
 #include "FreeTypeFontBackend.h"
 
+#include <Engine/Font/GlyphAtlas.h>
+
 #include <msdf-atlas-gen/msdf-atlas-gen.h>
 #include <msdfgen/msdfgen.h>
 #include <msdfgen/msdfgen-ext.h>
 #include <ft2build.h>
 #include FT_FREETYPE_H
-#include "spdlog/fmt/bundled/base.h"
 using namespace msdf_atlas;
 
 namespace Elixir
 {
+    static constexpr double MAX_CORNER_ANGLE = 3.0;
+    static constexpr double MITER_LIMIT = 1.0;
+
+    struct SCharsetRange
+    {
+        uint32_t Begin, End;
+    };
+
+    // Glyphs loaded up front (and cached on disk), others are loaded on first use
+    static constexpr SCharsetRange CHARSET_RANGES[] =
+    {
+        { 0x0020, 0x00FF }
+    };
+
+    /**
+     * Convert a bottom-up float bitmap to a top-down byte bitmap.
+     */
     template <int N>
-    std::vector<uint8_t> InvertBitmap(const msdfgen::BitmapConstRef<uint8_t, N>& bitmap)
+    TaggedVector<EMemoryTag::Fonts, uint8_t> InvertBitmap(const msdfgen::BitmapConstRef<float, N>& bitmap)
     {
-        std::vector<uint8_t> inverted;
+        TaggedVector<EMemoryTag::Fonts, uint8_t> inverted;
+        inverted.reserve((size_t)N * bitmap.width * bitmap.height);
 
         for (int y = 0; y < bitmap.height; ++y)
         {
@@ -23,7 +42,7 @@ namespace Elixir
             {
                 for (int c = 0; c < N; ++c)
                 {
-                    inverted.push_back(bitmap(x, flippedY)[c]);
+                    inverted.push_back(msdfgen::pixelFloatToByte(bitmap(x, flippedY)[c]));
                 }
             }
         }
@@ -31,8 +50,7 @@ namespace Elixir
         return inverted;
     }
 
-    FreeTypeFontBackend::FreeTypeFontBackend(const GraphicsContext* context)
-        : m_GraphicsContext(context)
+    FreeTypeFontBackend::FreeTypeFontBackend()
     {
         EE_PROFILE_ZONE_SCOPED()
         EE_CORE_ASSERT(!FT_Init_FreeType(&m_Library), "Could not init FreeType!");
@@ -42,10 +60,8 @@ namespace Elixir
     {
         EE_PROFILE_ZONE_SCOPED()
 
-        for (const auto& face : m_Fonts | std::views::values)
-        {
-            FT_Done_Face(face);
-        }
+        for (const auto& data : m_Fonts | std::views::values)
+            ReleaseFace(data->Face, data->Handle);
         m_Fonts.clear();
 
         FT_Done_FreeType(m_Library);
@@ -55,93 +71,133 @@ namespace Elixir
     {
         EE_PROFILE_ZONE_SCOPED()
 
-        FT_Face face;
+        const auto name = filepath.stem().string();
+        {
+            std::shared_lock lock(m_FontsMutex);
+            if (const auto it = m_Fonts.find(name); it != m_Fonts.end())
+                return it->second->LoadedFont;
+        }
 
-        if (FT_New_Face(m_Library, filepath.string().c_str(), 0, &face))
+        const auto fontFile = MappedFile::Open(filepath);
+        if (!fontFile)
         {
             EE_CORE_FATAL("Cannot load font! [Path={0}]", filepath.string())
             return nullptr;
         }
 
-        if (auto f = msdfgen::adoptFreetypeFont(face))
+        FT_Face face;
         {
-            const auto name = filepath.stem().string();
-
-
-            SFontCreateInfo info = {};
-            info.Name = name;
+            std::lock_guard lock(m_LibraryMutex);
+            if (FT_New_Face(m_Library, filepath.string().c_str(), 0, &face))
+            {
+                EE_CORE_FATAL("Cannot load font! [Path={0}]", filepath.string())
+                return nullptr;
+            }
+        }
 
-            std::vector<GlyphGeometry> glyphs;
-            FontGeometry fontGeometry(&glyphs);
+        if (auto f = msdfgen::adoptFreetypeFont(face))
+        {
+            auto data = CreateScope<SFontData>();
+            data->Face = face;
+            data->Handle = f;
+            data->CacheKey = FontCache::ComputeKey(
+                { fontFile->GetData(), fontFile->GetSize() },
+                std::as_bytes(std::span(CHARSET_RANGES)),
+                PX_RANGE,
+                GLYPH_SCALE
+            );
+            data->CachePath = FontCache::GetPath(name, data->CacheKey);
 
-            struct SCharsetRange
+            Ref<Font> font;
+            if (auto cache = FontCache::Open(data->CachePath, data->CacheKey))
             {
-                uint32_t Begin, End;
-            };
+                auto info = cache->GetCreateInfo(name);
+                info.Atlas = { PX_RANGE, GlyphAtlas::PAGE_SIZE, GlyphAtlas::PAGE_SIZE };
+                font = CreateRef<Font>(info);
 
-            static constexpr SCharsetRange charsetRanges[] =
-            {
-                { 0x0020, 0x00FF }
-            };
+                for (const auto& [a, b, kerning] : cache->GetKerning())
+                    font->SetKerning(a, b, kerning);
 
-            Charset charset;
-            for (auto& [begin, end] : charsetRanges)
+                data->GeometryScale = cache->GetGeometryScale();
+                data->Cache = std::move(cache);
+                EE_CORE_TRACE("Loaded font from cache [Font = {0}].", name)
+            }
+            else
             {
-                for (uint32_t c = begin; c <= end; c++)
-                    charset.add(c);
+                font = LoadGeometry(*data, f, name);
             }
 
-            const auto count = fontGeometry.loadCharset(f, 1.0, charset);
-            EE_CORE_TRACE("Loaded {0} glyphs (out of {1}) [Font = {2}].", count, charset.size(), name)
+            data->LoadedFont = font;
 
-            for (auto& glyph : glyphs)
-            {
-                constexpr double maxCornerAngle = 3.0;
-                glyph.edgeColoring(&msdfgen::edgeColoringByDistance, maxCornerAngle, 0);
-            }
+            // Another worker may have loaded a font of the same name meanwhile, its glyphs
+            // may be generating already, so keep it and drop this one.
+            std::unique_lock lock(m_FontsMutex);
+            const auto [it, inserted] = m_Fonts.try_emplace(name, std::move(data));
+            if (inserted)
+                return font;
 
-            TightAtlasPacker packer;
-            packer.setDimensionsConstraint(DimensionsConstraint::SQUARE);
-            packer.setMinimumScale(64.0);
-            packer.setPixelRange(PX_RANGE);
-            packer.setMiterLimit(1.0);
-
-            const auto remaining = packer.pack(glyphs.data(), glyphs.size());
-            EE_CORE_ASSERT(remaining == 0, "Failed to pack glyphs!")
-
-            int width = 0, height = 0;
-            packer.getDimensions(width, height);
-
-            GeneratorAttributes genAttribs;
-            genAttribs.config.overlapSupport = true;
-            genAttribs.scanlinePass = true;
-
-            ImmediateAtlasGenerator<float, 4, mtsdfGenerator, BitmapAtlasStorage<uint8_t, 4>> mtsdfGenerator(width, height);
-            mtsdfGenerator.setAttributes(genAttribs);
-            mtsdfGenerator.setThreadCount(8);
-
-            mtsdfGenerator.generate(glyphs.data(), glyphs.size());
-            msdfgen::BitmapConstRef<uint8_t, 4> mtsdf = mtsdfGenerator.atlasStorage();
-            const auto mtsdfInverted = InvertBitmap<4>(mtsdf);
-
-            info.AscenderY = fontGeometry.getMetrics().ascenderY;
-            info.DescenderY = fontGeometry.getMetrics().descenderY;
-            info.Atlas.Info.PxRange = PX_RANGE;
-            info.Atlas.Info.Width = width;
-            info.Atlas.Info.Height = height;
-
-            info.Atlas.MTSDF = Texture2D::Create(
-                m_GraphicsContext,
-                EImageFormat::R8G8B8A8_UNORM,
-                width, height,
-                mtsdfInverted.data()
-            );
+            auto existing = it->second->LoadedFont;
+            lock.unlock();
+
+            ReleaseFace(data->Face, data->Handle);
+            return existing;
+        }
 
-            for (auto& g : glyphs)
+        ReleaseFace(face, nullptr);
+        EE_CORE_FATAL("Cannot load font! [Path={0}]", filepath.string())
+        return nullptr;
+    }
+
+    void FreeTypeFontBackend::ReleaseFace(const FT_Face face, msdfgen::FontHandle* handle)
+    {
+        if (handle)
+            msdfgen::destroyFont(handle);
+
+        std::lock_guard lock(m_LibraryMutex);
+        FT_Done_Face(face);
+    }
+
+    Ref<Font> FreeTypeFontBackend::LoadGeometry(
+        SFontData& data,
+        msdfgen::FontHandle* handle,
+        const std::string& name
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        SFontCreateInfo info = {};
+        info.Name = name;
+
+        std::vector<GlyphGeometry> glyphs;
+        FontGeometry fontGeometry(&glyphs);
+
+        Charset charset;
+        for (auto& [begin, end] : CHARSET_RANGES)
+        {
+            for (uint32_t c = begin; c <= end; c++)
+                charset.add(c);
+        }
+
+        // Only the metrics of the base charset are loaded here, the MTSDFs are generated
+        // on demand by GenerateGlyph.
+        const auto count = fontGeometry.loadCharset(handle, 1.0, charset);
+        EE_CORE_TRACE("Loaded {0} glyphs (out of {1}) [Font = {2}].", count, charset.size(), name)
+
+        info.AscenderY = fontGeometry.getMetrics().ascenderY;
+        info.DescenderY = fontGeometry.getMetrics().descenderY;
+        info.Atlas = { PX_RANGE, GlyphAtlas::PAGE_SIZE, GlyphAtlas::PAGE_SIZE };
+
+        auto cache = CreateScope<SFontCacheData>();
+
+        for (auto& g : glyphs)
+        {
+            SGlyph glyph;
+            glyph.Unicode = g.getCodepoint();
+            glyph.Advance = g.getAdvance();
+
+            if (!g.isWhitespace())
             {
-                SGlyph glyph;
-                glyph.Unicode = g.getCodepoint();
-                glyph.Advance = g.getAdvance();
+                g.wrapBox(GLYPH_SCALE, PX_RANGE / GLYPH_SCALE, MITER_LIMIT);
 
                 double pl, pb, pr, pt;
                 g.getQuadPlaneBounds(pl, pb, pr, pt);
@@ -150,33 +206,135 @@ namespace Elixir
                     { float(pr), float(pt) }
                 };
 
-                double al, ab, ar, at;
-                g.getQuadAtlasBounds(al, ab, ar, at);
-                glyph.AtlasBounds = SRect{
-                    { float(al), float(ab) },
-                    { float(ar), float(at) }
-                };
-
-                info.Glyphs.push_back(glyph);
+                data.PendingGlyphs.insert(glyph.Unicode);
             }
 
-            Ref<Font> font = CreateRef<Font>(info);
+            info.Glyphs.push_back(glyph);
+        }
 
-            auto kerning = fontGeometry.getKerning();
-            for (const auto& [codepoints, adjustment] : kerning)
-            {
-                const auto a = codepoints.first;
-                const auto b = codepoints.second;
-                font->SetKerning(a, b, (float)adjustment);
-            }
+        Ref<Font> font = CreateRef<Font>(info);
+
+        auto kerning = fontGeometry.getKerning();
+        for (const auto& [codepoints, adjustment] : kerning)
+        {
+            const auto a = codepoints.first;
+            const auto b = codepoints.second;
+            font->SetKerning(a, b, (float)adjustment);
+            cache->Kerning.push_back({ (int)a, (int)b, (float)adjustment });
+        }
+
+        data.GeometryScale = fontGeometry.getGeometryScale();
+
+        cache->Info = std::move(info);
+        cache->GeometryScale = data.GeometryScale;
+        data.PendingCache = std::move(cache);
+
+        return font;
+    }
+
+    std::optional<SGlyphBitmap> FreeTypeFontBackend::GenerateGlyph(
+        const std::string& font,
+        const uint32_t codepoint
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
 
-            msdfgen::destroyFont(f);
+        SFontData* data;
+        {
+            std::shared_lock lock(m_FontsMutex);
+            const auto it = m_Fonts.find(font);
+            if (it == m_Fonts.end())
+                return std::nullopt;
+            data = it->second.get();
+        }
 
-            m_Fonts[name] = face;
-            return std::move(font);
+        if (data->Cache)
+        {
+            if (auto bitmap = data->Cache->GetGlyphBitmap(font, codepoint))
+                return bitmap;
         }
 
-        EE_CORE_FATAL("Cannot load font! [Path={0}]", filepath.string())
-        return nullptr;
+        auto bitmap = Rasterize(*data, font, codepoint);
+        RecordForCache(*data, codepoint, bitmap);
+        return bitmap;
+    }
+
+    std::optional<SGlyphBitmap> FreeTypeFontBackend::Rasterize(
+        SFontData& data,
+        const std::string& font,
+        const uint32_t codepoint
+    )
+    {
+        EE_PROFILE_ZONE_SCOPED()
+
+        GlyphGeometry g;
+        {
+            std::lock_guard lock(data.Mutex);
+            if (!g.load(data.Handle, data.GeometryScale, (unicode_t)codepoint))
+                return std::nullopt;
+        }
+
+        SGlyphBitmap bitmap;
+        bitmap.Font = font;
+        bitmap.Glyph.Unicode = (int)codepoint;
+        bitmap.Glyph.Advance = (float)g.getAdvance();
+
+        if (g.isWhitespace())
+            return bitmap;
+
+        g.edgeColoring(&msdfgen::edgeColoringByDistance, MAX_CORNER_ANGLE, 0);
+        g.wrapBox(GLYPH_SCALE, PX_RANGE / GLYPH_SCALE, MITER_LIMIT);
+        g.placeBox(0, 0);
+
+        double pl, pb, pr, pt;
+        g.getQuadPlaneBounds(pl, pb, pr, pt);
+        bitmap.Glyph.PlaneBounds = SRect{
+            { float(pl),  float(pb) },
+            { float(pr), float(pt) }
+        };
+
+        double al, ab, ar, at;
+        g.getQuadAtlasBounds(al, ab, ar, at);
+        bitmap.Glyph.AtlasBounds = SRect{
+            { float(al), float(ab) },
+            { float(ar), float(at) }
+        };
+
+        int width = 0, height = 0;
+        g.getBoxSize(width, height);
+
+        std::vector<float> pixels((size_t)4 * width * height);
+        const msdfgen::BitmapRef<float, 4> mtsdf(pixels.data(), width, height);
+
+        GeneratorAttributes genAttribs;
+        genAttribs.config.overlapSupport = true;
+        genAttribs.scanlinePass = true;
+        mtsdfGenerator(mtsdf, g, genAttribs);
+
+        bitmap.Width = width;
+        bitmap.Height = height;
+        bitmap.Pixels = InvertBitmap<4>(mtsdf);
+        return bitmap;
+    }
+
+    void FreeTypeFontBackend::RecordForCache(
+        SFontData& data,
+        const uint32_t codepoint,
+        const std::optional<SGlyphBitmap>& bitmap
+    )
+    {
+        std::lock_guard lock(data.CacheMutex);
+
+        if (!data.PendingCache || !data.PendingGlyphs.erase(codepoint))
+            return;
+
+        if (bitmap.has_value())
+            data.PendingCache->Bitmaps.push_back(bitmap.value());
+
+        if (data.PendingGlyphs.empty())
+        {
+            FontCache::Write(data.CachePath, data.CacheKey, *data.PendingCache);
+            data.PendingCache.reset();
+        }
     }
-}
\ No newline at end of file
+}
@@ -1,25 +1,66 @@
 #pragma once
 
 #include <Engine/Font/FontBackend.h>
+#include <Engine/Font/FontCache.h>
 
 #include <freetype/freetype.h>
 
+#include <shared_mutex>
+
+namespace msdfgen
+{
+    class FontHandle;
+}
+
 namespace Elixir
 {
     class ELIXIR_API FreeTypeFontBackend final : public FontBackend
     {
       public:
         static constexpr float PX_RANGE = 4.0;
+        static constexpr double GLYPH_SCALE = 64.0;
 
-        explicit FreeTypeFontBackend(const GraphicsContext* context);
+        FreeTypeFontBackend();
         ~FreeTypeFontBackend() override;
 
         Ref<Font> Load(const std::filesystem::path& filepath) override;
+        std::optional<SGlyphBitmap> GenerateGlyph(const std::string& font, uint32_t codepoint) override;
 
       private:
-        FT_Library m_Library;
-        std::unordered_map<std::string, FT_Face> m_Fonts;
+        struct SFontData
+        {
+            FT_Face Face = nullptr;
+            msdfgen::FontHandle* Handle = nullptr;
+            double GeometryScale = 1.0;
+
+            // Returned again when the font is loaded twice.
+            Ref<Font> LoadedFont;
+
+            // FreeType faces are not thread-safe, outline loading is serialized per font.
+            std::mutex Mutex;
 
-        const GraphicsContext* m_GraphicsContext;
+            // Cache hit: base charset bitmaps are read from the mapped cache file.
+            Scope<FontCache> Cache;
+
+            // Cache miss: base charset bitmaps are collected as they are generated, and the
+            // cache is written once the last one is done.
+            std::filesystem::path CachePath;
+            uint64_t CacheKey = 0;
+            Scope<SFontCacheData> PendingCache;
+            std::unordered_set<uint32_t> PendingGlyphs;
+            std::mutex CacheMutex;
+        };
+
+        static Ref<Font> LoadGeometry(SFontData& data, msdfgen::FontHandle* handle, const std::string& name);
+        static std::optional<SGlyphBitmap> Rasterize(SFontData& data, const std::string& font, uint32_t codepoint);
+        static void RecordForCache(SFontData& data, uint32_t codepoint, const std::optional<SGlyphBitmap>& bitmap);
+
+        void ReleaseFace(FT_Face face, msdfgen::FontHandle* handle);
+
+        FT_Library m_Library;
+        // Guards face creation, fonts may be loaded from several workers at once.
+        std::mutex m_LibraryMutex;
+        std::unordered_map<std::string, Scope<SFontData>> m_Fonts;
+        std::shared_mutex m_FontsMutex;
     };
-}
\ No newline at end of file
+}
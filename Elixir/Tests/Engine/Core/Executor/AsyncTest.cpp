@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/Async.h>
+using namespace Elixir;
+
+namespace
+{
+    ThreadPool* GetCurrentPool()
+    {
+        const auto worker = Thread::GetCurrent();
+        return worker ? worker->GetPool() : nullptr;
+    }
+
+    // Resumes its awaiting coroutines on the pool once set, like an asset finishing to load
+    class Event
+    {
+      public:
+        explicit Event(ThreadPool& pool) : m_Pool(pool) {}
+
+        bool await_ready() const { return false; }
+
+        bool await_suspend(const std::coroutine_handle<> handle)
+        {
+            std::lock_guard lock(m_Mutex);
+            if (m_Set) return false;
+
+            m_Waiters.push_back(handle);
+            return true;
+        }
+
+        void await_resume() const {}
+
+        void Set()
+        {
+            std::vector<std::coroutine_handle<>> waiters;
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Set = true;
+                waiters.swap(m_Waiters);
+            }
+
+            for (const auto handle : waiters)
+                m_Pool.Enqueue([handle] { handle.resume(); });
+        }
+
+        size_t GetWaiterCount()
+        {
+            std::lock_guard lock(m_Mutex);
+            return m_Waiters.size();
+        }
+
+      private:
+        ThreadPool& m_Pool;
+        std::mutex m_Mutex;
+        std::vector<std::coroutine_handle<>> m_Waiters;
+        bool m_Set = false;
+    };
+
+    Async<int> Answer()
+    {
+        co_return 42;
+    }
+
+    Async<int> AnswerOn(ThreadPool& pool)
+    {
+        co_await Schedule(pool);
+        co_return GetCurrentPool() == &pool ? 42 : -1;
+    }
+
+    Async<> Throw(ThreadPool& pool)
+    {
+        co_await Schedule(pool);
+        throw std::runtime_error("Failed");
+    }
+}
+
+class AsyncTest : public Test
+{
+  protected:
+    static constexpr size_t WORKERS = 2;
+    ThreadPool Pool { WORKERS, "Test" };
+};
+
+TEST_F(AsyncTest, ReturnsValue)
+{
+    auto async = Answer();
+    EXPECT_TRUE(async.IsValid());
+    EXPECT_FALSE(async.IsReady());
+
+    EXPECT_EQ(async.Get(), 42);
+    EXPECT_TRUE(async.IsReady());
+}
+
+TEST_F(AsyncTest, ScheduleContinuesOnThePool)
+{
+    EXPECT_EQ(AnswerOn(Pool).Get(), 42);
+}
+
+TEST_F(AsyncTest, AwaitsNestedCoroutines)
+{
+    ThreadPool other(1, "Other");
+
+    auto sum = [](ThreadPool& pool, ThreadPool& other) -> Async<int>
+    {
+        int total = co_await Answer();
+        total += co_await AnswerOn(other);
+
+        // Continues on the thread the awaited coroutine returned from
+        const bool onOther = GetCurrentPool() == &other;
+
+        co_await Schedule(pool);
+        total += co_await AnswerOn(pool);
+        co_return onOther && GetCurrentPool() == &pool ? total : -1;
+    };
+
+    EXPECT_EQ(sum(Pool, other).Get(), 3 * 42);
+}
+
+TEST_F(AsyncTest, RethrowsExceptions)
+{
+    auto direct = Throw(Pool);
+    EXPECT_THROW(direct.Get(), std::runtime_error);
+
+    auto awaiting = [](ThreadPool& pool) -> Async<bool>
+    {
+        try
+        {
+            co_await Throw(pool);
+        }
+        catch (const std::runtime_error&)
+        {
+            co_return true;
+        }
+
+        co_return false;
+    };
+
+    EXPECT_TRUE(awaiting(Pool).Get());
+}
+
+TEST_F(AsyncTest, StartRunsUntilTheFirstSuspension)
+{
+    std::atomic<int> step = 0;
+    Event event(Pool);
+
+    auto async = [](std::atomic<int>& step, Event& event) -> Async<>
+    {
+        step = 1;
+        co_await event;
+        step = 2;
+    }(step, event);
+
+    EXPECT_EQ(step, 0);
+    async.Start();
+    EXPECT_EQ(step, 1);
+    EXPECT_FALSE(async.IsReady());
+
+    event.Set();
+    async.Wait();
+    EXPECT_EQ(step, 2);
+    EXPECT_TRUE(async.IsReady());
+}
+
+TEST_F(AsyncTest, SuspendedCoroutinesDoNotHoldWorkers)
+{
+    constexpr int COROUTINES = 256;
+
+    Event event(Pool);
+    std::atomic<int> resumed = 0;
+
+    std::vector<Async<>> asyncs;
+    for (int i = 0; i < COROUTINES; i++)
+    {
+        asyncs.push_back([](ThreadPool& pool, Event& event, std::atomic<int>& resumed) -> Async<>
+        {
+            co_await Schedule(pool);
+            co_await event;
+            resumed++;
+        }(Pool, event, resumed));
+
+        asyncs.back().Start();
+    }
+
+    while (event.GetWaiterCount() < COROUTINES)
+        std::this_thread::yield();
+
+    // Every coroutine waits, yet the workers are free
+    WaitGroup wg;
+    std::atomic<bool> ran = false;
+    Pool.Enqueue([&ran] { ran = true; }, &wg);
+    EXPECT_TRUE(wg.WaitFor(std::chrono::seconds(10)));
+    EXPECT_TRUE(ran);
+
+    event.Set();
+    for (auto& async : asyncs)
+        async.Wait();
+
+    EXPECT_EQ(resumed, COROUTINES);
+}
+
+TEST_F(AsyncTest, DestructionWaitsForStartedCoroutine)
+{
+    std::atomic<bool> done = false;
+    {
+        auto async = [](ThreadPool& pool, std::atomic<bool>& done) -> Async<>
+        {
+            co_await Schedule(pool);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            done = true;
+        }(Pool, done);
+
+        async.Start();
+    }
+
+    EXPECT_TRUE(done);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/Parallel.h>
+using namespace Elixir;
+
+#include <numeric>
+
+class ParallelTest : public Test
+{
+  protected:
+    ThreadPool Pool { 4, "Test" };
+};
+
+TEST_F(ParallelTest, ForVisitsEveryIndexOnce)
+{
+    constexpr size_t COUNT = 10000;
+    std::vector<std::atomic<int>> visits(COUNT);
+
+    ParallelFor(Pool, 0, COUNT, 64, [&](const size_t i) { visits[i]++; });
+
+    for (size_t i = 0; i < COUNT; i++)
+        ASSERT_EQ(visits[i], 1) << "Index " << i;
+}
+
+TEST_F(ParallelTest, ForSplitsTheRangeWithoutGrain)
+{
+    std::vector<std::atomic<int>> visits(1001);
+
+    ParallelFor(Pool, 1, 1001, 0, [&](const size_t i) { visits[i]++; });
+
+    EXPECT_EQ(visits[0], 0);
+    for (size_t i = 1; i < visits.size(); i++)
+        ASSERT_EQ(visits[i], 1);
+}
+
+TEST_F(ParallelTest, ForWithinOneGrainRunsOnTheCaller)
+{
+    const auto caller = std::this_thread::get_id();
+    bool onCaller = true;
+
+    ParallelFor(Pool, 0, 16, 16, [&](size_t)
+    {
+        onCaller &= std::this_thread::get_id() == caller;
+    });
+
+    EXPECT_TRUE(onCaller);
+}
+
+TEST_F(ParallelTest, NestedLoopsDoNotDeadlock)
+{
+    std::atomic<int> count = 0;
+
+    // Every worker runs an outer chunk and waits on an inner loop
+    ParallelFor(Pool, 0, 64, 1, [&](size_t)
+    {
+        ParallelFor(Pool, 0, 64, 1, [&](size_t) { count++; });
+    });
+
+    EXPECT_EQ(count, 64 * 64);
+}
+
+TEST_F(ParallelTest, ReduceSumsInOrder)
+{
+    constexpr size_t COUNT = 100000;
+
+    const auto sum = ParallelReduce(Pool, 0, COUNT, 128, (uint64_t)0,
+        [](const size_t i) { return (uint64_t)i; },
+        [](const uint64_t a, const uint64_t b) { return a + b; }
+    );
+    EXPECT_EQ(sum, (uint64_t)COUNT * (COUNT - 1) / 2);
+
+    // Not commutative: only correct if the chunks are combined in order
+    const auto text = ParallelReduce(Pool, 0, 26, 3, std::string(),
+        [](const size_t i) { return std::string(1, (char)('a' + i)); },
+        [](std::string a, const std::string& b) { return a + b; }
+    );
+    EXPECT_EQ(text, "abcdefghijklmnopqrstuvwxyz");
+}
+
+TEST_F(ParallelTest, ReduceOfEmptyRangeIsIdentity)
+{
+    const auto result = ParallelReduce(Pool, 5, 5, 0, 42,
+        [](size_t) { return 1; },
+        [](const int a, const int b) { return a + b; }
+    );
+
+    EXPECT_EQ(result, 42);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/TaskGraph.h>
+using namespace Elixir;
+
+class TaskGraphTest : public Test
+{
+  protected:
+    ThreadPool Pool { 4, "Test" };
+};
+
+TEST_F(TaskGraphTest, TasksRunAfterTheirDependencies)
+{
+    // Diamond: a -> (b, c) -> d
+    std::atomic<int> order = 0;
+    int a = -1, b = -1, c = -1, d = -1;
+
+    TaskGraph graph;
+    const auto na = graph.Add([&] { a = order++; });
+    const auto nb = graph.Add([&] { b = order++; });
+    const auto nc = graph.Add([&] { c = order++; });
+    const auto nd = graph.Add([&] { d = order++; });
+    graph.Precede(na, nb);
+    graph.Precede(na, nc);
+    graph.Precede(nb, nd);
+    graph.Precede(nc, nd);
+
+    graph.Run(Pool);
+    graph.Wait();
+
+    EXPECT_EQ(a, 0);
+    EXPECT_GT(b, a);
+    EXPECT_GT(c, a);
+    EXPECT_EQ(d, 3);
+    EXPECT_FALSE(graph.IsRunning());
+}
+
+TEST_F(TaskGraphTest, GraphCanRunAgain)
+{
+    std::atomic<int> runs = 0;
+
+    TaskGraph graph;
+    auto previous = graph.Add([&] { runs++; });
+    for (int i = 0; i < 15; i++)
+    {
+        const auto next = graph.Add([&] { runs++; });
+        graph.Precede(previous, next);
+        previous = next;
+    }
+
+    for (int frame = 0; frame < 10; frame++)
+    {
+        graph.Run(Pool);
+        graph.Wait();
+    }
+
+    EXPECT_EQ(runs, 16 * 10);
+}
+
+TEST_F(TaskGraphTest, WideGraphJoinsOnce)
+{
+    constexpr int WIDTH = 1000;
+    std::atomic<int> done = 0;
+    int seen = -1;
+
+    TaskGraph graph;
+    const auto join = graph.Add([&] { seen = done; });
+    for (int i = 0; i < WIDTH; i++)
+        graph.Precede(graph.Add([&] { done++; }), join);
+
+    graph.Run(Pool);
+    graph.Wait();
+
+    EXPECT_EQ(seen, WIDTH);
+}
+
+TEST_F(TaskGraphTest, EmptyGraphCompletesImmediately)
+{
+    TaskGraph graph;
+    graph.Run(Pool);
+    graph.Wait();
+
+    EXPECT_FALSE(graph.IsRunning());
+}
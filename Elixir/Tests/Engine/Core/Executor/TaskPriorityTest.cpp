@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/Parallel.h>
+using namespace Elixir;
+
+namespace
+{
+    // Blocks a worker until released, so the tasks enqueued meanwhile are all pending
+    struct SGate
+    {
+        std::atomic<bool> Entered = false;
+        std::atomic<bool> Released = false;
+
+        void Hold()
+        {
+            Entered = true;
+            while (!Released)
+                std::this_thread::yield();
+        }
+
+        void WaitEntered() const
+        {
+            while (!Entered)
+                std::this_thread::yield();
+        }
+    };
+}
+
+TEST(TaskPriorityTest, HigherPrioritiesRunFirst)
+{
+    ThreadPool pool(1, "Test");
+    WaitGroup wg;
+    SGate gate;
+
+    pool.Enqueue(ETaskPriority::FrameCritical, [&gate] { gate.Hold(); }, &wg);
+    gate.WaitEntered();
+
+    std::mutex mutex;
+    std::vector<ETaskPriority> order;
+    const auto record = [&mutex, &order](const ETaskPriority priority)
+    {
+        std::lock_guard lock(mutex);
+        order.push_back(priority);
+    };
+
+    for (int i = 0; i < 2; i++)
+    {
+        pool.Enqueue(ETaskPriority::Background, [&record] { record(ETaskPriority::Background); }, &wg);
+        pool.Enqueue(ETaskPriority::Normal, [&record] { record(ETaskPriority::Normal); }, &wg);
+        pool.Enqueue(ETaskPriority::FrameCritical, [&record] { record(ETaskPriority::FrameCritical); }, &wg);
+    }
+
+    gate.Released = true;
+    wg.Wait();
+
+    const std::vector expected = {
+        ETaskPriority::FrameCritical, ETaskPriority::FrameCritical,
+        ETaskPriority::Normal, ETaskPriority::Normal,
+        ETaskPriority::Background, ETaskPriority::Background
+    };
+    EXPECT_EQ(order, expected);
+}
+
+TEST(TaskPriorityTest, BackgroundWorkersAreCapped)
+{
+    ThreadPool pool(4, "Test");
+    pool.SetMaxBackgroundWorkers(2);
+    EXPECT_EQ(pool.GetMaxBackgroundWorkers(), 2u);
+
+    WaitGroup wg;
+    std::atomic<uint32_t> running = 0;
+    std::atomic<uint32_t> peak = 0;
+
+    for (int i = 0; i < 32; i++)
+    {
+        pool.Enqueue(ETaskPriority::Background, [&running, &peak]
+        {
+            const auto current = ++running;
+            auto previous = peak.load();
+            while (previous < current && !peak.compare_exchange_weak(previous, current)) {}
+
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            running--;
+        }, &wg);
+    }
+
+    wg.Wait();
+    EXPECT_LE(peak, 2u);
+    EXPECT_GE(peak, 1u);
+}
+
+TEST(TaskPriorityTest, CriticalTasksRunDuringBackgroundWork)
+{
+    ThreadPool pool(2, "Test");
+    pool.SetMaxBackgroundWorkers(1);
+
+    WaitGroup background;
+    SGate gate;
+    pool.Enqueue(ETaskPriority::Background, [&gate] { gate.Hold(); }, &background);
+    for (int i = 0; i < 8; i++)
+        pool.Enqueue(ETaskPriority::Background, [] {}, &background);
+
+    gate.WaitEntered();
+
+    // The background task holds its only slot, the other worker is free for the frame
+    WaitGroup frame;
+    std::atomic<int> done = 0;
+    for (int i = 0; i < 8; i++)
+        pool.Enqueue(ETaskPriority::FrameCritical, [&done] { done++; }, &frame);
+
+    EXPECT_TRUE(frame.WaitFor(std::chrono::seconds(10)));
+    EXPECT_EQ(done, 8);
+
+    gate.Released = true;
+    background.Wait();
+}
+
+TEST(TaskPriorityTest, CriticalTasksDoNotHelpWithBackgroundWork)
+{
+    ThreadPool pool(1, "Test");
+    WaitGroup wg;
+
+    std::atomic<bool> backgroundRan = false;
+    std::atomic<bool> ranWhileWaiting = false;
+
+    pool.Enqueue(ETaskPriority::FrameCritical, [&pool, &backgroundRan, &ranWhileWaiting]
+    {
+        WaitGroup children;
+        pool.Enqueue(ETaskPriority::Background, [&backgroundRan] { backgroundRan = true; });
+        pool.Enqueue(ETaskPriority::Normal, [] {}, &children);
+
+        // Helps with the normal task, the background one waits for the worker to be free
+        children.Wait();
+        ranWhileWaiting = backgroundRan.load();
+    }, &wg);
+
+    wg.Wait();
+    EXPECT_FALSE(ranWhileWaiting);
+
+    while (!backgroundRan)
+        std::this_thread::yield();
+}
+
+TEST(TaskPriorityTest, ParallelForInheritsThePriority)
+{
+    ThreadPool pool(2, "Test");
+    WaitGroup wg;
+
+    std::atomic<bool> inherited = true;
+    pool.Enqueue(ETaskPriority::FrameCritical, [&pool, &inherited]
+    {
+        ParallelFor(pool, 0, 64, 1, [&inherited](size_t)
+        {
+            if (Thread::GetCurrent()->GetPriority() != ETaskPriority::FrameCritical)
+                inherited = false;
+        });
+    }, &wg);
+
+    wg.Wait();
+    EXPECT_TRUE(inherited);
+}
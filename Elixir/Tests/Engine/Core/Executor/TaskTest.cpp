@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/Executor.h>
+#include <Engine/Core/Executor/Task.h>
+using namespace Elixir;
+
+namespace
+{
+    // Counts its live instances, to check that tasks destroy what they hold
+    struct SCounted
+    {
+        static inline int s_Alive = 0;
+
+        SCounted() { s_Alive++; }
+        SCounted(const SCounted&) { s_Alive++; }
+        SCounted(SCounted&&) noexcept { s_Alive++; }
+        ~SCounted() { s_Alive--; }
+    };
+}
+
+TEST(TaskTest, SmallCallablesAreStoredInline)
+{
+    int calls = 0;
+    Task task = [&calls] { calls++; };
+
+    EXPECT_TRUE(task.IsInline());
+    task();
+    task();
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(TaskTest, LargeCallablesAreStoredInTheArena)
+{
+    std::array<int, 64> values = {};
+    values[63] = 42;
+
+    int result = 0;
+    Task task = [values, &result] { result = values[63]; };
+
+    EXPECT_FALSE(task.IsInline());
+    task();
+    EXPECT_EQ(result, 42);
+}
+
+TEST(TaskTest, MoveTransfersTheCallable)
+{
+    int calls = 0;
+    Task task = [&calls] { calls++; };
+
+    Task moved = std::move(task);
+    EXPECT_FALSE(task);
+    ASSERT_TRUE(moved);
+
+    moved();
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(TaskTest, MoveOnlyCapturesAreSupported)
+{
+    auto value = CreateScope<int>(7);
+    int result = 0;
+
+    Task task = [value = std::move(value), &result] { result = *value; };
+    Task moved = std::move(task);
+    moved();
+
+    EXPECT_EQ(result, 7);
+}
+
+TEST(TaskTest, CapturesAreDestroyed)
+{
+    {
+        Task small = [counted = SCounted()] {};
+        Task large = [counted = SCounted(), padding = std::array<char, 128>()] {};
+        EXPECT_EQ(SCounted::s_Alive, 2);
+
+        Task moved = std::move(large);
+        EXPECT_EQ(SCounted::s_Alive, 2);
+
+        small = std::move(moved);
+        EXPECT_EQ(SCounted::s_Alive, 1);
+    }
+
+    EXPECT_EQ(SCounted::s_Alive, 0);
+}
+
+TEST(TaskTest, ArenaRecyclesBlocks)
+{
+    // Warm up the cache of this thread
+    for (int i = 0; i < 16; i++)
+        TaskArena::Delete(TaskArena::New<Task>([] {}));
+
+    const auto allocations = TaskArena::GetSystemAllocationCount();
+    for (int i = 0; i < 1000; i++)
+        TaskArena::Delete(TaskArena::New<Task>([] {}));
+
+    EXPECT_EQ(TaskArena::GetSystemAllocationCount(), allocations);
+}
+
+TEST(TaskTest, ExecutorEnqueueMovesTheCallable)
+{
+    auto value = std::make_unique<int>(42);
+    std::atomic<int> result = 0;
+
+    WaitGroup wg;
+    Executor::Get().Enqueue([value = std::move(value), &result] { result = *value; }, &wg);
+
+    wg.Wait();
+    EXPECT_EQ(result, 42);
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/ThreadPool.h>
+using namespace Elixir;
+
+#include <chrono>
+#include <algorithm>
+
+namespace
+{
+    constexpr size_t WORKERS = 4;
+
+    // Binary tree of tasks: each task spawns two children until the depth is reached,
+    // so almost every task is enqueued from a worker.
+    void Spawn(ThreadPool& pool, WaitGroup& wg, std::atomic<uint32_t>& leaves, const int depth)
+    {
+        if (depth == 0)
+        {
+            leaves.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            pool.Enqueue([&pool, &wg, &leaves, depth]
+            {
+                Spawn(pool, wg, leaves, depth - 1);
+            }, &wg);
+        }
+    }
+}
+
+namespace
+{
+    struct SLatency
+    {
+        int64_t P50;
+        int64_t P99;
+    };
+
+    // Time from Enqueue to the start of the task, with the workers idle between tasks
+    SLatency MeasureStartLatency(ThreadPool& pool, const std::chrono::microseconds interval)
+    {
+        constexpr int SAMPLES = 200;
+
+        std::vector<int64_t> latencies(SAMPLES);
+        for (int i = 0; i < SAMPLES; i++)
+        {
+            WaitGroup wg;
+            const auto submitted = std::chrono::steady_clock::now();
+            pool.Enqueue([&latencies, submitted, i]
+            {
+                const auto elapsed = std::chrono::steady_clock::now() - submitted;
+                latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+            }, &wg);
+
+            wg.Wait();
+            std::this_thread::sleep_for(interval);
+        }
+
+        std::ranges::sort(latencies);
+        return { latencies[SAMPLES / 2], latencies[SAMPLES * 99 / 100] };
+    }
+}
+
+TEST(ThreadPoolBenchmarkTest, ExternalTasksRunOnce)
+{
+    ThreadPool pool(WORKERS, "Test");
+    WaitGroup wg;
+
+    constexpr int TASKS = 1000;
+    std::vector<std::atomic<int>> runs(TASKS);
+    for (int i = 0; i < TASKS; i++)
+        pool.Enqueue([&runs, i] { runs[i]++; }, &wg);
+
+    wg.Wait();
+    for (int i = 0; i < TASKS; i++)
+        ASSERT_EQ(runs[i], 1);
+}
+
+TEST(ThreadPoolBenchmarkTest, SpawnedTasksAreStolenByIdleWorkers)
+{
+    ThreadPool pool(WORKERS, "Test");
+    WaitGroup wg;
+
+    // A single root task spawns the whole tree on one worker, the others can only get
+    // work by stealing
+    std::mutex mutex;
+    std::unordered_set<std::thread::id> threads;
+    std::atomic<uint32_t> leaves = 0;
+
+    pool.Enqueue([&]
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            pool.Enqueue([&]
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+                leaves++;
+            }, &wg);
+        }
+    }, &wg);
+
+    wg.Wait();
+    EXPECT_EQ(leaves, 256u);
+    EXPECT_GT(threads.size(), 1u);
+}
+
+TEST(ThreadPoolBenchmarkTest, FineGrainedTaskTree)
+{
+    constexpr int DEPTH = 16;
+
+    ThreadPool pool(WORKERS, "Test");
+    WaitGroup wg;
+    std::atomic<uint32_t> leaves = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    pool.Enqueue([&] { Spawn(pool, wg, leaves, DEPTH); }, &wg);
+    wg.Wait();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto tasks = (1u << (DEPTH + 1)) - 1;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    RecordProperty("Tasks", std::to_string(tasks));
+    RecordProperty("NanosecondsPerTask", std::to_string(ns / tasks));
+
+    EXPECT_EQ(leaves, 1u << DEPTH);
+}
+
+TEST(ThreadPoolBenchmarkTest, MicroTasksDoNotAllocate)
+{
+    constexpr uint32_t TASKS = 100000;
+
+    ThreadPool pool(WORKERS, "Test");
+    std::atomic<uint32_t> runs = 0;
+
+    const auto submit = [&]
+    {
+        WaitGroup wg;
+        for (uint32_t i = 0; i < TASKS; i++)
+            pool.Enqueue([&runs] { runs.fetch_add(1, std::memory_order_relaxed); }, &wg);
+        wg.Wait();
+    };
+
+    // Fill the arena with every task queued at once, while the workers are held back, so
+    // that later rounds never have more tasks alive
+    {
+        std::atomic<bool> release = false;
+        WaitGroup gate;
+        for (size_t i = 0; i < WORKERS; i++)
+        {
+            pool.Enqueue([&release]
+            {
+                while (!release)
+                    std::this_thread::yield();
+            }, &gate);
+        }
+
+        WaitGroup wg;
+        for (uint32_t i = 0; i < TASKS; i++)
+            pool.Enqueue([&runs] { runs.fetch_add(1, std::memory_order_relaxed); }, &wg);
+
+        release = true;
+        gate.Wait();
+        wg.Wait();
+    }
+
+    const auto allocations = TaskArena::GetSystemAllocationCount();
+
+    const auto start = std::chrono::steady_clock::now();
+    submit();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    RecordProperty("NanosecondsPerTask", std::to_string(ns / TASKS));
+    RecordProperty("SystemAllocations", std::to_string(TaskArena::GetSystemAllocationCount() - allocations));
+
+    EXPECT_EQ(runs, 2 * TASKS);
+
+    // Only the blocks still cached by the workers cannot be reused by the submitting thread
+    EXPECT_LT(TaskArena::GetSystemAllocationCount() - allocations, TASKS / 100);
+}
+
+TEST(ThreadPoolBenchmarkTest, ParkedWorkersWakeForNewTasks)
+{
+    ThreadPool pool(WORKERS, "Test");
+    pool.SetSpinBudget(0);
+
+    // Every task is enqueued once the workers went back to sleep
+    for (int i = 0; i < 20; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+        WaitGroup wg;
+        std::atomic<bool> ran = false;
+        pool.Enqueue([&ran] { ran = true; }, &wg);
+
+        wg.Wait();
+        ASSERT_TRUE(ran);
+    }
+}
+
+// Timings are too noisy on shared machines for the unit run, run it with
+// --gtest_also_run_disabled_tests --gtest_filter=ThreadPoolBenchmarkTest.*
+TEST(ThreadPoolBenchmarkTest, DISABLED_StartLatency)
+{
+    ThreadPool pool(WORKERS, "Test");
+
+    // Tasks enqueued shortly after the previous one find a spinning worker
+    const auto spinning = MeasureStartLatency(pool, std::chrono::microseconds(0));
+    RecordProperty("SpinningP50Nanoseconds", std::to_string(spinning.P50));
+    RecordProperty("SpinningP99Nanoseconds", std::to_string(spinning.P99));
+
+    // The others wake a parked worker
+    pool.SetSpinBudget(0);
+    const auto parked = MeasureStartLatency(pool, std::chrono::microseconds(200));
+    RecordProperty("ParkedP50Nanoseconds", std::to_string(parked.P50));
+    RecordProperty("ParkedP99Nanoseconds", std::to_string(parked.P99));
+
+    // Well below the 10 ms of the former polling wait
+    EXPECT_LT(spinning.P50, 1'000'000);
+    EXPECT_LT(parked.P50, 1'000'000);
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/ThreadPool.h>
+using namespace Elixir;
+
+class WaitGroupTest : public Test
+{
+  protected:
+    static constexpr size_t WORKERS = 4;
+    ThreadPool Pool { WORKERS, "Test" };
+};
+
+TEST_F(WaitGroupTest, EmptyGroupDoesNotWait)
+{
+    WaitGroup wg;
+    wg.Wait();
+
+    EXPECT_EQ(wg.GetCount(), 0);
+    EXPECT_TRUE(wg.WaitFor(std::chrono::milliseconds(0)));
+}
+
+TEST_F(WaitGroupTest, WaitsForEveryTask)
+{
+    WaitGroup wg;
+    std::atomic<int> done = 0;
+
+    for (int i = 0; i < 100; i++)
+    {
+        Pool.Enqueue([&done]
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            done++;
+        }, &wg);
+    }
+
+    wg.Wait();
+    EXPECT_EQ(done, 100);
+    EXPECT_EQ(wg.GetCount(), 0);
+}
+
+TEST_F(WaitGroupTest, WaitForTimesOut)
+{
+    WaitGroup wg;
+    std::atomic<bool> release = false;
+
+    Pool.Enqueue([&release]
+    {
+        while (!release)
+            std::this_thread::yield();
+    }, &wg);
+
+    EXPECT_FALSE(wg.WaitFor(std::chrono::milliseconds(10)));
+    EXPECT_EQ(wg.GetCount(), 1);
+
+    release = true;
+    EXPECT_TRUE(wg.WaitFor(std::chrono::seconds(10)));
+}
+
+TEST_F(WaitGroupTest, WorkersWaitingOnChildrenDoNotDeadlock)
+{
+    // More parents than workers: with blocking waits every worker would wait on children
+    // that no worker is left to run
+    constexpr int PARENTS = WORKERS * 4;
+    constexpr int CHILDREN = 32;
+
+    WaitGroup parents;
+    std::atomic<int> children = 0;
+
+    for (int i = 0; i < PARENTS; i++)
+    {
+        Pool.Enqueue([this, &children]
+        {
+            WaitGroup wg;
+            for (int j = 0; j < CHILDREN; j++)
+                Pool.Enqueue([&children] { children++; }, &wg);
+
+            wg.Wait();
+        }, &parents);
+    }
+
+    parents.Wait();
+    EXPECT_EQ(children, PARENTS * CHILDREN);
+}
+
+TEST_F(WaitGroupTest, GroupCanBeDestroyedRightAfterWait)
+{
+    // The last Done call must not touch the group once the waiter can return
+    for (int i = 0; i < 1000; i++)
+    {
+        const auto wg = CreateScope<WaitGroup>();
+        Pool.Enqueue([] {}, wg.get());
+        wg->Wait();
+    }
+}
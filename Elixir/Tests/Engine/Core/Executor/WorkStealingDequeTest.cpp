@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/Executor/WorkStealingDeque.h>
+using namespace Elixir;
+
+#include <thread>
+
+TEST(WorkStealingDequeTest, OwnerPopsLIFO)
+{
+    WorkStealingDeque<int> deque;
+    deque.Push(1);
+    deque.Push(2);
+    deque.Push(3);
+
+    EXPECT_EQ(deque.Pop(), 3);
+    EXPECT_EQ(deque.Pop(), 2);
+    EXPECT_EQ(deque.Pop(), 1);
+    EXPECT_EQ(deque.Pop(), std::nullopt);
+}
+
+TEST(WorkStealingDequeTest, ThievesStealFIFO)
+{
+    WorkStealingDeque<int> deque;
+    deque.Push(1);
+    deque.Push(2);
+    deque.Push(3);
+
+    EXPECT_EQ(deque.Steal(), 1);
+    EXPECT_EQ(deque.Pop(), 3);
+    EXPECT_EQ(deque.Steal(), 2);
+    EXPECT_EQ(deque.Steal(), std::nullopt);
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(WorkStealingDequeTest, GrowsWhenFull)
+{
+    WorkStealingDeque<int> deque(4);
+    for (int i = 0; i < 100; i++)
+        deque.Push(i);
+
+    EXPECT_GE(deque.GetCapacity(), 100u);
+    EXPECT_EQ(deque.GetSizeApprox(), 100u);
+    EXPECT_EQ(deque.Steal(), 0);
+
+    for (int i = 99; i > 0; i--)
+        EXPECT_EQ(deque.Pop(), i);
+}
+
+TEST(WorkStealingDequeTest, EveryItemIsTakenOnceUnderContention)
+{
+    constexpr int ITEMS = 100000;
+    constexpr int THIEVES = 3;
+
+    WorkStealingDeque<int> deque(64);
+    std::vector<std::atomic<int>> taken(ITEMS);
+    std::atomic<bool> done = false;
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < THIEVES; i++)
+    {
+        thieves.emplace_back([&]
+        {
+            while (!done || !deque.IsEmpty())
+            {
+                if (const auto item = deque.Steal())
+                    taken[*item]++;
+            }
+        });
+    }
+
+    // The owner interleaves pushes and pops, racing the thieves for the last items
+    for (int i = 0; i < ITEMS; i++)
+    {
+        deque.Push(i);
+        if (i % 3 == 0)
+        {
+            if (const auto item = deque.Pop())
+                taken[*item]++;
+        }
+    }
+
+    while (const auto item = deque.Pop())
+        taken[*item]++;
+
+    done = true;
+    for (auto& thief : thieves)
+        thief.join();
+
+    for (int i = 0; i < ITEMS; i++)
+        ASSERT_EQ(taken[i], 1) << "Item " << i;
+}
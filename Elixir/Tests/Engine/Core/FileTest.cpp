@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/File.h>
+#include <Engine/Core/Executor/Executor.h>
+using namespace Elixir;
+
+#include <fstream>
+
+namespace
+{
+    std::filesystem::path WriteTempFile(const std::string& name, const std::string& contents)
+    {
+        auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+    std::string ToString(const std::vector<Byte>& data)
+    {
+        return { (const char*)data.data(), data.size() };
+    }
+}
+
+TEST(FileTest, LoadsWholeFile)
+{
+    const auto path = WriteTempFile("ElixirFileTest.bin", std::string("Elixir\0File", 11));
+
+    const auto data = LoadFile(path);
+    ASSERT_TRUE(data);
+    EXPECT_EQ(ToString(*data), std::string("Elixir\0File", 11));
+
+    std::filesystem::remove(path);
+}
+
+TEST(FileTest, MissingFileIsNotLoaded)
+{
+    EXPECT_FALSE(LoadFile("Missing/File.bin"));
+    EXPECT_FALSE(LoadFileAsync("Missing/File.bin").Get());
+}
+
+TEST(FileTest, LoadsAsyncAndContinuesOnAWorker)
+{
+    const auto path = WriteTempFile("ElixirFileAsyncTest.bin", "Async");
+
+    auto load = [](const std::filesystem::path path) -> Async<std::string>
+    {
+        const auto data = co_await LoadFileAsync(path);
+
+        const auto worker = Thread::GetCurrent();
+        if (!data || !worker || worker->GetPool() != &Executor::Get().GetWorkerPool())
+            co_return "";
+
+        co_return ToString(*data);
+    };
+
+    EXPECT_EQ(load(path).Get(), "Async");
+
+    std::filesystem::remove(path);
+}
+
+TEST(FileTest, WritesFileAtomically)
+{
+    const auto path = std::filesystem::temp_directory_path() / "ElixirFileTest" / "Atomic.bin";
+    std::filesystem::remove_all(path.parent_path());
+
+    const std::string first = "First";
+    ASSERT_TRUE(WriteFileAtomic(path, std::as_bytes(std::span(first))));
+    EXPECT_EQ(ToString(*LoadFile(path)), "First");
+
+    // Replaces the existing file, without leaving the temporary one behind
+    const std::string second = std::string("Second\0File", 11);
+    ASSERT_TRUE(WriteFileAtomic(path, std::as_bytes(std::span(second))));
+    EXPECT_EQ(ToString(*LoadFile(path)), second);
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(path.parent_path()), {}), 1);
+
+    std::filesystem::remove_all(path.parent_path());
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/FrameArena.h>
+using namespace Elixir;
+
+#include <thread>
+
+class FrameArenaTest : public Test
+{
+  protected:
+    static constexpr uint32_t FRAMES = 2;
+    static constexpr size_t BLOCK_SIZE = 4096;
+    FrameArena Arena { FRAMES, BLOCK_SIZE };
+};
+
+TEST_F(FrameArenaTest, AllocBumpsAligned)
+{
+    const auto a = Arena.Alloc(3, 1);
+    const auto b = Arena.Alloc(8, 8);
+    const auto c = Arena.Alloc(16, 64);
+
+    EXPECT_EQ(b, a + 8);
+    EXPECT_EQ((uintptr_t)b % 8, 0u);
+    EXPECT_EQ((uintptr_t)c % 64, 0u);
+    EXPECT_GE(Arena.GetUsedSize(), 3u + 8u + 16u);
+}
+
+TEST_F(FrameArenaTest, BeginFrameResetsOnlyThatFrame)
+{
+    Arena.BeginFrame(0);
+    const auto first = Arena.Alloc(64);
+    std::memset(first, 0xAB, 64);
+
+    // The other frame does not touch the data of frame 0
+    Arena.BeginFrame(1);
+    EXPECT_EQ(Arena.GetFrameIndex(), 1u);
+    const auto second = Arena.Alloc(64);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(first[63], (Byte)0xAB);
+
+    // Coming back to frame 0 reuses its memory from the start
+    Arena.BeginFrame(0);
+    EXPECT_EQ(Arena.GetUsedSize(), 0u);
+    EXPECT_EQ(Arena.Alloc(64), first);
+}
+
+TEST_F(FrameArenaTest, GrowsThenMergesBlocksOnReset)
+{
+    Arena.BeginFrame(0);
+    const auto reserved = Arena.GetReservedSize();
+
+    // Outgrow the block, and allocate more than a block at once
+    for (int i = 0; i < 8; i++)
+        EXPECT_NE(Arena.Alloc(1024), nullptr);
+    EXPECT_NE(Arena.Alloc(3 * BLOCK_SIZE), nullptr);
+
+    const auto grown = Arena.GetReservedSize();
+    EXPECT_GT(grown, reserved);
+
+    // The blocks merge into one, so the same frame now fits without growing
+    Arena.BeginFrame(1);
+    Arena.BeginFrame(0);
+    EXPECT_EQ(Arena.GetReservedSize(), grown);
+
+    const auto first = Arena.Alloc(1024);
+    for (int i = 1; i < 8; i++)
+        EXPECT_EQ(Arena.Alloc(1024), first + i * 1024);
+    EXPECT_NE(Arena.Alloc(3 * BLOCK_SIZE), nullptr);
+
+    EXPECT_EQ(Arena.GetReservedSize(), grown);
+}
+
+TEST_F(FrameArenaTest, ConcurrentAllocationsDoNotOverlap)
+{
+    constexpr size_t THREADS = 4;
+    constexpr size_t ALLOCATIONS = 2000;
+
+    std::vector<std::vector<Byte*>> allocations(THREADS);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < THREADS; t++)
+    {
+        threads.emplace_back([this, &allocations, t]
+        {
+            for (size_t i = 0; i < ALLOCATIONS; i++)
+            {
+                const auto ptr = Arena.Alloc(24, 8);
+                std::memset(ptr, (int)t, 24);
+                allocations[t].push_back(ptr);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<Byte*> all;
+    for (size_t t = 0; t < THREADS; t++)
+    {
+        for (const auto ptr : allocations[t])
+        {
+            EXPECT_EQ(ptr[0], (Byte)t);
+            EXPECT_EQ(ptr[23], (Byte)t);
+            all.push_back(ptr);
+        }
+    }
+
+    std::ranges::sort(all);
+    for (size_t i = 1; i < all.size(); i++)
+        EXPECT_GE(all[i], all[i - 1] + 24);
+
+    EXPECT_EQ(Arena.GetUsedSize(), THREADS * ALLOCATIONS * 24);
+}
+
+TEST_F(FrameArenaTest, FrameVectorAllocatesFromTheArena)
+{
+    Arena.BeginFrame(0);
+
+    FrameVector<std::string> strings((FrameAllocator<std::string>(Arena)));
+    strings.reserve(4);
+    const auto used = Arena.GetUsedSize();
+    EXPECT_GE(used, 4 * sizeof(std::string));
+
+    for (int i = 0; i < 100; i++)
+        strings.push_back(std::to_string(i));
+
+    EXPECT_EQ(strings.size(), 100u);
+    EXPECT_EQ(strings[42], "42");
+    EXPECT_GT(Arena.GetUsedSize(), used);
+
+    // Rebinds to the arena, e.g. for node based containers
+    const FrameAllocator<int> ints(strings.get_allocator());
+    EXPECT_EQ(ints.GetArena(), &Arena);
+    EXPECT_TRUE(ints == strings.get_allocator());
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/CachedMalloc.h>
+using namespace Elixir;
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <thread>
+
+namespace
+{
+    constexpr size_t THREADS = 4;
+
+    /**
+     * Every thread allocates blocks of mostly small sizes, like push constants and staging
+     * data, and swaps them into slots shared by all the threads. The block taken out of a
+     * slot is freed, so most blocks are freed by another thread than their allocator.
+     * Blocks start with their size and are filled with it, so overlapping blocks are caught.
+     * @param intact Cleared if a block freed no longer holds what was written to it.
+     * @return The nanoseconds per allocation and free.
+     */
+    int64_t MeasureChurn(Malloc& malloc, const size_t operations, std::atomic<bool>& intact)
+    {
+        std::vector<std::atomic<Byte*>> slots(THREADS * 256);
+        std::atomic<bool> start = false;
+
+        const auto check = [&intact](const Byte* block)
+        {
+            size_t size;
+            std::memcpy(&size, block, sizeof(size));
+
+            for (size_t i = sizeof(size); i < size; i++)
+            {
+                if (block[i] != (Byte)size)
+                {
+                    intact = false;
+                    return;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; t++)
+        {
+            threads.emplace_back([&malloc, &slots, &start, &check, operations, t]
+            {
+                std::mt19937 random((uint32_t)t);
+                std::uniform_int_distribution<size_t> slot(0, slots.size() - 1);
+
+                // Mostly small sizes, some up to a few KiB
+                std::geometric_distribution<size_t> size(1.0 / 128.0);
+
+                while (!start)
+                    std::this_thread::yield();
+
+                for (size_t i = 0; i < operations; i++)
+                {
+                    const size_t requested = 8 + size(random) % 4096;
+                    auto [ptr, allocatedSize] = malloc.Alloc(requested);
+                    std::memcpy(ptr, &requested, sizeof(requested));
+                    std::memset(ptr + sizeof(requested), (int)(uint8_t)requested, requested - sizeof(requested));
+
+                    const auto previous = slots[slot(random)].exchange(ptr, std::memory_order_acq_rel);
+                    if (previous)
+                    {
+                        check(previous);
+                        malloc.Free(previous);
+                    }
+                }
+            });
+        }
+
+        const auto begin = std::chrono::steady_clock::now();
+        start = true;
+        for (auto& thread : threads)
+            thread.join();
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+        for (auto& slot : slots)
+        {
+            if (const auto block = slot.load())
+            {
+                check(block);
+                malloc.Free(block);
+            }
+        }
+
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        return ns / (int64_t)(THREADS * operations);
+    }
+}
+
+TEST(MallocBenchmarkTest, MultithreadedChurnKeepsBlocksIntact)
+{
+    CachedMalloc cached;
+    std::atomic<bool> intact = true;
+
+    MeasureChurn(cached, 10000, intact);
+    EXPECT_TRUE(intact);
+}
+
+// Timings are too noisy on shared machines for the unit run, run it with
+// --gtest_also_run_disabled_tests --gtest_filter=MallocBenchmarkTest.*
+TEST(MallocBenchmarkTest, DISABLED_MultithreadedChurn)
+{
+    constexpr size_t OPERATIONS = 200000;
+
+    SystemMalloc system;
+    CachedMalloc cached;
+    std::atomic<bool> intact = true;
+
+    // Warm both up, so the measure does not include reserving the spans
+    MeasureChurn(system, OPERATIONS, intact);
+    MeasureChurn(cached, OPERATIONS, intact);
+
+    const auto systemNs = MeasureChurn(system, OPERATIONS, intact);
+    const auto cachedNs = MeasureChurn(cached, OPERATIONS, intact);
+
+    RecordProperty("SystemMallocNanoseconds", std::to_string(systemNs));
+    RecordProperty("CachedMallocNanoseconds", std::to_string(cachedNs));
+    RecordProperty("CachedMallocReservedBytes", std::to_string(cached.GetReservedSize()));
+
+    EXPECT_TRUE(intact);
+    EXPECT_LT(cachedNs, 2 * systemNs + 1000);
+}
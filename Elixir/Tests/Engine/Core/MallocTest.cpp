@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
-#include <Engine/Core/Malloc.h>
+#include <Engine/Core/CachedMalloc.h>
 using namespace Elixir;
 
+#include <thread>
+#include <unordered_set>
+
 TEST(MallocTest, GetAlignmentReturnsExpectedValues)
 {
     EXPECT_EQ(Malloc::GetAlignment(10, 0),  8u);   // size < 16
@@ -117,4 +120,236 @@ TEST_F(SystemMallocTest, ReallocWithZeroSizeFreesMemory)
 TEST_F(SystemMallocTest, FreeAcceptsNullptr)
 {
     EXPECT_NO_THROW(Malloc.Free(nullptr));
-}
\ No newline at end of file
+}
+
+class CachedMallocTest : public ::testing::Test
+{
+  protected:
+    CachedMalloc Malloc;
+};
+
+TEST_F(CachedMallocTest, AllocReturnsNonNull)
+{
+    auto [ptr, size] = Malloc.Alloc(64);
+
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_EQ(size, 64u);
+
+    Malloc.Free(ptr);
+}
+
+TEST_F(CachedMallocTest, AllocPadsLikeSystemMalloc)
+{
+    // Callers only get the size they asked for, padded to the alignment, not the block size
+    auto [ptr1, allocatedSize1] = Malloc.Alloc(10, 0);
+    EXPECT_EQ(allocatedSize1, 16u);
+
+    auto [ptr2, allocatedSize2] = Malloc.Alloc(100, 0);
+    EXPECT_EQ(allocatedSize2, 112u);
+
+    auto [ptr3, allocatedSize3] = Malloc.Alloc(5000, 0);
+    EXPECT_EQ(allocatedSize3, 5008u);
+
+    Malloc.Free(ptr1);
+    Malloc.Free(ptr2);
+    Malloc.Free(ptr3);
+}
+
+TEST_F(CachedMallocTest, AllocReturnsAlignedPointer)
+{
+    for (const size_t size : { 8, 24, 100, 1000, 2048, 4096, 100000 })
+    {
+        for (uint32_t alignment = 8; alignment <= 4096; alignment *= 2)
+        {
+            auto [ptr, allocatedSize] = Malloc.Alloc(size, alignment);
+
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_EQ(allocatedSize, Malloc::AlignSize(size, alignment));
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u) << "Size " << size << ", alignment " << alignment;
+
+            memset(ptr, 0xCD, allocatedSize);
+            Malloc.Free(ptr);
+        }
+    }
+}
+
+TEST_F(CachedMallocTest, FreedBlocksAreReused)
+{
+    auto [ptr, size] = Malloc.Alloc(48);
+    Malloc.Free(ptr);
+
+    auto [reused, reusedSize] = Malloc.Alloc(40);
+    EXPECT_EQ(reused, ptr);
+
+    Malloc.Free(reused);
+}
+
+TEST_F(CachedMallocTest, LiveBlocksDoNotOverlap)
+{
+    std::vector<std::tuple<Byte*, size_t>> allocations;
+    for (size_t i = 0; i < 10000; i++)
+    {
+        const auto [ptr, size] = Malloc.Alloc(1 + i % 3000);
+        memset(ptr, (int)(i & 0xFF), size);
+        allocations.emplace_back(ptr, size);
+    }
+
+    for (size_t i = 0; i < allocations.size(); i++)
+    {
+        const auto [ptr, size] = allocations[i];
+        for (size_t j = 0; j < size; j++)
+            ASSERT_EQ(ptr[j], (Byte)(i & 0xFF));
+
+        Malloc.Free(ptr);
+    }
+}
+
+TEST_F(CachedMallocTest, AllocZeroedReturnsZeroedMemory)
+{
+    // Dirty a block first, so that the zeroed allocation reuses it
+    auto [dirty, dirtySize] = Malloc.Alloc(32);
+    memset(dirty, 0xCD, dirtySize);
+    Malloc.Free(dirty);
+
+    auto [ptr, size] = Malloc.AllocZeroed(32);
+    ASSERT_EQ(ptr, dirty);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(ptr[i], (Byte)0) << "Byte at index " << i << " not zeroed";
+    }
+
+    Malloc.Free(ptr);
+}
+
+TEST_F(CachedMallocTest, ReallocPreservesDataAcrossSizeClasses)
+{
+    auto [ptr, size] = Malloc.Alloc(64);
+    memset(ptr, 0xCD, size);
+
+    // To a larger class, then to a large allocation, then back to a small one
+    for (const size_t newSize : { 496, 100000, 32 })
+    {
+        auto [newPtr, allocatedSize] = Malloc.Realloc(ptr, newSize);
+        ASSERT_NE(newPtr, nullptr);
+        ASSERT_EQ(allocatedSize, newSize);
+
+        for (size_t i = 0; i < std::min<size_t>(size, newSize); ++i)
+            ASSERT_EQ(newPtr[i], (Byte)0xCD) << "Byte at index " << i << " not preserved after realloc";
+
+        ptr = newPtr;
+    }
+
+    Malloc.Free(ptr);
+}
+
+TEST_F(CachedMallocTest, ReallocWithinTheBlockStaysInPlace)
+{
+    auto [ptr, size] = Malloc.Alloc(130);
+
+    auto [grown, grownSize] = Malloc.Realloc(ptr, 150);
+    EXPECT_EQ(grown, ptr);
+    EXPECT_EQ(grownSize, 160u);
+
+    auto [large, largeSize] = Malloc.Alloc(10000);
+    auto [shrunk, shrunkSize] = Malloc.Realloc(large, 9000);
+    EXPECT_EQ(shrunk, large);
+
+    Malloc.Free(grown);
+    Malloc.Free(shrunk);
+}
+
+TEST_F(CachedMallocTest, ReallocWithNullptrBehavesLikeAlloc)
+{
+    auto [ptr, size] = Malloc.Realloc(nullptr, 48);
+
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_EQ(size, 48u);
+
+    Malloc.Free(ptr);
+}
+
+TEST_F(CachedMallocTest, ReallocWithZeroSizeFreesMemory)
+{
+    auto [ptr, size] = Malloc.Alloc(32);
+    EXPECT_NE(ptr, nullptr);
+
+    auto [newPtr, newSize] = Malloc.Realloc(ptr, 0);
+    EXPECT_EQ(newPtr, nullptr);
+    EXPECT_EQ(newSize, 0u);
+}
+
+TEST_F(CachedMallocTest, FreeAcceptsNullptr)
+{
+    EXPECT_NO_THROW(Malloc.Free(nullptr));
+}
+
+TEST_F(CachedMallocTest, LargeAllocationsAreReturnedToTheSystem)
+{
+    const auto reserved = Malloc.GetReservedSize();
+
+    auto [ptr, size] = Malloc.Alloc(1024 * 1024);
+    EXPECT_GT(Malloc.GetReservedSize(), reserved + size);
+
+    Malloc.Free(ptr);
+    EXPECT_EQ(Malloc.GetReservedSize(), reserved);
+}
+
+TEST_F(CachedMallocTest, BlocksFreedOnExitedThreadsAreReused)
+{
+    constexpr size_t BLOCKS = 4 * CachedMalloc::BATCH_SIZE;
+
+    std::vector<Byte*> blocks;
+    std::thread([&]
+    {
+        for (size_t i = 0; i < BLOCKS; i++)
+            blocks.push_back(std::get<0>(Malloc.Alloc(64)));
+
+        // The thread keeps some of them in its cache until it exits
+        for (const auto block : blocks)
+            Malloc.Free(block);
+    }).join();
+
+    const auto reserved = Malloc.GetReservedSize();
+
+    std::unordered_set<Byte*> freed(blocks.begin(), blocks.end());
+    for (size_t i = 0; i < BLOCKS; i++)
+    {
+        const auto [ptr, size] = Malloc.Alloc(64);
+        EXPECT_TRUE(freed.erase(ptr)) << "Block " << i << " was not freed by the thread";
+    }
+
+    EXPECT_EQ(Malloc.GetReservedSize(), reserved);
+}
+
+TEST_F(CachedMallocTest, BlocksCanBeFreedOnAnotherThread)
+{
+    constexpr size_t THREADS = 4;
+    constexpr size_t ROUNDS = 20000;
+
+    // Each thread frees the blocks allocated by the previous one
+    std::vector<std::atomic<Byte*>> slots(THREADS * 64);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; t++)
+    {
+        threads.emplace_back([&, t]
+        {
+            for (size_t i = 0; i < ROUNDS; i++)
+            {
+                const auto size = 16 + (i * 7 + t * 13) % 512;
+                auto [ptr, allocatedSize] = Malloc.Alloc(size);
+                memset(ptr, (int)t, allocatedSize);
+
+                const auto previous = slots[(i * 31 + t) % slots.size()].exchange(ptr);
+                if (previous) Malloc.Free(previous);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& slot : slots)
+        Malloc.Free(slot.load());
+}
+
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 using namespace testing;
 
+#include <Engine/Core/CachedMalloc.h>
 #include <Engine/Core/Memory.h>
+#include <Engine/Core/TrackingMalloc.h>
 using namespace Elixir;
 
 #include "MockMalloc.h"
@@ -12,15 +14,17 @@ class MemoryTest : public Test
     void SetUp() override
     {
         MockedMalloc = new MockMalloc();
+        PreviousMalloc = std::move(Memory::s_Malloc);
         Memory::s_Malloc = Scope<Malloc>(MockedMalloc);
     }
 
     void TearDown() override
     {
-        Memory::s_Malloc.reset();
+        Memory::s_Malloc = std::move(PreviousMalloc);
     }
 
     MockMalloc* MockedMalloc = nullptr;
+    Scope<Malloc> PreviousMalloc;
 };
 
 TEST_F(MemoryTest, AllocDelegatesToMalloc)
@@ -86,4 +90,35 @@ TEST_F(MemoryTest, MemzeroSetsAllBytesToZero)
     Memory::Memzero(data, 16);
     for (int i = 0; i < 16; ++i)
         EXPECT_EQ(data[i], 0);
-}
\ No newline at end of file
+}
+
+TEST(MemoryMallocTest, DefaultMallocIsSelectedAtStartup)
+{
+    const auto tracking = dynamic_cast<TrackingMalloc*>(Memory::s_Malloc.get());
+    ASSERT_NE(tracking, nullptr);
+
+#ifdef EE_SYSTEM_MALLOC
+    EXPECT_NE(dynamic_cast<SystemMalloc*>(tracking->GetInner()), nullptr);
+#else
+    EXPECT_NE(dynamic_cast<CachedMalloc*>(tracking->GetInner()), nullptr);
+#endif
+}
+
+TEST(MemoryMallocTest, AllocReallocAndFreeRoundTrip)
+{
+    auto [ptr, size] = Memory::AllocZeroed(40);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(size, 48u);
+
+    Memory::Memset(ptr, 0xAB, size);
+
+    auto [newPtr, newSize] = Memory::Realloc(ptr, 4000);
+    ASSERT_NE(newPtr, nullptr);
+    EXPECT_EQ(newSize, 4000u);
+
+    for (size_t i = 0; i < size; ++i)
+        EXPECT_EQ(newPtr[i], (Byte)0xAB) << "Byte " << i << " was not preserved.";
+
+    Memory::Free(newPtr);
+}
+
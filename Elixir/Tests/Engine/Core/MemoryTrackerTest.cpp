@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Core/MemoryTracker.h>
+#include <Engine/Core/TrackingMalloc.h>
+using namespace Elixir;
+
+#include <thread>
+
+class MemoryTrackerTest : public Test
+{
+  protected:
+    void TearDown() override
+    {
+        MemoryTracker::SetBudget(EMemoryTag::Aether, 0);
+        MemoryTracker::Update(Timestep(MemoryTracker::RATE_WINDOW));
+    }
+
+    TrackingMalloc Tracking { CreateScope<SystemMalloc>() };
+};
+
+TEST_F(MemoryTrackerTest, AccountsToTheCurrentTag)
+{
+    const auto before = MemoryTracker::GetStats(EMemoryTag::Aether);
+
+    Byte* ptr;
+    size_t size;
+    {
+        MemoryTagScope tag(EMemoryTag::Aether);
+        EXPECT_EQ(MemoryTracker::GetCurrentTag(), EMemoryTag::Aether);
+
+        std::tie(ptr, size) = Tracking.Alloc(100);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_GE(size, 100u);
+    }
+    EXPECT_EQ(MemoryTracker::GetCurrentTag(), EMemoryTag::General);
+
+    const auto allocated = MemoryTracker::GetStats(EMemoryTag::Aether);
+    EXPECT_EQ(allocated.LiveBytes, before.LiveBytes + size);
+    EXPECT_EQ(allocated.AllocationCount, before.AllocationCount + 1);
+    EXPECT_GE(allocated.PeakBytes, allocated.LiveBytes);
+
+    // Freed from its tag, whatever the thread and its current tag
+    std::thread([this, ptr] { Tracking.Free(ptr); }).join();
+    EXPECT_EQ(MemoryTracker::GetStats(EMemoryTag::Aether).LiveBytes, before.LiveBytes);
+}
+
+TEST_F(MemoryTrackerTest, KeepsAlignmentAndDataOnRealloc)
+{
+    MemoryTagScope tag(EMemoryTag::Aether);
+    const auto before = MemoryTracker::GetStats(EMemoryTag::Aether).LiveBytes;
+
+    auto [ptr, size] = Tracking.Alloc(48, 64);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ((uintptr_t)ptr % 64, 0u);
+    std::memset(ptr, 0xAB, size);
+
+    auto [grown, grownSize] = Tracking.Realloc(ptr, 4000, 64);
+    ASSERT_NE(grown, nullptr);
+    EXPECT_EQ((uintptr_t)grown % 64, 0u);
+    EXPECT_GE(grownSize, 4000u);
+    EXPECT_EQ(grown[size - 1], (Byte)0xAB);
+    EXPECT_EQ(MemoryTracker::GetStats(EMemoryTag::Aether).LiveBytes, before + grownSize);
+
+    // Another alignment takes another header offset
+    auto [moved, movedSize] = Tracking.Realloc(grown, 4000, 256);
+    ASSERT_NE(moved, nullptr);
+    EXPECT_EQ((uintptr_t)moved % 256, 0u);
+    EXPECT_EQ(moved[size - 1], (Byte)0xAB);
+    EXPECT_EQ(MemoryTracker::GetStats(EMemoryTag::Aether).LiveBytes, before + movedSize);
+
+    Tracking.Free(moved);
+    EXPECT_EQ(MemoryTracker::GetStats(EMemoryTag::Aether).LiveBytes, before);
+}
+
+TEST_F(MemoryTrackerTest, FlagsBudgetOverrunsUntilBackUnder)
+{
+    MemoryTagScope tag(EMemoryTag::Aether);
+
+    const auto live = MemoryTracker::GetStats(EMemoryTag::Aether).LiveBytes;
+    MemoryTracker::SetBudget(EMemoryTag::Aether, live + 1024);
+
+    auto [small, smallSize] = Tracking.Alloc(512);
+    EXPECT_FALSE(MemoryTracker::GetStats(EMemoryTag::Aether).OverBudget);
+
+    // A spike stays flagged until the next update, even when freed before
+    auto [large, largeSize] = Tracking.Alloc(4096);
+    Tracking.Free(large);
+
+    const auto stats = MemoryTracker::GetStats(EMemoryTag::Aether);
+    EXPECT_TRUE(stats.OverBudget);
+    EXPECT_EQ(stats.Budget, live + 1024);
+    EXPECT_GE(stats.PeakBytes, live + smallSize + largeSize);
+
+    MemoryTracker::Update(Timestep(MemoryTracker::RATE_WINDOW));
+    EXPECT_FALSE(MemoryTracker::GetStats(EMemoryTag::Aether).OverBudget);
+
+    Tracking.Free(small);
+}
+
+TEST_F(MemoryTrackerTest, UpdateMeasuresAllocationRates)
+{
+    MemoryTracker::Update(Timestep(MemoryTracker::RATE_WINDOW));
+
+    {
+        MemoryTagScope tag(EMemoryTag::Aether);
+        for (int i = 0; i < 10; i++)
+        {
+            auto [ptr, size] = Tracking.Alloc(1000);
+            Tracking.Free(ptr);
+        }
+    }
+
+    // Rates are refreshed once per window only
+    MemoryTracker::Update(Timestep(MemoryTracker::RATE_WINDOW / 2.0f));
+    MemoryTracker::Update(Timestep(MemoryTracker::RATE_WINDOW * 1.5f));
+
+    const auto stats = MemoryTracker::GetStats(EMemoryTag::Aether);
+    EXPECT_FLOAT_EQ(stats.AllocationsPerSecond, 10.0f / (2.0f * MemoryTracker::RATE_WINDOW));
+    EXPECT_GE(stats.BytesPerSecond, 10.0f * 1000.0f / (2.0f * MemoryTracker::RATE_WINDOW));
+}
+
+TEST_F(MemoryTrackerTest, TaggedVectorAccountsToItsTag)
+{
+    const auto before = MemoryTracker::GetStats(EMemoryTag::Fonts).LiveBytes;
+    {
+        TaggedVector<EMemoryTag::Fonts, uint8_t> pixels(4096, 0xFF);
+        EXPECT_GE(MemoryTracker::GetStats(EMemoryTag::Fonts).LiveBytes, before + 4096);
+        EXPECT_EQ(MemoryTracker::GetCurrentTag(), EMemoryTag::General);
+    }
+    EXPECT_EQ(MemoryTracker::GetStats(EMemoryTag::Fonts).LiveBytes, before);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Font/FontCache.h>
+using namespace Elixir;
+
+#include <fstream>
+
+namespace
+{
+    constexpr uint64_t KEY = 0x1234;
+
+    std::filesystem::path GetTestPath()
+    {
+        return std::filesystem::temp_directory_path() / "ElixirFontCacheTest" / "Font.mtsdf";
+    }
+
+    SFontCacheData MakeData()
+    {
+        SFontCacheData data;
+        data.Info.AscenderY = 0.8f;
+        data.Info.DescenderY = -0.2f;
+        data.GeometryScale = 0.5;
+        data.Kerning = { { 'A', 'V', -0.1f } };
+
+        // 'a' has a bitmap, ' ' is whitespace
+        SGlyph a = { .Unicode = 'a', .Advance = 0.5f, .PlaneBounds = SRect{ { 0, 0 }, { 0.4f, 0.5f } } };
+        SGlyph space = { .Unicode = ' ', .Advance = 0.25f };
+        data.Info.Glyphs = { a, space };
+
+        SGlyphBitmap bitmap;
+        bitmap.Glyph = a;
+        bitmap.Glyph.AtlasBounds = SRect{ { 0.5f, 0.5f }, { 1.5f, 2.5f } };
+        bitmap.Width = 2;
+        bitmap.Height = 3;
+        bitmap.Pixels.resize(4 * 2 * 3);
+        for (size_t i = 0; i < bitmap.Pixels.size(); i++)
+            bitmap.Pixels[i] = (uint8_t)i;
+        data.Bitmaps = { bitmap };
+
+        return data;
+    }
+}
+
+TEST(FontCacheTest, RoundTrip)
+{
+    const auto path = GetTestPath();
+    ASSERT_TRUE(FontCache::Write(path, KEY, MakeData()));
+
+    const auto cache = FontCache::Open(path, KEY);
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->GetGeometryScale(), 0.5);
+
+    const auto info = cache->GetCreateInfo("Font");
+    EXPECT_EQ(info.Name, "Font");
+    EXPECT_EQ(info.AscenderY, 0.8f);
+    EXPECT_EQ(info.DescenderY, -0.2f);
+    ASSERT_EQ(info.Glyphs.size(), 2u);
+    EXPECT_TRUE(info.Glyphs[0].PlaneBounds.has_value());
+    EXPECT_FALSE(info.Glyphs[0].AtlasBounds.has_value());
+    EXPECT_FALSE(info.Glyphs[1].PlaneBounds.has_value());
+
+    const auto kerning = cache->GetKerning();
+    ASSERT_EQ(kerning.size(), 1u);
+    EXPECT_EQ(kerning[0].A, 'A');
+    EXPECT_EQ(kerning[0].Kerning, -0.1f);
+
+    const auto bitmap = cache->GetGlyphBitmap("Font", 'a');
+    ASSERT_TRUE(bitmap.has_value());
+    EXPECT_EQ(bitmap->Font, "Font");
+    EXPECT_EQ(bitmap->Width, 2u);
+    EXPECT_EQ(bitmap->Height, 3u);
+    EXPECT_EQ(bitmap->Pixels, MakeData().Bitmaps[0].Pixels);
+    EXPECT_EQ(bitmap->Glyph.AtlasBounds->Size.y, 2.5f);
+
+    EXPECT_FALSE(cache->GetGlyphBitmap("Font", ' ').has_value());
+    EXPECT_FALSE(cache->GetGlyphBitmap("Font", 'z').has_value());
+}
+
+TEST(FontCacheTest, StaleKeyIsRejected)
+{
+    const auto path = GetTestPath();
+    ASSERT_TRUE(FontCache::Write(path, KEY, MakeData()));
+    EXPECT_EQ(FontCache::Open(path, KEY + 1), nullptr);
+}
+
+TEST(FontCacheTest, MissingFileIsRejected)
+{
+    EXPECT_EQ(FontCache::Open(GetTestPath().parent_path() / "Missing.mtsdf", KEY), nullptr);
+}
+
+TEST(FontCacheTest, KeyDependsOnSettings)
+{
+    const std::array<Byte, 3> font = { Byte(1), Byte(2), Byte(3) };
+    const std::array<Byte, 2> charset = { Byte(0x20), Byte(0xFF) };
+
+    const auto key = FontCache::ComputeKey(font, charset, 4.0f, 64.0);
+    EXPECT_EQ(key, FontCache::ComputeKey(font, charset, 4.0f, 64.0));
+    EXPECT_NE(key, FontCache::ComputeKey(font, charset, 2.0f, 64.0));
+    EXPECT_NE(key, FontCache::ComputeKey(font, charset, 4.0f, 32.0));
+    EXPECT_NE(key, FontCache::ComputeKey(std::span(font).first(2), charset, 4.0f, 64.0));
+}
+
+TEST(FontCacheTest, BitmapOutOfPixelsIsRejected)
+{
+    const auto path = GetTestPath();
+    ASSERT_TRUE(FontCache::Write(path, KEY, MakeData()));
+
+    // Size the bitmap of 'a', the first record after the 48-byte header, so that
+    // 4 * Width * Height wraps around to zero
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t size[2] = { 0x80000000, 0x80000000 };
+        file.seekp(48 + 48);
+        file.write((const char*)size, sizeof(size));
+    }
+
+    EXPECT_EQ(FontCache::Open(path, KEY), nullptr);
+}
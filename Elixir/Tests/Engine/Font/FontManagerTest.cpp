@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Font/FontManager.h>
+using namespace Elixir;
+
+namespace
+{
+    // Loads fonts with no glyphs once released, so a test can hold loads in flight
+    class FakeFontBackend final : public FontBackend
+    {
+      public:
+        explicit FakeFontBackend(std::shared_future<void> release, const bool throws = false)
+            : m_Release(std::move(release)), m_Throws(throws) {}
+
+        Ref<Font> Load(const std::filesystem::path& filepath) override
+        {
+            Loads++;
+            m_Release.wait();
+
+            if (m_Throws)
+                throw std::runtime_error("Corrupted font");
+
+            return CreateRef<Font>(SFontCreateInfo{ .Name = filepath.stem().string() });
+        }
+
+        std::optional<SGlyphBitmap> GenerateGlyph(const std::string&, uint32_t) override
+        {
+            return std::nullopt;
+        }
+
+        std::atomic<int> Loads = 0;
+
+      private:
+        std::shared_future<void> m_Release;
+        bool m_Throws;
+    };
+}
+
+class FontManagerTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        DefaultFont = CreateRef<Font>(SFontCreateInfo{ .Name = FontManager::DEFAULT_FONT_NAME });
+        FontManager::s_Fonts[FontManager::DEFAULT_FONT_NAME] = DefaultFont;
+    }
+
+    void TearDown() override
+    {
+        Release();
+        FontManager::s_LoadWaitGroup.Wait();
+        FontManager::s_PendingLoads.clear();
+        FontManager::s_Fonts.clear();
+        FontManager::s_FontBackend.reset();
+    }
+
+    // Friendship is not inherited by the tests
+    static bool HasPendingLoads() { return !FontManager::s_PendingLoads.empty(); }
+
+    FakeFontBackend& UseBackend(const bool throws = false)
+    {
+        auto backend = CreateScope<FakeFontBackend>(ReleasePromise.get_future().share(), throws);
+        auto& ref = *backend;
+        FontManager::s_FontBackend = std::move(backend);
+        return ref;
+    }
+
+    void Release()
+    {
+        if (!Released)
+        {
+            ReleasePromise.set_value();
+            Released = true;
+        }
+    }
+
+    Ref<Font> DefaultFont;
+    std::promise<void> ReleasePromise;
+    bool Released = false;
+};
+
+TEST_F(FontManagerTest, LoadAsyncFallsBackToTheDefaultFontUntilLoaded)
+{
+    UseBackend();
+
+    const auto future = FontManager::LoadAsync("Fonts/Inter.otf");
+    ASSERT_TRUE(future.IsValid());
+    EXPECT_FALSE(future.IsReady());
+    EXPECT_EQ(future.Get(), DefaultFont);
+    EXPECT_EQ(FontManager::GetFont("Inter"), nullptr);
+
+    Release();
+    const auto font = future.Wait();
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(future.Get(), font);
+
+    // Registered by the next update
+    FontManager::Update();
+    EXPECT_EQ(FontManager::GetFont("Inter"), font);
+    EXPECT_FALSE(HasPendingLoads());
+}
+
+TEST_F(FontManagerTest, LoadAsyncDeduplicatesFontsLoadingOrLoaded)
+{
+    auto& backend = UseBackend();
+
+    const auto first = FontManager::LoadAsync("Fonts/Inter.otf");
+    const auto second = FontManager::LoadAsync("Other/Inter.ttf");
+
+    Release();
+    EXPECT_EQ(first.Wait(), second.Wait());
+    FontManager::Update();
+
+    const auto loaded = FontManager::LoadAsync("Fonts/Inter.otf");
+    EXPECT_TRUE(loaded.IsReady());
+    EXPECT_EQ(loaded.Get(), first.Wait());
+
+    EXPECT_EQ(backend.Loads, 1);
+}
+
+TEST_F(FontManagerTest, LoadAsyncPropagatesLoadFailures)
+{
+    UseBackend(true);
+
+    const auto future = FontManager::LoadAsync("Fonts/Broken.otf");
+    Release();
+
+    EXPECT_THROW(future.Wait(), std::runtime_error);
+    EXPECT_EQ(future.Get(), DefaultFont);
+
+    // Dropped by the update, without registering anything
+    EXPECT_NO_THROW(FontManager::Update());
+    EXPECT_FALSE(HasPendingLoads());
+    EXPECT_EQ(FontManager::GetFont("Broken"), nullptr);
+}
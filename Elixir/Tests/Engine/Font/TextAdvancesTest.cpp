@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Font/Font.h>
+using namespace Elixir;
+
+namespace
+{
+    // "aé!" -> 'a' (1 byte, 10px), 'é' (2 bytes, 20px), '!' (1 byte, 5px)
+    STextAdvances MakeAdvances()
+    {
+        STextAdvances advances;
+        advances.Offsets = { 0, 1, 3, 4 };
+        advances.Positions = { 0.0f, 10.0f, 30.0f, 35.0f };
+        return advances;
+    }
+
+    // Same glyphs as MakeAdvances, at a scale of one pixel per unit and font size
+    Ref<Font> MakeFont()
+    {
+        SFontCreateInfo info;
+        info.Name = "Test";
+        info.AscenderY = 0.8f;
+        info.DescenderY = -0.2f;
+        info.Glyphs = {
+            { .Unicode = 'a', .Advance = 1.0f },
+            { .Unicode = 0xE9, .Advance = 2.0f },
+            { .Unicode = '!', .Advance = 0.5f }
+        };
+        return CreateRef<Font>(info);
+    }
+}
+
+TEST(TextAdvancesTest, DefaultIsEmptyText)
+{
+    const STextAdvances advances;
+    EXPECT_EQ(advances.GetWidth(), 0.0f);
+    EXPECT_EQ(advances.GetIndexAtX(100.0f), 0u);
+    EXPECT_EQ(advances.GetFittingLength(100.0f), 0u);
+}
+
+TEST(TextAdvancesTest, PositionAtBoundaries)
+{
+    const auto advances = MakeAdvances();
+    EXPECT_EQ(advances.GetPositionAt(0), 0.0f);
+    EXPECT_EQ(advances.GetPositionAt(1), 10.0f);
+    EXPECT_EQ(advances.GetPositionAt(3), 30.0f);
+    EXPECT_EQ(advances.GetPositionAt(4), 35.0f);
+    EXPECT_EQ(advances.GetWidth(), 35.0f);
+}
+
+TEST(TextAdvancesTest, PositionInsideMultibyteCharResolvesToItsStart)
+{
+    const auto advances = MakeAdvances();
+    EXPECT_EQ(advances.GetPositionAt(2), 10.0f);
+}
+
+TEST(TextAdvancesTest, IndexAtXSnapsToNearestBoundary)
+{
+    const auto advances = MakeAdvances();
+    EXPECT_EQ(advances.GetIndexAtX(-5.0f), 0u);
+    EXPECT_EQ(advances.GetIndexAtX(4.9f), 0u);   // left half of 'a'
+    EXPECT_EQ(advances.GetIndexAtX(5.0f), 1u);   // right half of 'a'
+    EXPECT_EQ(advances.GetIndexAtX(19.0f), 1u);  // left half of 'é'
+    EXPECT_EQ(advances.GetIndexAtX(21.0f), 3u);  // right half of 'é'
+    EXPECT_EQ(advances.GetIndexAtX(33.0f), 4u);
+    EXPECT_EQ(advances.GetIndexAtX(500.0f), 4u); // past the end
+}
+
+TEST(TextAdvancesTest, FittingLengthNeverSplitsACharacter)
+{
+    const auto advances = MakeAdvances();
+    EXPECT_EQ(advances.GetFittingLength(-1.0f), 0u);
+    EXPECT_EQ(advances.GetFittingLength(9.0f), 0u);
+    EXPECT_EQ(advances.GetFittingLength(10.0f), 1u);
+    EXPECT_EQ(advances.GetFittingLength(29.0f), 1u);
+    EXPECT_EQ(advances.GetFittingLength(30.0f), 3u);
+    EXPECT_EQ(advances.GetFittingLength(35.0f), 4u);
+}
+
+TEST(TextAdvancesTest, MeasureAdvancesStepsOverMultibyteCharacters)
+{
+    const auto font = MakeFont();
+    const auto advances = font->MeasureAdvances("a\xC3\xA9!", 10.0f);
+
+    const auto expected = MakeAdvances();
+    EXPECT_EQ(advances.Offsets, expected.Offsets);
+    EXPECT_EQ(advances.Positions, expected.Positions);
+    EXPECT_EQ(advances.GetWidth(), font->MeasureText("a\xC3\xA9!", 10.0f).x);
+}
+
+TEST(TextAdvancesTest, MeasureAdvancesMatchesRenderingWithKerning)
+{
+    const auto font = MakeFont();
+    font->SetKerning('a', 0xE9, -0.25f);
+
+    // Text is laid out without kerning, so the caret stays on the rendered glyphs
+    const auto advances = font->MeasureAdvances("a\xC3\xA9!", 10.0f);
+    EXPECT_EQ(advances.Positions, MakeAdvances().Positions);
+    EXPECT_EQ(advances.GetWidth(), font->MeasureText("a\xC3\xA9!", 10.0f).x);
+}
+
+TEST(TextAdvancesTest, MeasureAdvancesKeepsBoundariesOfMissingGlyphs)
+{
+    const auto font = MakeFont();
+    const auto advances = font->MeasureAdvances("aza", 10.0f);
+
+    EXPECT_EQ(advances.Offsets, (std::vector<uint32_t>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(advances.Positions, (std::vector<float>{ 0.0f, 10.0f, 10.0f, 20.0f }));
+}
+
+TEST(TextAdvancesTest, MeasureAdvancesOfEmptyText)
+{
+    const auto advances = MakeFont()->MeasureAdvances("", 10.0f);
+    EXPECT_EQ(advances.Offsets, std::vector<uint32_t>{ 0 });
+    EXPECT_EQ(advances.GetWidth(), 0.0f);
+}
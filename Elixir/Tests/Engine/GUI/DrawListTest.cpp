@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/GUI/Renderer/DrawList.h>
+using namespace Elixir;
+using namespace Elixir::GUI;
+
+namespace
+{
+    constexpr uint32_t QUADS = 0;
+    constexpr uint32_t TEXT = 1;
+
+    const SRect NO_SCISSOR = {{ -1, -1 }, { -1, -1 }};
+
+    // Feeds ranges the way the Renderer does: each pass hands out consecutive instances.
+    class DrawListBuilder
+    {
+      public:
+        void Add(const uint32_t pass, const SRect& bounds, const SRect& scissor = NO_SCISSOR)
+        {
+            auto& next = m_Next[pass];
+            List.Add(pass, { next++, 1, bounds }, scissor);
+        }
+
+        DrawList List;
+
+      private:
+        uint32_t m_Next[2] = {};
+    };
+}
+
+TEST(DrawListTest, NonOverlappingWidgetsBatchPerPass)
+{
+    // Three buttons side by side: background then label each
+    DrawListBuilder builder;
+    for (int i = 0; i < 3; i++)
+    {
+        const SRect rect = { { i * 100.0f, 0 }, { 90, 30 } };
+        builder.Add(QUADS, rect);
+        builder.Add(TEXT, rect);
+    }
+
+    const auto& segments = builder.List.GetSegments();
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_EQ(segments[0].Pass, QUADS);
+    EXPECT_EQ(segments[0].Range.Count, 3u);
+    EXPECT_EQ(segments[1].Pass, TEXT);
+    EXPECT_EQ(segments[1].Range.Count, 3u);
+}
+
+TEST(DrawListTest, OverlappingGeometryKeepsZOrder)
+{
+    // A label, then a popup quad drawn over it, then the popup's own label
+    DrawListBuilder builder;
+    builder.Add(QUADS, { { 0, 0 }, { 100, 100 } });
+    builder.Add(TEXT, { { 10, 10 }, { 50, 20 } });
+    builder.Add(QUADS, { { 0, 0 }, { 80, 80 } });
+    builder.Add(TEXT, { { 20, 20 }, { 50, 20 } });
+
+    const auto& segments = builder.List.GetSegments();
+    ASSERT_EQ(segments.size(), 4u);
+    EXPECT_EQ(segments[0].Pass, QUADS);
+    EXPECT_EQ(segments[1].Pass, TEXT);
+    EXPECT_EQ(segments[2].Pass, QUADS);
+    EXPECT_EQ(segments[2].Range.First, 1u);
+    EXPECT_EQ(segments[3].Pass, TEXT);
+    EXPECT_EQ(segments[3].Range.First, 1u);
+}
+
+TEST(DrawListTest, DifferentScissorsStartNewSegments)
+{
+    const SRect clip = { { 0, 0 }, { 50, 50 } };
+
+    DrawListBuilder builder;
+    builder.Add(QUADS, { { 0, 0 }, { 10, 10 } });
+    builder.Add(QUADS, { { 20, 0 }, { 10, 10 } }, clip);
+    builder.Add(QUADS, { { 30, 0 }, { 10, 10 } }, clip);
+
+    const auto& segments = builder.List.GetSegments();
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_EQ(segments[0].ScissorRect, NO_SCISSOR);
+    EXPECT_EQ(segments[1].ScissorRect, clip);
+    EXPECT_EQ(segments[1].Range.Count, 2u);
+}
+
+TEST(DrawListTest, FullyClippedGeometryIsCulled)
+{
+    const SRect clip = { { 0, 0 }, { 50, 50 } };
+
+    DrawListBuilder builder;
+    builder.Add(QUADS, { { 0, 0 }, { 10, 10 } }, clip);
+    builder.Add(QUADS, { { 100, 100 }, { 10, 10 } }, clip);
+    builder.Add(QUADS, { { 20, 20 }, { 10, 10 } }, clip);
+
+    // The culled instance leaves a gap, so the third quad cannot extend the first draw
+    const auto& segments = builder.List.GetSegments();
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_EQ(segments[0].Range.First, 0u);
+    EXPECT_EQ(segments[0].Range.Count, 1u);
+    EXPECT_EQ(segments[1].Range.First, 2u);
+    EXPECT_EQ(segments[1].Range.Count, 1u);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "ManagerTestUtils.h"
+#include "WidgetTestUtils.h"
+
+#include <Engine/GUI/HitGrid.h>
+#include <Engine/GUI/VerticalBox.h>
+using namespace Elixir;
+using namespace Elixir::GUI;
+
+TEST(HitGridTest, QueryReturnsOnlyWidgetsContainingThePoint)
+{
+    const auto a = CreateRef<CountingWidget>();
+    const auto b = CreateRef<CountingWidget>();
+    Arrange(a, { { 0, 0 }, { 50, 50 } });
+    Arrange(b, { { 100, 100 }, { 50, 50 } });
+
+    HitGrid grid;
+    grid.Insert(a);
+    grid.Insert(b);
+
+    EXPECT_EQ(grid.Query({ 10, 10 }), std::vector<Ref<Widget>>{ a });
+    EXPECT_EQ(grid.Query({ 120, 120 }), std::vector<Ref<Widget>>{ b });
+    EXPECT_TRUE(grid.Query({ 75, 75 }).empty());
+}
+
+TEST(HitGridTest, OverlappingWidgetsComeBackInInsertionOrder)
+{
+    const auto parent = CreateRef<CountingWidget>();
+    const auto child = CreateRef<CountingWidget>();
+    Arrange(parent, { { 0, 0 }, { 500, 500 } });
+    Arrange(child, { { 200, 200 }, { 20, 20 } });
+
+    HitGrid grid;
+    grid.Insert(parent);
+    grid.Insert(child);
+
+    const auto hits = grid.Query({ 210, 210 });
+    ASSERT_EQ(hits.size(), 2u);
+    EXPECT_EQ(hits[0], parent);
+    EXPECT_EQ(hits[1], child);
+}
+
+TEST(HitGridTest, FarEdgeAndNegativeCoordinatesAreCovered)
+{
+    // Contains() is inclusive and the edge at x = 128 falls in the next cell
+    const auto widget = CreateRef<CountingWidget>();
+    Arrange(widget, { { -100, -100 }, { 228, 228 } });
+
+    HitGrid grid;
+    grid.Insert(widget);
+
+    EXPECT_EQ(grid.Query({ 128, 128 }).size(), 1u);
+    EXPECT_EQ(grid.Query({ -100, -100 }).size(), 1u);
+    EXPECT_TRUE(grid.Query({ 129, 0 }).empty());
+}
+
+TEST(HitGridTest, EmptyAndDestroyedWidgetsAreNotReturned)
+{
+    const auto empty = CreateRef<CountingWidget>();
+    Arrange(empty, { { 0, 0 }, { 0, 0 } });
+
+    HitGrid grid;
+    grid.Insert(empty);
+    EXPECT_EQ(grid.GetSize(), 0u);
+
+    {
+        const auto temporary = CreateRef<CountingWidget>();
+        Arrange(temporary, { { 0, 0 }, { 10, 10 } });
+        grid.Insert(temporary);
+    }
+    EXPECT_TRUE(grid.Query({ 5, 5 }).empty());
+}
+
+TEST(HitGridTest, ManagerRebuildsOnlyWhenLayoutChanges)
+{
+    const auto box = CreateRef<VerticalBox>();
+    const auto child = CreateRef<CountingWidget>();
+    box->AddChild(child);
+    Arrange(box, { { 0, 0 }, { 100, 100 } });
+
+    TestGUIManager manager;
+    manager.SetRoot(box);
+
+    EXPECT_TRUE(manager.UpdateHitGrid());
+    EXPECT_EQ(manager.GetHitGrid().GetSize(), 2u);
+
+    // Nothing moved
+    EXPECT_FALSE(manager.UpdateHitGrid());
+
+    // Visual-only changes do not move widgets
+    box->SetOpacity(0.5f);
+    EXPECT_FALSE(manager.UpdateHitGrid());
+
+    // Layout changes do
+    child->MarkLayoutDirty();
+    EXPECT_TRUE(manager.UpdateHitGrid());
+
+    // And so does arranging the tree into a different rectangle
+    Arrange(box, { { 0, 0 }, { 200, 200 } });
+    EXPECT_TRUE(manager.UpdateHitGrid());
+    EXPECT_FALSE(manager.UpdateHitGrid());
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include "ManagerTestUtils.h"
+#include "WidgetTestUtils.h"
+
+#include <Engine/GUI/VerticalBox.h>
+using namespace Elixir;
+using namespace Elixir::GUI;
+
+namespace
+{
+    // Leaf that draws a rect of a settable color.
+    class ColorWidget final : public Widget
+    {
+      public:
+        glm::vec2 ComputeDesiredSize() override { return { 10.0f, 10.0f }; }
+
+        void SetColor(const SColor& color)
+        {
+            m_Color = color;
+            MarkRenderDirty();
+        }
+
+        using Widget::MarkLayoutDirty;
+
+      protected:
+        void BuildDrawCommands(RenderBatch& batch, const int zOrder) override
+        {
+            batch.AddRect(m_Geometry, m_Color, {}, {}, {}, {}, zOrder);
+        }
+
+      private:
+        SColor m_Color = { 1, 1, 1, 1 };
+    };
+
+    // A cached panel holding two leaves, under an uncached root.
+    struct SLayerFixture
+    {
+        Ref<VerticalBox> Root = CreateRef<VerticalBox>();
+        Ref<VerticalBox> Panel = CreateRef<VerticalBox>();
+        Ref<ColorWidget> First = CreateRef<ColorWidget>();
+        Ref<ColorWidget> Second = CreateRef<ColorWidget>();
+        TestGUIManager Manager;
+
+        SLayerFixture()
+        {
+            Panel->AddChild(First);
+            Panel->AddChild(Second);
+            Panel->SetCacheAsLayer(true);
+            Root->AddChild(Panel);
+            Manager.SetRoot(Root);
+        }
+
+        // Lays out, assembles and returns the single layer command of the frame
+        const SDrawCommand& Frame()
+        {
+            Arrange(Root, { { 0, 0 }, { 100, 100 } });
+            Manager.AssembleFrame();
+            return LayerCommand(Manager.GetRenderBatch());
+        }
+
+        static const SDrawCommand& LayerCommand(const RenderBatch& batch)
+        {
+            const auto it = std::ranges::find(batch.GetCommands(), SDrawCommand::EType::Layer, &SDrawCommand::Type);
+            EXPECT_NE(it, batch.GetCommands().end());
+            return *it;
+        }
+    };
+}
+
+TEST(LayerCacheTest, CachedSubtreeIsEmittedAsOneLayer)
+{
+    SLayerFixture f;
+    const auto& layer = f.Frame();
+
+    // The panel's leaves only appear inside the layer
+    ASSERT_EQ(f.Manager.GetRenderBatch().GetCommands().size(), 1u);
+    ASSERT_NE(layer.Layer, nullptr);
+    EXPECT_EQ(layer.Layer->GetCommands().size(), 2u);
+    EXPECT_EQ(layer.Geometry, f.Panel->GetGeometry());
+}
+
+TEST(LayerCacheTest, UnchangedLayerKeepsItsVersion)
+{
+    SLayerFixture f;
+    const auto first = f.Frame();
+    const auto second = f.Frame();
+
+    EXPECT_EQ(second.LayerId, first.LayerId);
+    EXPECT_EQ(second.LayerVersion, first.LayerVersion);
+    EXPECT_EQ(second.Layer, first.Layer);
+}
+
+TEST(LayerCacheTest, DescendantChangesInvalidateTheLayer)
+{
+    SLayerFixture f;
+    const auto version = f.Frame().LayerVersion;
+
+    f.Second->SetColor({ 1, 0, 0, 1 });
+    const auto recolored = f.Frame();
+    EXPECT_GT(recolored.LayerVersion, version);
+    EXPECT_EQ(recolored.Layer->GetCommands()[1].Color, (SColor{ 1, 0, 0, 1 }));
+
+    f.First->MarkLayoutDirty();
+    EXPECT_GT(f.Frame().LayerVersion, recolored.LayerVersion);
+}
+
+TEST(LayerCacheTest, NestedLayerInvalidatesOuterLayer)
+{
+    SLayerFixture f;
+    const auto inner = CreateRef<VerticalBox>();
+    const auto leaf = CreateRef<ColorWidget>();
+    inner->AddChild(leaf);
+    inner->SetCacheAsLayer(true);
+    f.Panel->AddChild(inner);
+
+    const auto outer = f.Frame();
+    const auto& nested = SLayerFixture::LayerCommand(*outer.Layer);
+    const auto innerVersion = nested.LayerVersion;
+
+    // Both layers contain the leaf: both are redrawn
+    leaf->SetColor({ 0, 1, 0, 1 });
+    const auto updated = f.Frame();
+    EXPECT_GT(updated.LayerVersion, outer.LayerVersion);
+    EXPECT_GT(SLayerFixture::LayerCommand(*updated.Layer).LayerVersion, innerVersion);
+
+    // Only the outer layer contains the panel's own leaves
+    const auto outerVersion = updated.LayerVersion;
+    f.First->SetColor({ 0, 0, 1, 1 });
+    const auto again = f.Frame();
+    EXPECT_GT(again.LayerVersion, outerVersion);
+    EXPECT_EQ(SLayerFixture::LayerCommand(*again.Layer).LayerVersion, innerVersion + 1);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include "WidgetTestUtils.h"
+
+#include <Engine/GUI/HorizontalBox.h>
+#include <Engine/GUI/VerticalBox.h>
+using namespace Elixir;
+using namespace Elixir::GUI;
+
+#include <chrono>
+
+namespace
+{
+    constexpr int DEPTH = 16;
+    constexpr int ITERATIONS = 1000;
+
+    // Leaf that counts how often its desired size is actually computed
+    // (i.e. how often Measure missed its memoized value).
+    class MeasuringWidget final : public Widget
+    {
+      public:
+        int MeasureCount = 0;
+
+        glm::vec2 ComputeDesiredSize() override
+        {
+            ++MeasureCount;
+            return { 10.0f, 10.0f };
+        }
+
+        using Widget::MarkLayoutDirty;
+    };
+
+    struct SNestedTree
+    {
+        Ref<Widget> Root;
+        std::vector<Ref<MeasuringWidget>> Leaves;
+    };
+
+    // Alternating horizontal/vertical boxes, each holding a leaf and the next level.
+    // Without memoization every level re-measures its whole subtree at least twice,
+    // which makes the leaf count grow exponentially with the depth.
+    SNestedTree BuildNestedTree(const int depth)
+    {
+        SNestedTree tree;
+        Ref<Widget> inner;
+
+        for (int i = 0; i < depth; i++)
+        {
+            const auto leaf = CreateRef<MeasuringWidget>();
+            tree.Leaves.push_back(leaf);
+
+            if (i % 2 == 0)
+            {
+                const auto box = CreateRef<HorizontalBox>();
+                box->SetStretching(true);
+                box->AddChild(leaf);
+                if (inner) box->AddChild(inner);
+                inner = box;
+            }
+            else
+            {
+                const auto box = CreateRef<VerticalBox>();
+                box->SetStretching(true);
+                box->AddChild(leaf);
+                if (inner) box->AddChild(inner);
+                inner = box;
+            }
+        }
+
+        tree.Root = inner;
+        return tree;
+    }
+}
+
+TEST(LayoutBenchmarkTest, FullLayoutMeasuresEachWidgetOnce)
+{
+    const auto tree = BuildNestedTree(DEPTH);
+    Arrange(tree.Root, { { 0, 0 }, { 1280, 720 } });
+
+    for (const auto& leaf : tree.Leaves)
+    {
+        EXPECT_EQ(leaf->MeasureCount, 1);
+        EXPECT_FALSE(leaf->IsDesiredSizeDirty());
+    }
+}
+
+TEST(LayoutBenchmarkTest, ResizeReusesMemoizedDesiredSizes)
+{
+    const auto tree = BuildNestedTree(DEPTH);
+    Arrange(tree.Root, { { 0, 0 }, { 1280, 720 } });
+
+    // A new allocated space re-arranges the tree, but desired sizes do not depend on it.
+    Arrange(tree.Root, { { 0, 0 }, { 1920, 1080 } });
+
+    for (const auto& leaf : tree.Leaves)
+        EXPECT_EQ(leaf->MeasureCount, 1);
+}
+
+TEST(LayoutBenchmarkTest, DirtyLeafOnlyRemeasuresItself)
+{
+    const auto tree = BuildNestedTree(DEPTH);
+    Arrange(tree.Root, { { 0, 0 }, { 1280, 720 } });
+
+    const auto& deepest = tree.Leaves.front();
+    deepest->MarkLayoutDirty();
+    Arrange(tree.Root, { { 0, 0 }, { 1280, 720 } });
+
+    EXPECT_EQ(deepest->MeasureCount, 2);
+    for (size_t i = 1; i < tree.Leaves.size(); i++)
+        EXPECT_EQ(tree.Leaves[i]->MeasureCount, 1);
+}
+
+TEST(LayoutBenchmarkTest, MeasureAfterArrangeIsInvalidatedByDescendant)
+{
+    const auto box = CreateRef<VerticalBox>();
+    const auto leaf = CreateRef<MeasuringWidget>();
+    box->AddChild(leaf);
+
+    // Measured but not yet arranged: the box is still layout dirty, yet its desired
+    // size must be invalidated again when the leaf changes.
+    box->Measure();
+    ASSERT_TRUE(box->IsLayoutDirty());
+    ASSERT_FALSE(box->IsDesiredSizeDirty());
+
+    leaf->MarkLayoutDirty();
+    EXPECT_TRUE(box->IsDesiredSizeDirty());
+}
+
+TEST(LayoutBenchmarkTest, DeepNestingRelayout)
+{
+    const auto tree = BuildNestedTree(DEPTH);
+    Arrange(tree.Root, { { 0, 0 }, { 1280, 720 } });
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        tree.Leaves.front()->MarkLayoutDirty();
+        Arrange(tree.Root, { { 0, 0 }, { 1280, 720 } });
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    RecordProperty("Depth", DEPTH);
+    RecordProperty("NanosecondsPerLayout", std::to_string(ns / ITERATIONS));
+
+    EXPECT_EQ(tree.Leaves.front()->MeasureCount, ITERATIONS + 1);
+    EXPECT_EQ(tree.Leaves.back()->MeasureCount, 1);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include "ManagerTestUtils.h"
+#include "WidgetTestUtils.h"
+
+#include <Engine/GUI/Canvas.h>
+#include <Engine/GUI/ListView.h>
+using namespace Elixir;
+using namespace Elixir::GUI;
+
+namespace
+{
+    constexpr size_t ITEM_COUNT = 100000;
+
+    // Row that draws a rect over its geometry and remembers the item it shows.
+    class RowWidget final : public Widget
+    {
+      public:
+        size_t Index = SIZE_MAX;
+
+        glm::vec2 ComputeDesiredSize() override { return { 10.0f, 10.0f }; }
+
+      protected:
+        void BuildDrawCommands(RenderBatch& batch, const int zOrder) override
+        {
+            batch.AddRect(m_Geometry, { 1, 1, 1, 1 }, {}, {}, {}, {}, zOrder);
+        }
+    };
+
+    struct SListFixture
+    {
+        Ref<ListView> List = CreateRef<ListView>();
+        int Generated = 0;
+        int Bound = 0;
+
+        SListFixture()
+        {
+            List->SetItemCount(ITEM_COUNT);
+            List->SetItemHeight(20.0f);
+            List->SetGenerator([this] { ++Generated; return CreateRef<RowWidget>(); });
+            List->SetBinder([this](const Ref<Widget>& row, const size_t index)
+            {
+                ++Bound;
+                std::static_pointer_cast<RowWidget>(row)->Index = index;
+            });
+        }
+
+        size_t IndexOf(const size_t item) const
+        {
+            const auto row = List->GetRow(item);
+            return row ? std::static_pointer_cast<RowWidget>(row)->Index : SIZE_MAX;
+        }
+    };
+}
+
+TEST(ListViewTest, MaterializesOnlyVisibleRows)
+{
+    SListFixture f;
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+
+    EXPECT_EQ(f.List->GetFirstVisibleIndex(), 0u);
+    EXPECT_EQ(f.List->GetVisibleRowCount(), 5u);
+    EXPECT_EQ(f.Generated, 5);
+    EXPECT_EQ(f.IndexOf(4), 4u);
+    EXPECT_EQ(f.List->GetRow(5), nullptr);
+
+    EXPECT_EQ(f.List->GetRow(0)->GetGeometry(), (SRect{ { 0, 0 }, { 100, 20 } }));
+    EXPECT_EQ(f.List->GetRow(4)->GetGeometry(), (SRect{ { 0, 80 }, { 100, 20 } }));
+}
+
+TEST(ListViewTest, ScrollingRecyclesRowsInsteadOfGenerating)
+{
+    SListFixture f;
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+
+    // Half a row in: the partially visible rows at both ends are materialized
+    f.List->SetScrollOffset(10.0f);
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+    EXPECT_EQ(f.List->GetVisibleRowCount(), 6u);
+    EXPECT_EQ(f.List->GetRow(0)->GetGeometry().Position.y, -10.0f);
+    EXPECT_EQ(f.Generated, 6);
+
+    // Far away: every row is recycled and re-bound, none generated
+    const int bound = f.Bound;
+    f.List->SetScrollOffset(50000.0f * 20.0f);
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+    EXPECT_EQ(f.List->GetFirstVisibleIndex(), 50000u);
+    EXPECT_EQ(f.IndexOf(50000), 50000u);
+    EXPECT_EQ(f.IndexOf(50004), 50004u);
+    EXPECT_EQ(f.Generated, 6);
+    EXPECT_EQ(f.Bound, bound + 5);
+}
+
+TEST(ListViewTest, RowsStillInViewAreNotRebound)
+{
+    SListFixture f;
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+    const auto row2 = f.List->GetRow(2);
+
+    const int bound = f.Bound;
+    f.List->SetScrollOffset(40.0f);
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+
+    // Items 2..4 stay in view, only 5 and 6 are bound into the rows of 0 and 1
+    EXPECT_EQ(f.Bound, bound + 2);
+    EXPECT_EQ(f.List->GetRow(2), row2);
+    EXPECT_EQ(row2->GetGeometry().Position.y, 0.0f);
+}
+
+TEST(ListViewTest, ScrollOffsetIsClamped)
+{
+    SListFixture f;
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+
+    f.List->SetScrollOffset(-50.0f);
+    EXPECT_EQ(f.List->GetScrollOffset(), 0.0f);
+
+    f.List->SetScrollOffset(1e9f);
+    EXPECT_EQ(f.List->GetScrollOffset(), ITEM_COUNT * 20.0f - 100.0f);
+    EXPECT_EQ(f.List->GetMaxScrollOffset(), ITEM_COUNT * 20.0f - 100.0f);
+
+    f.List->ScrollToItem(10);
+    EXPECT_EQ(f.List->GetScrollOffset(), 200.0f);
+}
+
+TEST(ListViewTest, ShrinkingItemCountDropsRowsPastTheEnd)
+{
+    SListFixture f;
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+
+    f.List->SetItemCount(2);
+    Arrange(f.List, { { 0, 0 }, { 100, 100 } });
+
+    EXPECT_EQ(f.List->GetVisibleRowCount(), 2u);
+    EXPECT_EQ(f.IndexOf(1), 1u);
+    EXPECT_EQ(f.Generated, 5);
+}
+
+TEST(ListViewTest, RowsAreClippedForDrawingAndHitTesting)
+{
+    SListFixture f;
+    const auto canvas = CreateRef<Canvas>();
+    canvas->AddChild(f.List).SetPosition({ 0, 100 }).SetSize({ 100, 100 });
+    f.List->SetScrollOffset(10.0f);
+    Arrange(canvas, { { 0, 0 }, { 800, 600 } });
+
+    TestGUIManager manager;
+    manager.SetRoot(canvas);
+    manager.AssembleFrame();
+
+    const SRect listRect = { { 0, 100 }, { 100, 100 } };
+    for (const auto& cmd : manager.GetRenderBatch().GetCommands())
+        EXPECT_EQ(cmd.ScissorRect, listRect);
+
+    // The first row spans y = 90..110, but only its visible part is hit-testable
+    manager.UpdateHitGrid();
+    const auto firstRow = f.List->GetRow(0);
+    const auto above = manager.GetHitGrid().Query({ 50, 95 });
+    const auto inside = manager.GetHitGrid().Query({ 50, 105 });
+    EXPECT_EQ(std::ranges::find(above, firstRow), above.end());
+    EXPECT_NE(std::ranges::find(inside, firstRow), inside.end());
+}
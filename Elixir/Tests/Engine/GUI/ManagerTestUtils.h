@@ -12,5 +12,6 @@ namespace
         using Manager::AssembleFrame;
         using Manager::NeedsRebuild;
         using Manager::MarkRebuilt;
+        using Manager::UpdateHitGrid;
     };
 }
\ No newline at end of file
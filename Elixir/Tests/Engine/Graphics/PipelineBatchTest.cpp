@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Graphics/GraphicsContext.h>
+#include <Engine/Graphics/Pipeline/PipelineBatch.h>
+using namespace Elixir;
+
+#include <future>
+
+namespace
+{
+    // A context without a device, the requests below never reach it
+    class FakeGraphicsContext final : public GraphicsContext
+    {
+      public:
+        FakeGraphicsContext() : GraphicsContext(EGraphicsAPI::Vulkan, nullptr) {}
+
+        void Init() override {}
+        void Shutdown() override {}
+        void ProcessEvent(Event&) override {}
+        void RenderFrame(std::function<void()>) override {}
+        void DrainRenderQueue() override {}
+        void SetClearColor(const glm::vec4&) override {}
+        void Clear() override {}
+        void Resize(Extent2D) override {}
+        Ref<CommandBuffer> GetSecondaryCommandBuffer() const override { return nullptr; }
+        Ref<CommandBuffer> GetUploadCommandBuffer() const override { return nullptr; }
+        void EnqueueSecondaryCommandBuffer(const Ref<CommandBuffer>&) const override {}
+        bool IsFormatSupported(EImageFormat, EImageUsage) const override { return false; }
+        Extent3D GetSwapchainExtent() const override { return {}; }
+
+      private:
+        void CreateRenderTargets() override {}
+    };
+
+    // Every shader fails to load, the shader named HELD only once the test releases it
+    class FakeShaderLoader final : public ShaderLoader
+    {
+      public:
+        static constexpr auto HELD = "Held";
+        static constexpr auto BROKEN = "Broken";
+
+        FakeShaderLoader() : ShaderLoader(nullptr), m_Release(m_Gate.get_future().share()) {}
+
+        using ShaderLoader::LoadShader;
+
+        Ref<Shader> LoadShader(
+            const std::filesystem::path&,
+            std::span<const std::string_view>,
+            const std::string& name,
+            EShaderStage
+        ) const override
+        {
+            m_Calls++;
+
+            if (name == HELD)
+                m_Release.wait();
+
+            if (name == BROKEN)
+                throw std::runtime_error("Broken shader!");
+
+            return nullptr;
+        }
+
+        void Release() { m_Gate.set_value(); }
+        int GetCalls() const { return m_Calls; }
+
+      private:
+        std::promise<void> m_Gate;
+        std::shared_future<void> m_Release;
+        mutable std::atomic<int> m_Calls = 0;
+    };
+}
+
+TEST(PipelineBatchTest, FailedShaderLoadResolvesPipelinesToNullptr)
+{
+    FakeGraphicsContext context;
+    FakeShaderLoader loader;
+    PipelineBatch batch(&context, &loader);
+
+    const auto shader = batch.LoadShader("Shaders", "Missing");
+    const auto graphics = batch.Build(PipelineBuilder(), shader);
+    const auto compute = batch.BuildCompute(shader);
+    batch.Wait();
+
+    EXPECT_TRUE(shader.IsReady());
+    EXPECT_EQ(shader.Get(), nullptr);
+    EXPECT_EQ(graphics.Get(), nullptr);
+    EXPECT_EQ(compute.Get(), nullptr);
+    EXPECT_EQ(loader.GetCalls(), 1);
+}
+
+TEST(PipelineBatchTest, PipelinesContinueOnceTheirShaderIsLoaded)
+{
+    FakeGraphicsContext context;
+    FakeShaderLoader loader;
+    PipelineBatch batch(&context, &loader);
+
+    // More pipelines than workers: if they waited on the shader they would hold every
+    // worker, and the other shader could never load
+    const auto pipelineCount = 4 * std::max(std::thread::hardware_concurrency(), 1u);
+
+    const auto held = batch.LoadShader("Shaders", FakeShaderLoader::HELD);
+    std::vector<ComputePipelineFuture> pipelines;
+    for (uint32_t i = 0; i < pipelineCount; i++)
+        pipelines.push_back(batch.BuildCompute(held));
+
+    const auto other = batch.LoadShader("Shaders", "Other");
+    EXPECT_EQ(other.Get(), nullptr);
+
+    EXPECT_FALSE(held.IsReady());
+    for (const auto& pipeline : pipelines)
+        EXPECT_FALSE(pipeline.IsReady());
+
+    loader.Release();
+    batch.Wait();
+
+    for (const auto& pipeline : pipelines)
+    {
+        ASSERT_TRUE(pipeline.IsReady());
+        EXPECT_EQ(pipeline.Get(), nullptr);
+    }
+}
+
+TEST(PipelineBatchTest, PipelinesOfALoadedShaderStartRightAway)
+{
+    FakeGraphicsContext context;
+    FakeShaderLoader loader;
+    PipelineBatch batch(&context, &loader);
+
+    const auto shader = batch.LoadShader("Shaders", "Missing");
+    batch.Wait();
+
+    const auto pipeline = batch.BuildCompute(shader);
+    batch.Wait();
+
+    EXPECT_TRUE(pipeline.IsReady());
+    EXPECT_EQ(pipeline.Get(), nullptr);
+}
+
+TEST(PipelineBatchTest, ShaderLoadErrorsAreRethrownByItsPipelines)
+{
+    FakeGraphicsContext context;
+    FakeShaderLoader loader;
+    PipelineBatch batch(&context, &loader);
+
+    const auto shader = batch.LoadShader("Shaders", FakeShaderLoader::BROKEN);
+    const auto pipeline = batch.Build(PipelineBuilder(), shader);
+    batch.Wait();
+
+    EXPECT_THROW(shader.Get(), std::runtime_error);
+    EXPECT_THROW(pipeline.Get(), std::runtime_error);
+}
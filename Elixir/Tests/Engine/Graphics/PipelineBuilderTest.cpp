@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+using namespace testing;
+
+#include <Engine/Graphics/Pipeline/PipelineBuilder.h>
+using namespace Elixir;
+
+namespace
+{
+    // The state the GUI passes configure, without a shader.
+    PipelineBuilder MakeBuilder()
+    {
+        PipelineBuilder builder;
+        builder.SetInputTopology(EPrimitiveTopology::TriangleList);
+        builder.SetPolygonMode(EPolygonMode::Fill);
+        builder.SetCullMode(ECullMode::None, EFrontFace::Clockwise);
+        builder.SetMultisamplingNone();
+        builder.EnableAlphaBlending();
+        builder.DisableDepthTest();
+        builder.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_SRGB);
+        builder.SetBufferLayout(BufferLayout({
+            {
+                {
+                    { EDataType::Vec2, "Position" },
+                    { EDataType::Vec4, "Color"    },
+                },
+                EInputRate::Instance
+            }
+        }));
+        return builder;
+    }
+}
+
+TEST(PipelineBuilderTest, EqualStateComparesAndHashesEqual)
+{
+    EXPECT_EQ(MakeBuilder().GetHash(), MakeBuilder().GetHash());
+    EXPECT_EQ(MakeBuilder(), MakeBuilder());
+}
+
+TEST(PipelineBuilderTest, StateChangesChangeTheHashAndEquality)
+{
+    const auto hash = MakeBuilder().GetHash();
+
+    auto blending = MakeBuilder();
+    blending.EnablePremultipliedAlphaBlending();
+    EXPECT_NE(blending.GetHash(), hash);
+    EXPECT_NE(blending, MakeBuilder());
+
+    auto depth = MakeBuilder();
+    depth.EnableDepthTest(true, ECompareOp::LessOrEqual);
+    EXPECT_NE(depth.GetHash(), hash);
+    EXPECT_NE(depth, MakeBuilder());
+
+    auto format = MakeBuilder();
+    format.SetColorAttachmentFormat(EImageFormat::R8G8B8A8_UNORM);
+    EXPECT_NE(format.GetHash(), hash);
+    EXPECT_NE(format, MakeBuilder());
+
+    auto layout = MakeBuilder();
+    layout.SetBufferLayout(BufferLayout({
+        {
+            {
+                { EDataType::Vec2, "Position" },
+                { EDataType::Vec4, "Color"    },
+            },
+            EInputRate::Vertex
+        }
+    }));
+    EXPECT_NE(layout.GetHash(), hash);
+    EXPECT_NE(layout, MakeBuilder());
+
+    auto permutation = MakeBuilder();
+    permutation.SetPermutation(ShaderPermutation().Set(0, true));
+    EXPECT_NE(permutation.GetHash(), hash);
+    EXPECT_NE(permutation, MakeBuilder());
+}
+
+TEST(PipelineBuilderTest, ClearResetsTheState)
+{
+    auto builder = MakeBuilder();
+    builder.Clear();
+    EXPECT_EQ(builder.GetHash(), PipelineBuilder().GetHash());
+    EXPECT_EQ(builder, PipelineBuilder());
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Graphics/Shader/ShaderPermutation.h>
+#include <bit>
+using namespace Elixir;
+
+TEST(ShaderPermutationTest, ConstantsAreSortedById)
+{
+    ShaderPermutation permutation;
+    permutation.Set(3, 7u).Set(1, true).Set(2, -1);
+
+    const auto& constants = permutation.GetConstants();
+    ASSERT_EQ(constants.size(), 3u);
+    EXPECT_EQ(constants[0], (SSpecializationConstant{ 1, 1 }));
+    EXPECT_EQ(constants[1], (SSpecializationConstant{ 2, 0xFFFFFFFFu }));
+    EXPECT_EQ(constants[2], (SSpecializationConstant{ 3, 7 }));
+}
+
+TEST(ShaderPermutationTest, SettingAnIdAgainReplacesItsValue)
+{
+    ShaderPermutation permutation;
+    permutation.Set(0, 1.0f).Set(0, 2.0f);
+
+    ASSERT_EQ(permutation.GetConstants().size(), 1u);
+    EXPECT_EQ(permutation.GetConstants()[0].Value, std::bit_cast<uint32_t>(2.0f));
+}
+
+TEST(ShaderPermutationTest, KeyIdentifiesThePermutation)
+{
+    EXPECT_EQ(ShaderPermutation().GetKey(), 0u);
+
+    // Insertion order does not matter
+    const auto a = ShaderPermutation().Set(0, 1u).Set(1, 2u);
+    const auto b = ShaderPermutation().Set(1, 2u).Set(0, 1u);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.GetKey(), b.GetKey());
+
+    EXPECT_NE(a.GetKey(), ShaderPermutation().Set(0, 1u).Set(1, 3u).GetKey());
+    EXPECT_NE(a.GetKey(), ShaderPermutation().Set(0, 1u).GetKey());
+    EXPECT_NE(ShaderPermutation().Set(0, 0u).GetKey(), 0u);
+}
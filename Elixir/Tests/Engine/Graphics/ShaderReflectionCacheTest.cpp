@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Graphics/Shader/ShaderReflectionCache.h>
+using namespace Elixir;
+
+namespace
+{
+    const std::array<Byte, 8> BYTECODE = {
+        Byte(0x03), Byte(0x02), Byte(0x23), Byte(0x07), Byte(0x00), Byte(0x00), Byte(0x01), Byte(0x00)
+    };
+
+    std::filesystem::path GetTestPath()
+    {
+        return std::filesystem::temp_directory_path() / "ElixirShaderReflectionTest" / "Mesh.vs.reflect";
+    }
+
+    SShaderModuleCreateInfo MakeModule()
+    {
+        SShaderModuleCreateInfo module;
+        module.Entrypoint = "main";
+
+        module.Resources.emplace_back("Textures", 1, 0, EResourceType::SampledImage, EResourceDimension::_2D, 0, true);
+        module.Resources.emplace_back("Sampler", 1, 1, EResourceType::Sampler, EResourceDimension::None, 1);
+
+        auto& camera = module.ConstantBuffers.emplace_back("Camera", 0, 2);
+        camera.PushConstant(ShaderConstant("ViewProjection", EConstantType::Mat4, 1, false));
+        camera.PushConstant(ShaderConstant("Position", EConstantType::Vec3, 1, false));
+
+        const auto material = CreateRef<ShaderConstantStruct>("Material");
+        material->AddField(ShaderConstant("Color", EConstantType::Vec4, 1, false));
+        material->AddField(ShaderConstant("Roughness", EConstantType::Float, 1, false));
+
+        auto& push = module.PushConstants.emplace_back("Constants", 0, 0, 0);
+        push.PushConstant(ShaderConstant("Transform", EConstantType::Mat4, 1, false));
+        push.PushConstant(ShaderConstant("Material", material, 2, false));
+        push.PushConstant(ShaderConstant("Vertices", EConstantType::Vec4, 1, true));
+
+        return module;
+    }
+}
+
+TEST(ShaderReflectionCacheTest, PathIsNextToTheModule)
+{
+    EXPECT_EQ(ShaderReflectionCache::GetPath("Shaders/Mesh.vs.spirv"), std::filesystem::path("Shaders/Mesh.vs.reflect"));
+}
+
+TEST(ShaderReflectionCacheTest, RoundTrip)
+{
+    const auto path = GetTestPath();
+    ASSERT_TRUE(ShaderReflectionCache::Write(path, BYTECODE, MakeModule()));
+
+    const auto module = ShaderReflectionCache::Read(path, BYTECODE);
+    ASSERT_TRUE(module.has_value());
+    EXPECT_EQ(module->Entrypoint, "main");
+    EXPECT_TRUE(module->StorageBuffers.empty());
+
+    ASSERT_EQ(module->Resources.size(), 2u);
+    const auto& textures = module->Resources[0];
+    EXPECT_EQ(textures.GetName(), "Textures");
+    EXPECT_EQ(textures.GetSet(), 1u);
+    EXPECT_EQ(textures.GetType(), EResourceType::SampledImage);
+    EXPECT_EQ(textures.GetDimension(), EResourceDimension::_2D);
+    EXPECT_TRUE(textures.IsBindless());
+    EXPECT_EQ(module->Resources[1].GetBinding(), 1u);
+    EXPECT_FALSE(module->Resources[1].IsBindless());
+
+    ASSERT_EQ(module->ConstantBuffers.size(), 1u);
+    const auto& camera = module->ConstantBuffers[0];
+    EXPECT_EQ(camera.GetBinding(), 2u);
+    EXPECT_EQ(camera.GetSize(), 76u);
+    ASSERT_EQ(camera.GetConstants().size(), 2u);
+    EXPECT_EQ(camera.GetConstants()[1].GetOffset(), 64u);
+
+    ASSERT_EQ(module->PushConstants.size(), 1u);
+    const auto& constants = module->PushConstants[0].GetConstants();
+    ASSERT_EQ(constants.size(), 3u);
+
+    const auto& material = constants[1];
+    EXPECT_EQ(material.GetType(), EConstantType::Struct);
+    EXPECT_EQ(material.GetCount(), 2u);
+    EXPECT_EQ(material.GetOffset(), 64u);
+    ASSERT_NE(material.GetStruct(), nullptr);
+    EXPECT_EQ(material.GetStruct()->GetName(), "Material");
+    ASSERT_EQ(material.GetStruct()->GetFields().size(), 2u);
+    EXPECT_EQ(material.GetStruct()->GetFields()[1].GetOffset(), 16u);
+
+    EXPECT_TRUE(constants[2].IsPointer());
+    EXPECT_EQ(constants[2].GetOffset(), 64u + 2 * 20u);
+    EXPECT_EQ(module->PushConstants[0].GetSize(), MakeModule().PushConstants[0].GetSize());
+}
+
+TEST(ShaderReflectionCacheTest, StaleBytecodeIsRejected)
+{
+    const auto path = GetTestPath();
+    ASSERT_TRUE(ShaderReflectionCache::Write(path, BYTECODE, MakeModule()));
+
+    auto recompiled = BYTECODE;
+    recompiled[4] = Byte(0x01);
+    EXPECT_FALSE(ShaderReflectionCache::Read(path, recompiled).has_value());
+}
+
+TEST(ShaderReflectionCacheTest, MissingFileIsRejected)
+{
+    EXPECT_FALSE(ShaderReflectionCache::Read(GetTestPath().parent_path() / "Missing.reflect", BYTECODE).has_value());
+}
+
+TEST(ShaderReflectionCacheTest, OutOfRangeResourceTypeIsRejected)
+{
+    const auto path = GetTestPath();
+    auto module = MakeModule();
+    module.Resources.emplace_back("Unknown", 2, 0, (EResourceType)7, EResourceDimension::_2D, 1);
+    ASSERT_TRUE(ShaderReflectionCache::Write(path, BYTECODE, module));
+
+    EXPECT_FALSE(ShaderReflectionCache::Read(path, BYTECODE).has_value());
+}
+
+TEST(ShaderReflectionCacheTest, OutOfRangeResourceDimensionIsRejected)
+{
+    const auto path = GetTestPath();
+    auto module = MakeModule();
+    module.Resources.emplace_back("Unknown", 2, 0, EResourceType::Image, (EResourceDimension)9, 1);
+    ASSERT_TRUE(ShaderReflectionCache::Write(path, BYTECODE, module));
+
+    EXPECT_FALSE(ShaderReflectionCache::Read(path, BYTECODE).has_value());
+}
+
+TEST(ShaderReflectionCacheTest, OutOfRangeConstantTypeIsRejected)
+{
+    const auto path = GetTestPath();
+    auto module = MakeModule();
+
+    // A pointer, so its size does not depend on the type
+    module.PushConstants[0].PushConstant(ShaderConstant("Unknown", (EConstantType)42, 1, true));
+    ASSERT_TRUE(ShaderReflectionCache::Write(path, BYTECODE, module));
+
+    EXPECT_FALSE(ShaderReflectionCache::Read(path, BYTECODE).has_value());
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Graphics/TextureCache.h>
+using namespace Elixir;
+
+namespace
+{
+    // A texture without GPU resources, its memory size only depends on its extent
+    class FakeTexture final : public Texture2D
+    {
+      public:
+        FakeTexture(const uint32_t width, const uint32_t height)
+            : Texture2D(nullptr, CreateImageInfo(EImageFormat::R8G8B8A8_UNORM, width, height)) {}
+
+        void Destroy() override {}
+        void Resize(const Ref<CommandBuffer>&, Extent3D) override {}
+        void Transition(const CommandBuffer*, EImageLayout) override {}
+        void Copy(const CommandBuffer*, Image*, const Extent3D&, const Extent3D&) override {}
+        void CopyFrom(const CommandBuffer*, const Buffer*, std::span<SBufferImageCopy>) override {}
+        void SetBaseMipLevel(uint32_t) override {}
+        bool IsValid() const override { return true; }
+
+      protected:
+        void UpdateSampler() override {}
+    };
+
+    // Hands out consecutive slots, without a bindless pool
+    class FakeTextureSet final : public TextureSet
+    {
+      public:
+        FakeTextureSet() : TextureSet(nullptr) {}
+
+        void Clear() override { m_TextureCount = 0; }
+
+        SResourceHandle AddTexture(const Ref<Texture>&) override
+        {
+            return SResourceHandle::Texture(m_TextureCount++);
+        }
+
+        void RemoveTexture(SResourceHandle) override { m_TextureCount--; }
+    };
+
+    constexpr size_t TEXTURE_SIZE = 16 * 16 * 4;
+
+    TextureCache::Loader MakeLoader(int* calls = nullptr)
+    {
+        return [calls]() -> Ref<Texture>
+        {
+            if (calls) (*calls)++;
+            return CreateRef<FakeTexture>(16, 16);
+        };
+    }
+
+    void UpdateFor(TextureCache& cache, const uint32_t updates)
+    {
+        for (uint32_t i = 0; i < updates; i++)
+            cache.Update();
+    }
+}
+
+TEST(TextureCacheTest, SameKeySharesTheTexture)
+{
+    const auto cache = CreateRef<TextureCache>(nullptr);
+
+    int calls = 0;
+    const auto first = cache->GetOrLoad("a", MakeLoader(&calls));
+    const auto second = cache->GetOrLoad("a", MakeLoader(&calls));
+    const auto other = cache->GetOrLoad("b", MakeLoader(&calls));
+
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_NE(first.get(), other.get());
+
+    const auto stats = cache->GetStats();
+    EXPECT_EQ(stats.Hits, 1u);
+    EXPECT_EQ(stats.Misses, 2u);
+    EXPECT_EQ(stats.TextureCount, 2u);
+    EXPECT_EQ(stats.ResidentBytes, 2 * TEXTURE_SIZE);
+    EXPECT_EQ(stats.ReferencedBytes, 2 * TEXTURE_SIZE);
+}
+
+TEST(TextureCacheTest, FailedLoadIsNotCached)
+{
+    const auto cache = CreateRef<TextureCache>(nullptr);
+
+    EXPECT_EQ(cache->GetOrLoad("a", [] { return Ref<Texture>(); }), nullptr);
+    EXPECT_EQ(cache->Find("a"), nullptr);
+    EXPECT_EQ(cache->GetStats().TextureCount, 0u);
+}
+
+TEST(TextureCacheTest, ReleasedTextureStaysCached)
+{
+    const auto cache = CreateRef<TextureCache>(nullptr);
+
+    auto texture = cache->GetOrLoad("a", MakeLoader());
+    const auto* address = texture.get();
+    texture.reset();
+
+    EXPECT_EQ(cache->GetStats().ReferencedBytes, 0u);
+    EXPECT_EQ(cache->GetStats().ResidentBytes, TEXTURE_SIZE);
+
+    UpdateFor(*cache, TextureCache::EVICTION_DELAY * 2);
+
+    // Within budget, the texture is reused
+    const auto found = cache->Find("a");
+    EXPECT_EQ(found.get(), address);
+    EXPECT_EQ(cache->GetStats().ReferencedCount, 1u);
+}
+
+TEST(TextureCacheTest, LeastRecentlyReleasedIsEvictedOverBudget)
+{
+    const auto cache = CreateRef<TextureCache>(nullptr, 2 * TEXTURE_SIZE);
+
+    auto a = cache->GetOrLoad("a", MakeLoader());
+    auto b = cache->GetOrLoad("b", MakeLoader());
+    auto c = cache->GetOrLoad("c", MakeLoader());
+
+    a.reset();
+    cache->Update();
+    b.reset();
+
+    // Frames in flight may still sample it
+    cache->Update();
+    EXPECT_EQ(cache->GetStats().TextureCount, 3u);
+
+    UpdateFor(*cache, TextureCache::EVICTION_DELAY);
+
+    const auto stats = cache->GetStats();
+    EXPECT_EQ(stats.Evictions, 1u);
+    EXPECT_EQ(stats.ResidentBytes, 2 * TEXTURE_SIZE);
+    EXPECT_EQ(cache->Find("a"), nullptr);
+    EXPECT_NE(cache->Find("b"), nullptr);
+}
+
+TEST(TextureCacheTest, ReferencedTexturesAreNeverEvicted)
+{
+    const auto cache = CreateRef<TextureCache>(nullptr, 0);
+
+    const auto texture = cache->GetOrLoad("a", MakeLoader());
+    UpdateFor(*cache, TextureCache::EVICTION_DELAY * 2);
+
+    EXPECT_EQ(cache->GetStats().Evictions, 0u);
+    EXPECT_EQ(cache->GetStats().ResidentBytes, TEXTURE_SIZE);
+}
+
+TEST(TextureCacheTest, ClearEvictsUnusedTextures)
+{
+    const auto cache = CreateRef<TextureCache>(nullptr);
+
+    const auto kept = cache->GetOrLoad("a", MakeLoader());
+    cache->GetOrLoad("b", MakeLoader());
+
+    cache->Clear();
+
+    EXPECT_EQ(cache->GetStats().TextureCount, 1u);
+    EXPECT_NE(cache->Find("a"), nullptr);
+    EXPECT_EQ(cache->Find("b"), nullptr);
+}
+
+TEST(TextureCacheTest, TextureOutlivesTheCache)
+{
+    auto cache = CreateRef<TextureCache>(nullptr);
+    const auto texture = cache->GetOrLoad("a", MakeLoader());
+
+    cache.reset();
+    EXPECT_EQ(texture->GetWidth(), 16u);
+}
+
+TEST(TextureCacheTest, CachedTexturesAreRegisteredOnce)
+{
+    const auto textureSet = CreateRef<FakeTextureSet>();
+    const auto cache = CreateRef<TextureCache>(textureSet, 0);
+
+    const auto a = cache->GetOrLoad("a", MakeLoader());
+    const auto again = cache->GetOrLoad("a", MakeLoader());
+    const auto b = cache->GetOrLoad("b", MakeLoader());
+
+    EXPECT_EQ(textureSet->GetTextureCount(), 2u);
+    EXPECT_EQ(cache->GetHandle(a.get()).Index, cache->GetHandle("a").Index);
+    EXPECT_EQ(cache->GetHandle(again.get()).Index, cache->GetHandle("a").Index);
+    EXPECT_NE(cache->GetHandle(b.get()).Index, cache->GetHandle("a").Index);
+
+    const auto uncached = CreateRef<FakeTexture>(16, 16);
+    EXPECT_FALSE(cache->GetHandle(uncached.get()).IsValid());
+}
+
+TEST(TextureCacheTest, EvictedTextureLosesItsHandle)
+{
+    const auto textureSet = CreateRef<FakeTextureSet>();
+    const auto cache = CreateRef<TextureCache>(textureSet, 0);
+
+    auto texture = cache->GetOrLoad("a", MakeLoader());
+    const auto address = texture.get();
+
+    texture.reset();
+    UpdateFor(*cache, TextureCache::EVICTION_DELAY + 1);
+
+    EXPECT_EQ(textureSet->GetTextureCount(), 0u);
+    EXPECT_FALSE(cache->GetHandle(address).IsValid());
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <Engine/Graphics/TextureMips.h>
+using namespace Elixir;
+
+namespace
+{
+    std::vector<uint8_t> MakePixels(const uint32_t width, const uint32_t height, const std::array<uint8_t, 4>& color)
+    {
+        std::vector<uint8_t> pixels;
+        for (uint32_t i = 0; i < width * height; i++)
+            pixels.insert(pixels.end(), color.begin(), color.end());
+        return pixels;
+    }
+
+    uint16_t ReadUInt16(const STextureMip& mip, const size_t offset)
+    {
+        uint16_t value;
+        std::memcpy(&value, mip.Data.data() + offset, sizeof(value));
+        return value;
+    }
+
+    uint32_t ReadUInt32(const STextureMip& mip, const size_t offset)
+    {
+        uint32_t value;
+        std::memcpy(&value, mip.Data.data() + offset, sizeof(value));
+        return value;
+    }
+}
+
+TEST(TextureMipsTest, MipCountGoesDownToOnePixel)
+{
+    EXPECT_EQ(TextureMips::GetMipCount(1, 1), 1u);
+    EXPECT_EQ(TextureMips::GetMipCount(256, 256), 9u);
+    EXPECT_EQ(TextureMips::GetMipCount(300, 20), 9u);
+    EXPECT_EQ(TextureMips::GetMipCount(1, 64), 7u);
+}
+
+TEST(TextureMipsTest, ChainHalvesEachLevel)
+{
+    const auto pixels = MakePixels(5, 3, { 10, 20, 30, 40 });
+    const auto mips = TextureMips::Generate(pixels.data(), 5, 3, EImageFormat::R8G8B8A8_UNORM);
+
+    ASSERT_EQ(mips.size(), 3u);
+    EXPECT_EQ(mips[0].Data.size(), pixels.size());
+    EXPECT_EQ(mips[1].Width, 2u);
+    EXPECT_EQ(mips[1].Height, 1u);
+    EXPECT_EQ(mips[2].Width, 1u);
+    EXPECT_EQ(mips[2].Height, 1u);
+    ASSERT_EQ(mips[2].Data.size(), 4u);
+
+    // A uniform image stays uniform, including the texels folding an odd column
+    for (const auto& mip : mips)
+    {
+        for (size_t i = 0; i < mip.Data.size(); i += 4)
+        {
+            EXPECT_EQ((uint8_t)mip.Data[i], 10);
+            EXPECT_EQ((uint8_t)mip.Data[i + 3], 40);
+        }
+    }
+}
+
+TEST(TextureMipsTest, BoxFilterAveragesTexels)
+{
+    const std::vector<uint8_t> pixels = {
+        0, 0, 0, 0,         255, 255, 255, 255,
+        255, 255, 255, 255, 0, 0, 0, 0,
+    };
+
+    const auto unorm = TextureMips::Generate(pixels.data(), 2, 2, EImageFormat::R8G8B8A8_UNORM);
+    ASSERT_EQ(unorm.size(), 2u);
+    EXPECT_EQ((uint8_t)unorm[1].Data[0], 128);
+    EXPECT_EQ((uint8_t)unorm[1].Data[3], 128);
+
+    // sRGB colors are averaged in linear space, alpha is not
+    const auto srgb = TextureMips::Generate(pixels.data(), 2, 2, EImageFormat::R8G8B8A8_SRGB);
+    EXPECT_EQ((uint8_t)srgb[1].Data[0], 188);
+    EXPECT_EQ((uint8_t)srgb[1].Data[3], 128);
+}
+
+TEST(TextureMipsTest, FloatPixelsAreAveraged)
+{
+    const std::vector<float> pixels = {
+        0.0f, 1.0f, 4.0f, 1.0f,  2.0f, 1.0f, 8.0f, 1.0f,
+    };
+
+    const auto mips = TextureMips::Generate(pixels.data(), 2, 1, EImageFormat::R32G32B32A32_SFLOAT);
+    ASSERT_EQ(mips.size(), 2u);
+    ASSERT_EQ(mips[1].Data.size(), 4 * sizeof(float));
+
+    const auto texel = (const float*)mips[1].Data.data();
+    EXPECT_FLOAT_EQ(texel[0], 1.0f);
+    EXPECT_FLOAT_EQ(texel[2], 6.0f);
+}
+
+TEST(TextureMipsTest, BC1EncodesOpaqueBlocks)
+{
+    auto pixels = MakePixels(4, 4, { 255, 0, 0, 255 });
+    STextureMip mip = { 4, 4 };
+    mip.Data.assign((const Byte*)pixels.data(), (const Byte*)pixels.data() + pixels.size());
+
+    const auto compressed = TextureMips::CompressBC1(mip);
+    ASSERT_EQ(compressed.Data.size(), 8u);
+
+    // Pure red in both endpoints, every texel picks one of them
+    EXPECT_EQ(ReadUInt16(compressed, 0), 0xF800);
+    EXPECT_EQ(ReadUInt16(compressed, 2), 0xF800);
+    EXPECT_EQ(ReadUInt32(compressed, 4), 0u);
+}
+
+TEST(TextureMipsTest, BC1KeepsTransparentTexels)
+{
+    auto pixels = MakePixels(4, 4, { 255, 255, 255, 255 });
+    pixels[3] = 0; // First texel is transparent
+
+    STextureMip mip = { 4, 4 };
+    mip.Data.assign((const Byte*)pixels.data(), (const Byte*)pixels.data() + pixels.size());
+
+    const auto compressed = TextureMips::CompressBC1(mip);
+    EXPECT_LE(ReadUInt16(compressed, 0), ReadUInt16(compressed, 2));
+    EXPECT_EQ(ReadUInt32(compressed, 4) & 0x3, 3u);
+    EXPECT_NE((ReadUInt32(compressed, 4) >> 2) & 0x3, 3u);
+}
+
+TEST(TextureMipsTest, BC1PadsPartialBlocks)
+{
+    const auto pixels = MakePixels(6, 5, { 0, 0, 255, 255 });
+    STextureMip mip = { 6, 5 };
+    mip.Data.assign((const Byte*)pixels.data(), (const Byte*)pixels.data() + pixels.size());
+
+    const auto compressed = TextureMips::CompressBC1(mip);
+    EXPECT_EQ(compressed.Width, 6u);
+    EXPECT_EQ(compressed.Height, 5u);
+    EXPECT_EQ(compressed.Data.size(), 2u * 2u * 8u);
+}
+
+TEST(TextureMipsTest, OnlyRGBA8FormatsHaveABC1Format)
+{
+    EXPECT_EQ(TextureMips::GetBC1Format(EImageFormat::R8G8B8A8_SRGB), EImageFormat::BC1_RGBA_SRGB_BLOCK);
+    EXPECT_EQ(TextureMips::GetBC1Format(EImageFormat::R8G8B8A8_UNORM), EImageFormat::BC1_RGBA_UNORM_BLOCK);
+    EXPECT_EQ(TextureMips::GetBC1Format(EImageFormat::R32G32B32A32_SFLOAT), EImageFormat::Undefined);
+}
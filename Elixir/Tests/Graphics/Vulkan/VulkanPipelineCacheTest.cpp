@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <Graphics/Vulkan/VulkanPipelineCache.h>
+using namespace Elixir;
+using namespace Elixir::Vulkan;
+
+namespace
+{
+    VkPhysicalDeviceProperties MakeProperties()
+    {
+        VkPhysicalDeviceProperties properties = {};
+        properties.vendorID = 0x10de;
+        properties.deviceID = 0x2684;
+        for (uint8_t i = 0; i < VK_UUID_SIZE; i++)
+            properties.pipelineCacheUUID[i] = i;
+        return properties;
+    }
+
+    // Cache data as the driver writes it: header followed by opaque contents.
+    std::vector<Byte> MakeData(const VkPhysicalDeviceProperties& properties)
+    {
+        VkPipelineCacheHeaderVersionOne header = {};
+        header.headerSize = sizeof(header);
+        header.headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+        header.vendorID = properties.vendorID;
+        header.deviceID = properties.deviceID;
+        std::memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+        std::vector<Byte> data(sizeof(header) + 64);
+        std::memcpy(data.data(), &header, sizeof(header));
+        return data;
+    }
+}
+
+TEST(VulkanPipelineCacheTest_IsCompatible, AcceptsDataFromTheSameDevice)
+{
+    const auto properties = MakeProperties();
+    EXPECT_TRUE(VulkanPipelineCache::IsCompatible(MakeData(properties), properties));
+}
+
+TEST(VulkanPipelineCacheTest_IsCompatible, RejectsDataFromAnotherDriver)
+{
+    const auto properties = MakeProperties();
+    const auto data = MakeData(properties);
+
+    auto updated = properties;
+    updated.pipelineCacheUUID[0] ^= 0xff;
+    EXPECT_FALSE(VulkanPipelineCache::IsCompatible(data, updated));
+
+    auto other = properties;
+    other.deviceID++;
+    EXPECT_FALSE(VulkanPipelineCache::IsCompatible(data, other));
+}
+
+TEST(VulkanPipelineCacheTest_IsCompatible, RejectsTruncatedData)
+{
+    const auto properties = MakeProperties();
+    const auto data = MakeData(properties);
+    EXPECT_FALSE(VulkanPipelineCache::IsCompatible(std::span(data).first(8), properties));
+    EXPECT_FALSE(VulkanPipelineCache::IsCompatible({}, properties));
+}
+
+TEST(VulkanPipelineCacheTest_GetPath, IsKeyedByDeviceAndDriver)
+{
+    const auto properties = MakeProperties();
+    auto updated = properties;
+    updated.pipelineCacheUUID[VK_UUID_SIZE - 1] = 0xff;
+
+    const auto path = VulkanPipelineCache::GetPath(properties);
+    EXPECT_EQ(path.parent_path(), VulkanPipelineCache::DIRECTORY);
+    EXPECT_EQ(path.filename(), "10de-2684-000102030405060708090a0b0c0d0e0f.bin");
+    EXPECT_NE(VulkanPipelineCache::GetPath(updated), path);
+}
@@ -0,0 +1,40 @@
+#include <Engine/Logging/Log.h>
+#include <Engine/Graphics/Shader/ShaderReflectionCache.h>
+#include <Graphics/SpirV/SpirVShaderBackend.h>
+using namespace Elixir;
+
+/**
+ * Reflect a SPIR-V module and write its layout next to it, so the engine can load the
+ * shader without running SPIRV-Cross.
+ * Usage: Elixir.ShaderReflect <input.spirv> <output.reflect>
+ */
+int main(const int argc, char** argv)
+{
+    Log::Init();
+
+    if (argc != 3)
+    {
+        EE_CORE_ERROR("Usage: {0} <input.spirv> <output.reflect>", argv[0])
+        return 1;
+    }
+
+    const std::filesystem::path input = argv[1];
+    const std::filesystem::path output = argv[2];
+
+    try
+    {
+        const auto module = SpirV::SpirVShaderBackend::ReflectModule(input);
+        if (module.Bytecode.empty())
+        {
+            EE_CORE_ERROR("Cannot read shader! [Path={0}]", input.string())
+            return 1;
+        }
+
+        return ShaderReflectionCache::Write(output, module.Bytecode, module) ? 0 : 1;
+    }
+    catch (const std::exception& error)
+    {
+        EE_CORE_ERROR("Cannot reflect shader: \"{0}\" [Path={1}]", error.what(), input.string())
+        return 1;
+    }
+}
@@ -65,6 +65,23 @@ cbuffer cbParams : register(b0)
     float4 ViewportData; // x = viewport width, y = viewport height, z = unused, w = unused
 };
 
+struct PushConstants {
+    uint EmitterIndex;
+};
+
+[[vk::push_constant]]
+PushConstants pc;
+
+// Bit i is set when the emitter's update ops contain op type i. The pipeline is specialized
+// per op set so the branches of unused ops are compiled out; the default keeps every op.
+[[vk::constant_id(0)]]
+const uint UpdateOpMask = 0xFFFFFFFFu;
+
+bool HasOp(uint type)
+{
+    return (UpdateOpMask & (1u << type)) != 0u;
+}
+
 float Hash1(float x) {
   return frac(sin(x * 91.3458 + 12.345) * 45678.5453);
 }
@@ -249,7 +266,12 @@ float3 SafeNormalize(float3 value, float3 fallback)
 [numthreads(256, 1, 1)]
 void main(uint3 dispatchThreadId : SV_DispatchThreadID)
 {
-    uint particleIndex = dispatchThreadId.x;
+    Emitter emitter = emitters[pc.EmitterIndex];
+    uint localIndex = dispatchThreadId.x;
+    if (localIndex >= (uint)emitter.MetaA.y)
+        return;
+
+    uint particleIndex = (uint)emitter.MetaA.x + localIndex;
     uint totalParticleCount = (uint)TimeData.z;
     if (particleIndex >= totalParticleCount)
         return;
@@ -264,8 +286,6 @@ void main(uint3 dispatchThreadId : SV_DispatchThreadID)
 
     float particleSeed = Hash1((float)particleIndex);
 
-    uint emitterIndex = (uint)(state.Metadata.x + 0.5);
-    Emitter emitter = emitters[emitterIndex];
     float dt = TimeData.x;
 
     AttributeTable attributes = LoadAttributes(state);
@@ -286,11 +306,11 @@ void main(uint3 dispatchThreadId : SV_DispatchThreadID)
         int param0 = (int)op.Header.z;
         int param1 = (int)op.Header.w;
 
-        if (type == 0u) // SetLiteral
+        if (HasOp(0u) && type == 0u) // SetLiteral
         {
             SetAttribute(attributes, target, ResolveValue(param0, op.Data0));
         }
-        else if (type == 5u) // AddWithDelta
+        else if (HasOp(5u) && type == 5u) // AddWithDelta
         {
             float4 value = GetAttribute(attributes, target);
             float inputMultiplier = ResolveDynamicInput(uint(op.Data1.x + 0.5), life, particleSeed);
@@ -299,21 +319,21 @@ void main(uint3 dispatchThreadId : SV_DispatchThreadID)
 
             SetAttribute(attributes, target, value);
         }
-        else if (type == 6u) // Dampen
+        else if (HasOp(6u) && type == 6u) // Dampen
         {
             float4 value = GetAttribute(attributes, target);
             float drag = ResolveValue(param0, op.Data0).x;
             value *= max(0.0, 1.0 - drag * dt);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 7u) // LerpOverLife
+        else if (HasOp(7u) && type == 7u) // LerpOverLife
         {
             float4 value0 = ResolveValue(param0, op.Data0);
             float4 value1 = ResolveValue(param1, op.Data1);
             float4 value = lerp(value0, value1, life);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 8u) // KillOutsideBounds
+        else if (HasOp(8u) && type == 8u) // KillOutsideBounds
         {
             float4 position = GetAttribute(attributes, 1u);
             bool outsideBounds = position.x < op.Data0.x || position.x > op.Data1.x ||
@@ -321,38 +341,38 @@ void main(uint3 dispatchThreadId : SV_DispatchThreadID)
                                  position.z < op.Data0.z || position.z > op.Data1.z;
             kill = kill || outsideBounds;
         }
-        else if (type == 9u) // AddFromAttribute
+        else if (HasOp(9u) && type == 9u) // AddFromAttribute
         {
             float4 value = GetAttribute(attributes, target);
             float4 sourceValue = GetAttribute(attributes, uint(op.Data0.x + 0.5));
             value += sourceValue * (op.Data0.y * dt);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 14u) // SampleCurve
+        else if (HasOp(14u) && type == 14u) // SampleCurve
         {
             float inputValue = ResolveDynamicInput(uint(op.Data0.x + 0.5), life, particleSeed);
             float value = SampleCurve(param0, inputValue);
             SetAttribute(attributes, target, float4(value, 0.0, 0.0, 0.0));
         }
-        else if (type == 15u) // SampleColorCurve
+        else if (HasOp(15u) && type == 15u) // SampleColorCurve
         {
             float inputValue = ResolveDynamicInput(uint(op.Data0.x + 0.5), life, particleSeed);
             float4 value = SampleColorCurve(param0, inputValue);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 16u) // Add
+        else if (HasOp(16u) && type == 16u) // Add
         {
             float4 value = GetAttribute(attributes, target);
             value += ResolveValue(param0, op.Data0);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 17u) // Mul
+        else if (HasOp(17u) && type == 17u) // Mul
         {
             float4 value = GetAttribute(attributes, target);
             value *= ResolveValue(param0, op.Data0);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 18u) // Clamp
+        else if (HasOp(18u) && type == 18u) // Clamp
         {
             float4 value = GetAttribute(attributes, target);
             float4 minValue = ResolveValue(param0, op.Data0);
@@ -360,12 +380,12 @@ void main(uint3 dispatchThreadId : SV_DispatchThreadID)
             value = clamp(value, minValue, maxValue);
             SetAttribute(attributes, target, value);
         }
-        else if (type == 19u) // CopyFromAttribute
+        else if (HasOp(19u) && type == 19u) // CopyFromAttribute
         {
             float4 value = GetAttribute(attributes, uint(op.Data0.x + 0.5));
             SetAttribute(attributes, target, value);
         }
-        else if (type == 20u) // ApplyVortex
+        else if (HasOp(20u) && type == 20u) // ApplyVortex
         {
             float4 velocity = GetAttribute(attributes, target);
             float4 position = GetAttribute(attributes, 1u);
@@ -0,0 +1,22 @@
+// Global bindless resources (binding 0 = cis, binding 1 = textures, binding 2 = samplers)
+[[vk::binding(1, 1)]] // binding, set
+Texture2D textures[] : register(t0);
+
+[[vk::binding(1, 0)]]
+SamplerState samplerState : register(s0);
+
+struct PS_INPUT
+{
+    float4 ClipPos          : SV_POSITION;          // Clip-space position
+    float2 TexCoord         : TEXCOORD0;            // UV coordinates
+    float4 Color            : COLOR0;               // Tint
+    uint   TextureIndex     : TEXTURE;              // Layer texture index
+};
+
+float4 main(PS_INPUT input) : SV_Target0
+{
+    // Layers are drawn with alpha blending over a transparent clear, so their color is
+    // already premultiplied by alpha: the tint must be premultiplied as well.
+    float4 layer = textures[input.TextureIndex].Sample(samplerState, input.TexCoord);
+    return layer * float4(input.Color.rgb * input.Color.a, input.Color.a);
+}
@@ -0,0 +1,42 @@
+#include "Quad.hlsl"
+
+[[vk::binding(0, 0)]]
+cbuffer cbPerFrame : register(b0)
+{
+    float4x4 Proj;          // Projection matrix for orthographic projection
+}
+
+struct VS_INPUT
+{
+    // Per layer
+    float2 Position         : INSTANCE_POSITION;    // Layer position in screen-space
+    float2 Size             : INSTANCE_SIZE;        // Layer size in screen-space
+    float4 Color            : COLOR0;               // Tint, premultiplied by the shader
+    uint   TextureIndex     : TEXTURE;              // Layer texture index
+
+    uint VertexId : SV_VertexID;
+};
+
+struct VS_OUTPUT
+{
+    float4 ClipPos          : SV_POSITION;          // Clip-space position
+    float2 TexCoord         : TEXCOORD0;            // UV coordinates
+    float4 Color            : COLOR0;               // Tint
+    uint   TextureIndex     : TEXTURE;              // Layer texture index
+};
+
+VS_OUTPUT main(VS_INPUT input)
+{
+    VS_OUTPUT output;
+
+    // The layer texture covers the quad exactly, one texel per pixel
+    float2 normalizedPos = CalculateQuadPosition(input.VertexId);
+    float2 screenPos = input.Position + normalizedPos * input.Size;
+
+    output.ClipPos = mul(Proj, float4(screenPos, 0.0f, 1.0f));
+    output.TexCoord = normalizedPos;
+    output.Color = input.Color;
+    output.TextureIndex = input.TextureIndex;
+
+    return output;
+}
@@ -2,6 +2,7 @@
 # Automatically compiles HLSL and GLSL shaders to SPIR-V when source files change.
 # Source:  Shaders/**/*.{hlsl,glsl}
 # Staging: ${CMAKE_BINARY_DIR}/Shaders/**/*.spirv  (mirrors source tree, stripping "Source/" prefix)
+#          ${CMAKE_BINARY_DIR}/Shaders/**/*.reflect (reflected layout, see ReflectShaders below)
 # Output:  Copied into each dependent target's output directory as Shaders/
 
 set(SHADER_SOURCE_DIR "${CMAKE_SOURCE_DIR}/Shaders")
@@ -185,6 +186,34 @@ endif()
 
 add_custom_target(CompileShaders ALL DEPENDS ${ALL_SPIRV_OUTPUTS})
 
+# --- Reflect compiled shaders: X.vs.spirv -> X.vs.reflect ---
+# The engine loads the reflected layout instead of running SPIRV-Cross at startup, and
+# falls back to runtime reflection when the file is missing or stale. The reflection
+# tool links the engine, so it is defined later, by Elixir.cmake.
+
+option(ELIXIR_REFLECT_SHADERS "Reflect shaders at build time" ON)
+
+set(ALL_REFLECT_OUTPUTS "")
+
+if(ELIXIR_REFLECT_SHADERS)
+    foreach(SPIRV_OUTPUT IN LISTS ALL_SPIRV_OUTPUTS)
+        string(REGEX REPLACE "\\.spirv$" ".reflect" REFLECT_OUTPUT "${SPIRV_OUTPUT}")
+
+        add_custom_command(
+            OUTPUT "${REFLECT_OUTPUT}"
+            COMMAND Elixir.ShaderReflect "${SPIRV_OUTPUT}" "${REFLECT_OUTPUT}"
+            DEPENDS "${SPIRV_OUTPUT}" Elixir.ShaderReflect
+            COMMENT "Reflecting shader: ${SPIRV_OUTPUT} -> ${REFLECT_OUTPUT}"
+            VERBATIM
+        )
+
+        list(APPEND ALL_REFLECT_OUTPUTS "${REFLECT_OUTPUT}")
+    endforeach()
+endif()
+
+add_custom_target(ReflectShaders ALL DEPENDS ${ALL_REFLECT_OUTPUTS})
+add_dependencies(ReflectShaders CompileShaders)
+
 # --- Copy compiled shaders into each engine-dependent target's output directory ---
 # Call copy_shaders_for_targets() after all targets have been defined (from root CMakeLists.txt).
 # Each target gets: ${OUTPUT_DIR}/${target}/Shaders/
@@ -203,7 +232,7 @@ function(copy_shaders_for_targets)
                     "${TARGET_SHADER_DIR}"
             COMMAND "${CMAKE_COMMAND}" -E touch
                     "${CMAKE_CURRENT_BINARY_DIR}/${target}_copy_shaders.stamp"
-            DEPENDS ${ALL_SPIRV_OUTPUTS}
+            DEPENDS ${ALL_SPIRV_OUTPUTS} ${ALL_REFLECT_OUTPUTS}
             COMMENT "Copying compiled shaders to ${TARGET_SHADER_DIR}..."
             VERBATIM
         )
@@ -212,7 +241,7 @@ function(copy_shaders_for_targets)
             "${CMAKE_CURRENT_BINARY_DIR}/${target}_copy_shaders.stamp"
         )
 
-        add_dependencies("${target}_copy_shaders" CompileShaders)
+        add_dependencies("${target}_copy_shaders" CompileShaders ReflectShaders)
         add_dependencies(${target} "${target}_copy_shaders")
 
         message(STATUS "Adding shader copy for target: ${target} -> ${TARGET_SHADER_DIR}")
@@ -1,5 +1,3 @@
-#include "Scissor.hlsl"
-
 // Global bindless resources (binding 1 = textures)
 [[vk::binding(1, 1)]] // binding, set
 Texture2D atlases[] : register(t0);
@@ -20,7 +18,6 @@ struct PS_INPUT
     //float  OutlineThickness : OUTLINE1;             // Outline thickness
     uint   AtlasIndex         : TEXTURE;              // Atlas index in the texture set
     float2 UnitRange          : UNITRANGE;            // Unit range for the selected font (for distance calc)
-    float4 ScissorRect        : SCISSOR;              // Scissor rect (x, y, width, height)
 };
 
 float median(float r, float g, float b)
@@ -30,16 +27,6 @@ float median(float r, float g, float b)
 
 float4 main(PS_INPUT input) : SV_TARGET
 {
-    // Discard pixels outside the scissor rect
-    if (isScissorRectValid(input.ScissorRect) &&
-       (input.ClipPos.x < input.ScissorRect.x ||
-        input.ClipPos.y < input.ScissorRect.y ||
-        input.ClipPos.x > input.ScissorRect.x + input.ScissorRect.z ||
-        input.ClipPos.y > input.ScissorRect.y + input.ScissorRect.w))
-    {
-        discard;
-    }
-
     // Sample MTSDF atlas: RGB = multi-channel SDF, A = true SDF
     float4 atlas = atlases[input.AtlasIndex].Sample(atlasSampler, input.TexCoords);
 
@@ -18,7 +18,6 @@ struct VS_INPUT
     //float  OutlineThickness : OUTLINE1;             // Outline thickness
     uint   AtlasIndex         : TEXTURE;              // Atlas index in the texture set
     float2 UnitRange          : UNITRANGE;            // Unit range for the selected font (for distance calc)
-    float4 ScissorRect        : SCISSOR;              // Scissor rect (x, y, width, height)
 
     uint VertexId : SV_VertexID;
     uint InstanceId : SV_InstanceID;
@@ -37,7 +36,6 @@ struct VS_OUTPUT
     //float  OutlineThickness : OUTLINE1;             // Outline thickness
     uint   AtlasIndex         : TEXTURE;              // Atlas index in the texture set
     float2 UnitRange          : UNITRANGE;            // Unit range for the selected font (for distance calc)
-    float4 ScissorRect        : SCISSOR;              // Scissor rect (x, y, width, height)
 };
 
 VS_OUTPUT main(VS_INPUT input)
@@ -95,7 +93,6 @@ VS_OUTPUT main(VS_INPUT input)
     //output.OutlineThickness = input.OutlineThickness;
     output.AtlasIndex = input.AtlasIndex;
     output.UnitRange = input.UnitRange;
-    output.ScissorRect = input.ScissorRect;
 
     return output;
 }
\ No newline at end of file